@@ -0,0 +1,117 @@
+// Benchmark for ImFontAtlas::BuildParallelFor: time of ImFontAtlas::Build() with glyphs rasterized on 1, 2, 4 and 8 threads.
+// The default font and each TTF file given on the command line are added at 3 sizes (Latin, Greek, Cyrillic and punctuation, OversampleH = 3).
+// The texture and glyph data need to be identical whatever the number of threads: their hash is printed and compared.
+//
+// Build and run from this folder, e.g.:
+//   g++ -std=c++11 -O2 -I.. -o imgui_bench_font_build imgui_bench_font_build.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp -lpthread
+//   ./imgui_bench_font_build                             Default font only
+//   ./imgui_bench_font_build a.ttf b.ttf                 Also add these fonts (the more glyphs, the more there is to share between threads)
+//
+// Times are wall-clock, best of 5 builds: scaling depends on the number of hardware threads of the machine.
+
+#include "imgui.h"
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// FNV-1a 64-bit
+static unsigned long long HashData(unsigned long long hash, const void* data, size_t size)
+{
+    for (size_t n = 0; n < size; n++)
+        hash = (hash ^ ((const unsigned char*)data)[n]) * 0x100000001B3ull;
+    return hash;
+}
+
+// Run the jobs on 'thread_count' threads (the calling thread included)
+static void ParallelFor(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count, void* user_data)
+{
+    const int thread_count = *(const int*)user_data;
+    std::atomic<int> next_job(0);
+    auto worker = [&]()
+    {
+        for (int job_n = next_job++; job_n < job_count; job_n = next_job++)
+            job_func(job_data, job_n);
+    };
+    std::vector<std::thread> threads;
+    for (int n = 1; n < thread_count; n++)
+        threads.emplace_back(worker);
+    worker();
+    for (size_t n = 0; n < threads.size(); n++)
+        threads[n].join();
+}
+
+// Build the atlas once, return the build time and the hash of its output
+static double BuildAtlas(int argc, char** argv, int thread_count, unsigned long long* out_hash)
+{
+    static const ImWchar ranges[] =
+    {
+        0x0020, 0x00FF, // Basic Latin + Latin Supplement
+        0x0370, 0x03FF, // Greek and Coptic
+        0x0400, 0x052F, // Cyrillic + Cyrillic Supplement
+        0x2000, 0x206F, // General Punctuation
+        0,
+    };
+    ImFontAtlas atlas;
+    atlas.BuildParallelFor = (thread_count > 1) ? ParallelFor : NULL;
+    atlas.BuildParallelForUserData = &thread_count;
+    const float sizes[] = { 15.0f, 20.0f, 28.0f };
+    for (int file_n = 0; file_n < argc; file_n++)
+        for (int size_n = 0; size_n < IM_ARRAYSIZE(sizes); size_n++)
+        {
+            ImFontConfig cfg;
+            cfg.OversampleH = 3;
+            cfg.SizePixels = sizes[size_n];
+            cfg.GlyphRanges = ranges;
+            if ((file_n == 0 ? atlas.AddFontDefault(&cfg) : atlas.AddFontFromFileTTF(argv[file_n], sizes[size_n], &cfg, ranges)) == NULL)
+                return -1.0;
+        }
+
+    const double t0 = GetTimeMs();
+    atlas.Build();
+    const double ms = GetTimeMs() - t0;
+
+    unsigned char* pixels;
+    int width, height;
+    atlas.GetTexDataAsAlpha8(&pixels, &width, &height);
+    unsigned long long hash = HashData(0xCBF29CE484222325ull, pixels, (size_t)(width * height));
+    for (int font_n = 0; font_n < atlas.Fonts.Size; font_n++)
+        hash = HashData(hash, atlas.Fonts[font_n]->Glyphs.Data, (size_t)atlas.Fonts[font_n]->Glyphs.size_in_bytes());
+    *out_hash = hash;
+    return ms;
+}
+
+int main(int argc, char** argv)
+{
+    printf("Default font + %d font files, at 3 sizes, %u hardware threads\n", argc - 1, std::thread::hardware_concurrency());
+    unsigned long long ref_hash = 0;
+    bool ok = true;
+    const int thread_counts[] = { 1, 2, 4, 8 };
+    for (int n = 0; n < IM_ARRAYSIZE(thread_counts); n++)
+    {
+        double best_ms = 1e30;
+        unsigned long long hash = 0;
+        for (int run = 0; run < 5; run++)
+        {
+            const double ms = BuildAtlas(argc, argv, thread_counts[n], &hash);
+            if (ms < 0.0)
+            {
+                printf("ERROR: can't load fonts\n");
+                return 1;
+            }
+            best_ms = (ms < best_ms) ? ms : best_ms;
+        }
+        if (n == 0)
+            ref_hash = hash;
+        ok &= (hash == ref_hash);
+        printf("%d thread%s: Build() %7.2f ms, output hash 0x%016llX%s\n", thread_counts[n], thread_counts[n] > 1 ? "s" : " ", best_ms, hash, hash == ref_hash ? "" : " DIFFERENT");
+    }
+    return ok ? 0 : 1;
+}
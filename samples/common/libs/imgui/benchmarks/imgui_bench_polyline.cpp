@@ -0,0 +1,192 @@
+// Benchmark for the anti-aliased path of ImDrawList::AddPolyline(): points per second for a 4096 points polyline, thin (textured) and thick.
+// It can also dump the output of 800 random polylines (open and closed, textured and thick, with degenerate segments), and compare
+// it with a dump from another build: this checks that the SSE, NEON and scalar kernels (see ImPolylineComputeNormals()) agree.
+//
+// Build and run from this folder, e.g.:
+//   g++ -std=c++11 -O2 -I.. -o imgui_bench_polyline imgui_bench_polyline.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp
+//   ./imgui_bench_polyline                           Print points per second
+//   ./imgui_bench_polyline --dump out.bin            Write the output of the random polylines to 'out.bin'
+//   ./imgui_bench_polyline --compare out.bin         Compare the output of the random polylines with 'out.bin'
+// Other builds to compare with:
+//   -DIMGUI_DISABLE_SSE                                                         Scalar kernels only
+//   -DIMGUI_DISABLE_SSE -D__ARM_NEON -D__aarch64__ -Ineon_emulation             NEON kernels, with emulated intrinsics when not targeting AArch64
+// Indices, colors and uv need to be identical, positions may differ by up to 0.01 pixel:
+// - SSE builds use the rsqrt estimate in both the scalar and SIMD code, so the output of an SSE build is identical to the output of a build
+//   of the previous code with SSE. It differs from the output of builds without SSE (by ~0.1 pixel on sharp miters), which can't be compared.
+// - The NEON kernels refine an rsqrt estimate while the scalar code uses 1/sqrtf(): compare them with a build with -DIMGUI_DISABLE_SSE only.
+//
+// Times are wall-clock and depend on the machine: compare runs of different builds on the same machine.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // ImMax(), ImFabs(), ImSin(), ImCos()
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#define BENCH_POINTS            4096
+#define BENCH_CHECK_POLYLINES   800
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned int NextRandom(unsigned int* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static void ResetDrawList(ImDrawList* draw_list)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+}
+
+static double MeasurePointsPerSecond(ImDrawList* draw_list, const ImVector<ImVec2>& points, float thickness)
+{
+    // Best of 5 blocks of 200 calls
+    double best_ms = 1e30;
+    for (int block = 0; block < 5; block++)
+    {
+        const double t0 = GetTimeMs();
+        for (int n = 0; n < 200; n++)
+        {
+            ResetDrawList(draw_list);
+            draw_list->AddPolyline(points.Data, points.Size, IM_COL32_WHITE, ImDrawFlags_Closed, thickness);
+        }
+        const double ms = (GetTimeMs() - t0) / 200;
+        best_ms = (ms < best_ms) ? ms : best_ms;
+    }
+    return points.Size / (best_ms * 1000.0);
+}
+
+// Output of the random polylines, appended to 'out_vtx'/'out_idx'
+static void SubmitRandomPolylines(ImDrawList* draw_list, ImVector<ImDrawVert>& out_vtx, ImVector<ImDrawIdx>& out_idx)
+{
+    unsigned int rng = 1234;
+    ImVector<ImVec2> points;
+    for (int polyline_n = 0; polyline_n < BENCH_CHECK_POLYLINES; polyline_n++)
+    {
+        points.resize(2 + (int)(NextRandom(&rng) % 40));
+        for (int n = 0; n < points.Size; n++)
+        {
+            if (n > 0 && NextRandom(&rng) % 8 == 0)
+                points[n] = points[n - 1]; // Degenerate segment
+            else
+                points[n] = ImVec2((NextRandom(&rng) % 100000) * 0.01f, (NextRandom(&rng) % 100000) * 0.01f);
+        }
+        const ImDrawFlags flags = (NextRandom(&rng) % 2) ? ImDrawFlags_Closed : ImDrawFlags_None;
+        const float thicknesses[] = { 1.0f, 2.0f, 3.5f, 7.25f };
+        const float thickness = thicknesses[NextRandom(&rng) % IM_ARRAYSIZE(thicknesses)];
+        ResetDrawList(draw_list);
+        draw_list->AddPolyline(points.Data, points.Size, IM_COL32(255, 128, 64, 255), flags, thickness);
+        const int vtx_base = out_vtx.Size;
+        for (int n = 0; n < draw_list->VtxBuffer.Size; n++)
+            out_vtx.push_back(draw_list->VtxBuffer[n]);
+        for (int n = 0; n < draw_list->IdxBuffer.Size; n++)
+            out_idx.push_back((ImDrawIdx)(draw_list->IdxBuffer[n] + vtx_base));
+    }
+}
+
+static bool CompareWithDump(const char* filename, const ImVector<ImDrawVert>& vtx, const ImVector<ImDrawIdx>& idx)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+    {
+        printf("ERROR: can't open '%s'\n", filename);
+        return false;
+    }
+    int sizes[2] = { 0, 0 };
+    ImVector<ImDrawVert> ref_vtx;
+    ImVector<ImDrawIdx> ref_idx;
+    bool ok = fread(sizes, sizeof(sizes), 1, f) == 1;
+    if (ok)
+    {
+        ref_vtx.resize(sizes[0]);
+        ref_idx.resize(sizes[1]);
+        ok = fread(ref_vtx.Data, sizeof(ImDrawVert), (size_t)ref_vtx.Size, f) == (size_t)ref_vtx.Size && fread(ref_idx.Data, sizeof(ImDrawIdx), (size_t)ref_idx.Size, f) == (size_t)ref_idx.Size;
+    }
+    fclose(f);
+    if (!ok || ref_vtx.Size != vtx.Size || ref_idx.Size != idx.Size)
+    {
+        printf("FAILED: vertex or index count differ from '%s'\n", filename);
+        return false;
+    }
+    float max_pos_error = 0.0f;
+    int different_cols = 0;
+    for (int n = 0; n < vtx.Size; n++)
+    {
+        const float dx = vtx[n].pos.x - ref_vtx[n].pos.x, dy = vtx[n].pos.y - ref_vtx[n].pos.y;
+        max_pos_error = ImMax(max_pos_error, ImMax(ImFabs(dx), ImFabs(dy)));
+        if (vtx[n].col != ref_vtx[n].col || memcmp(&vtx[n].uv, &ref_vtx[n].uv, sizeof(ImVec2)) != 0)
+            different_cols++;
+    }
+    const bool same_idx = memcmp(idx.Data, ref_idx.Data, (size_t)idx.size_in_bytes()) == 0;
+    ok = same_idx && different_cols == 0 && max_pos_error <= 0.01f;
+    printf("%s: %d vertices, %d indices, indices %s, %d vertices with different color or uv, max position difference %g\n", ok ? "OK" : "FAILED", vtx.Size, idx.Size, same_idx ? "identical" : "DIFFERENT", different_cols, max_pos_error);
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    const char* dump_filename = NULL;
+    const char* compare_filename = NULL;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--dump") == 0 && n + 1 < argc)
+            dump_filename = argv[++n];
+        else if (strcmp(argv[n], "--compare") == 0 && n + 1 < argc)
+            compare_filename = argv[++n];
+    }
+
+    // A frame is needed to set up ImDrawListSharedData (font texture coordinates for textured lines, clip rect etc.)
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1024.0f, 1024.0f);
+    io.Fonts->Build();
+    ImGui::NewFrame();
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+
+    int ret = 0;
+    if (dump_filename || compare_filename)
+    {
+        ImVector<ImDrawVert> vtx;
+        ImVector<ImDrawIdx> idx;
+        SubmitRandomPolylines(&draw_list, vtx, idx);
+        if (dump_filename)
+        {
+            FILE* f = fopen(dump_filename, "wb");
+            const int sizes[2] = { vtx.Size, idx.Size };
+            if (f == NULL || fwrite(sizes, sizeof(sizes), 1, f) != 1 || fwrite(vtx.Data, sizeof(ImDrawVert), (size_t)vtx.Size, f) != (size_t)vtx.Size || fwrite(idx.Data, sizeof(ImDrawIdx), (size_t)idx.Size, f) != (size_t)idx.Size)
+            {
+                printf("ERROR: can't write '%s'\n", dump_filename);
+                ret = 1;
+            }
+            if (f)
+                fclose(f);
+        }
+        if (compare_filename && !CompareWithDump(compare_filename, vtx, idx))
+            ret = 1;
+    }
+    else
+    {
+        // Wavy closed polyline
+        ImVector<ImVec2> points;
+        points.resize(BENCH_POINTS);
+        for (int n = 0; n < points.Size; n++)
+        {
+            const float a = (float)n / points.Size * 2.0f * IM_PI;
+            const float r = 400.0f + 40.0f * ImSin(a * 64.0f);
+            points[n] = ImVec2(512.0f + ImCos(a) * r, 512.0f + ImSin(a) * r);
+        }
+        printf("%d points, thin/textured (thickness 1): %6.1f Mpoints/s\n", BENCH_POINTS, MeasurePointsPerSecond(&draw_list, points, 1.0f));
+        printf("%d points, thick (thickness 3.5):       %6.1f Mpoints/s\n", BENCH_POINTS, MeasurePointsPerSecond(&draw_list, points, 3.5f));
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ret;
+}
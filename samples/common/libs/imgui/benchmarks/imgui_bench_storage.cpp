@@ -0,0 +1,130 @@
+// Benchmark for ImGuiStorage: insert n random keys with SetInt(), then look them up 10M times with GetInt(), for n = 1k, 100k and 1M.
+// The same operations are timed on a sorted array searched with a binary search, which is how ImGuiStorage worked before it had a hash index.
+// Sorted inserts (one memmove per key) are only timed up to 100k keys: at 1M keys the sorted array is filled with push_back() + sort instead.
+//
+// Build and run from this folder, e.g.:
+//   g++ -std=c++11 -O2 -I.. -o imgui_bench_storage imgui_bench_storage.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp
+//   ./imgui_bench_storage
+//
+// Times are wall-clock and depend on the machine: compare both columns of a single run rather than numbers across machines.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // ImHashData()
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+
+#define BENCH_LOOKUPS           10000000
+
+typedef ImGuiStorage::ImGuiStoragePair Pair;
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned int NextRandom(unsigned int* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+// Sorted array searched with a binary search (ImGuiStorage before the hash index)
+static Pair* SortedLowerBound(ImVector<Pair>& data, ImGuiID key)
+{
+    Pair* first = data.Data;
+    size_t count = (size_t)data.Size;
+    while (count > 0)
+    {
+        const size_t count2 = count >> 1;
+        Pair* mid = first + count2;
+        if (mid->key < key)
+        {
+            first = ++mid;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    return first;
+}
+
+static void SortedSetInt(ImVector<Pair>& data, ImGuiID key, int val)
+{
+    Pair* it = SortedLowerBound(data, key);
+    if (it == data.end() || it->key != key)
+        data.insert(it, Pair(key, val));
+    else
+        it->val_i = val;
+}
+
+static int SortedGetInt(ImVector<Pair>& data, ImGuiID key, int default_val)
+{
+    Pair* it = SortedLowerBound(data, key);
+    return (it == data.end() || it->key != key) ? default_val : it->val_i;
+}
+
+static bool PairLess(const Pair& a, const Pair& b) { return a.key < b.key; }
+
+static void RunBenchmark(int key_count)
+{
+    // Random keys, as produced by the ID stack
+    ImVector<ImGuiID> keys;
+    keys.resize(key_count);
+    for (int n = 0; n < key_count; n++)
+        keys[n] = ImHashData(&n, sizeof(n), 0x12345678);
+    ImVector<int> lookup_order;
+    lookup_order.resize(BENCH_LOOKUPS);
+    unsigned int rng = 1234;
+    for (int n = 0; n < BENCH_LOOKUPS; n++)
+        lookup_order[n] = (int)(NextRandom(&rng) % (unsigned int)key_count);
+
+    // ImGuiStorage
+    ImGuiStorage storage;
+    double t0 = GetTimeMs();
+    for (int n = 0; n < key_count; n++)
+        storage.SetInt(keys[n], n);
+    const double storage_insert_ms = GetTimeMs() - t0;
+    long long storage_sum = 0;
+    t0 = GetTimeMs();
+    for (int n = 0; n < BENCH_LOOKUPS; n++)
+        storage_sum += storage.GetInt(keys[lookup_order[n]], -1);
+    const double storage_lookup_ms = GetTimeMs() - t0;
+
+    // Sorted array
+    ImVector<Pair> sorted;
+    const bool sorted_inserts = (key_count <= 100000);
+    t0 = GetTimeMs();
+    if (sorted_inserts)
+    {
+        for (int n = 0; n < key_count; n++)
+            SortedSetInt(sorted, keys[n], n);
+    }
+    else
+    {
+        for (int n = 0; n < key_count; n++)
+            sorted.push_back(Pair(keys[n], n));
+        std::sort(sorted.begin(), sorted.end(), PairLess);
+    }
+    const double sorted_insert_ms = GetTimeMs() - t0;
+    long long sorted_sum = 0;
+    t0 = GetTimeMs();
+    for (int n = 0; n < BENCH_LOOKUPS; n++)
+        sorted_sum += SortedGetInt(sorted, keys[lookup_order[n]], -1);
+    const double sorted_lookup_ms = GetTimeMs() - t0;
+
+    if (storage_sum != sorted_sum)
+        printf("ERROR: lookups returned different values\n");
+    printf("%8d keys: insert %9.2f ms (sorted%s: %9.2f ms), %d lookups %8.1f ms (sorted: %8.1f ms)\n",
+        key_count, storage_insert_ms, sorted_inserts ? "" : ", push_back + sort", sorted_insert_ms, BENCH_LOOKUPS, storage_lookup_ms, sorted_lookup_ms);
+}
+
+int main(int, char**)
+{
+    const int key_counts[] = { 1000, 100000, 1000000 };
+    for (int n = 0; n < IM_ARRAYSIZE(key_counts); n++)
+        RunBenchmark(key_counts[n]);
+    return 0;
+}
@@ -0,0 +1,137 @@
+// Benchmark for ImFont::RenderText() and ImFont::CalcTextSizeA(): characters per second on 1 MB of generated text, mostly identifiers and
+// numbers (printable ASCII, which takes the fast path of ImTextFindAsciiRunEnd()), with some Latin-1 and CJK (UTF-8 sequences).
+// Text is submitted one line per call with the default font at 13px, the draw list being reset every 16K vertices.
+//
+// Build and run from this folder, e.g.:
+//   g++ -std=c++11 -O2 -I.. -o imgui_bench_text imgui_bench_text.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp
+//   ./imgui_bench_text
+//
+// Times are wall-clock, best of 10 passes over the text: compare runs of different builds on the same machine.
+
+#include "imgui.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#define BENCH_TEXT_SIZE         (1024 * 1024)
+#define BENCH_PASSES            10
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned int NextRandom(unsigned int* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static void AppendUtf8(ImVector<char>& text, unsigned int c)
+{
+    if (c < 0x80)       { text.push_back((char)c); }
+    else if (c < 0x800) { text.push_back((char)(0xC0 | (c >> 6))); text.push_back((char)(0x80 | (c & 0x3F))); }
+    else                { text.push_back((char)(0xE0 | (c >> 12))); text.push_back((char)(0x80 | ((c >> 6) & 0x3F))); text.push_back((char)(0x80 | (c & 0x3F))); }
+}
+
+// Lines of words separated by spaces and punctuation: 85% identifiers, 10% numbers, 4% Latin-1 words, 1% CJK words
+static void GenerateText(ImVector<char>& text, ImVector<int>& line_starts, int* out_char_count)
+{
+    static const char* punctuation[] = { " ", " ", " ", ", ", " = ", "(", ")", "; ", ".", " + " };
+    unsigned int rng = 1234;
+    int char_count = 0;
+    line_starts.push_back(0);
+    while (text.Size < BENCH_TEXT_SIZE)
+    {
+        const unsigned int kind = NextRandom(&rng) % 100;
+        const int len = 1 + (int)(NextRandom(&rng) % 10);
+        for (int n = 0; n < len; n++, char_count++)
+        {
+            if (kind < 85)
+                AppendUtf8(text, (n > 0 && NextRandom(&rng) % 4 == 0) ? '_' : 'a' + NextRandom(&rng) % 26);
+            else if (kind < 95)
+                AppendUtf8(text, '0' + NextRandom(&rng) % 10);
+            else if (kind < 99)
+                AppendUtf8(text, 0xC0 + NextRandom(&rng) % 64);
+            else
+                AppendUtf8(text, 0x4E00 + NextRandom(&rng) % 0x5000);
+        }
+        const char* sep = punctuation[NextRandom(&rng) % IM_ARRAYSIZE(punctuation)];
+        for (const char* p = sep; *p; p++, char_count++)
+            text.push_back(*p);
+        if (NextRandom(&rng) % 12 == 0)
+        {
+            text.push_back('\n');
+            char_count++;
+            line_starts.push_back(text.Size);
+        }
+    }
+    line_starts.push_back(text.Size);
+    *out_char_count = char_count;
+}
+
+enum BenchMode { BenchMode_RenderText, BenchMode_RenderTextWrapped, BenchMode_CalcTextSize, BenchMode_COUNT };
+
+static double RunPass(BenchMode mode, ImDrawList* draw_list, ImFont* font, const ImVector<char>& text, const ImVector<int>& line_starts, float* out_checksum)
+{
+    float checksum = 0.0f;
+    const double t0 = GetTimeMs();
+    for (int line_n = 0; line_n + 1 < line_starts.Size; line_n++)
+    {
+        const char* line_begin = text.Data + line_starts[line_n];
+        const char* line_end = text.Data + line_starts[line_n + 1];
+        if (mode == BenchMode_CalcTextSize)
+        {
+            checksum += font->CalcTextSizeA(font->FontSize, FLT_MAX, 0.0f, line_begin, line_end).x;
+            continue;
+        }
+        if (draw_list->VtxBuffer.Size > 16 * 1024)
+        {
+            checksum += (float)draw_list->VtxBuffer.Size;
+            draw_list->_ResetForNewFrame();
+            draw_list->PushClipRectFullScreen();
+            draw_list->PushTextureID(font->ContainerAtlas->TexID);
+        }
+        draw_list->AddText(font, font->FontSize, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, line_begin, line_end, mode == BenchMode_RenderTextWrapped ? 300.0f : 0.0f);
+    }
+    *out_checksum = checksum;
+    return GetTimeMs() - t0;
+}
+
+int main(int, char**)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(4096.0f, 4096.0f);
+    io.Fonts->Build();
+    ImGui::NewFrame();
+    ImFont* font = ImGui::GetFont();
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    draw_list._ResetForNewFrame();
+    draw_list.PushClipRectFullScreen();
+    draw_list.PushTextureID(io.Fonts->TexID);
+
+    ImVector<char> text;
+    ImVector<int> line_starts;
+    int char_count = 0;
+    GenerateText(text, line_starts, &char_count);
+    printf("%d bytes, %d code-points, %d lines\n", text.Size, char_count, line_starts.Size - 1);
+
+    static const char* mode_names[BenchMode_COUNT] = { "RenderText", "RenderText wrapped", "CalcTextSizeA" };
+    for (int mode = 0; mode < BenchMode_COUNT; mode++)
+    {
+        double best_ms = 1e30;
+        float checksum = 0.0f;
+        for (int pass = 0; pass < BENCH_PASSES; pass++)
+        {
+            const double ms = RunPass((BenchMode)mode, &draw_list, font, text, line_starts, &checksum);
+            best_ms = (ms < best_ms) ? ms : best_ms;
+        }
+        printf("%-20s %7.1f Mchars/s (checksum %g)\n", mode_names[mode], char_count / (best_ms * 1000.0), checksum);
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return 0;
+}
@@ -0,0 +1,65 @@
+// Scalar emulation of the few NEON intrinsics used by Dear ImGui (AddPolyline() kernels, ImTextFindAsciiRunEnd()), for GCC/Clang on any target.
+// It allows compiling and running the IMGUI_ENABLE_NEON code paths without an AArch64 toolchain, to check that they build and
+// to compare their output with the SSE and scalar paths. It is a development aid only: it is not meant to be fast.
+//
+// Use it by putting this folder first in the include path and pretending to target AArch64, e.g. from benchmarks/:
+//   g++ -std=c++11 -O2 -I.. -Ineon_emulation -DIMGUI_DISABLE_SSE -D__ARM_NEON -D__aarch64__ ...
+//
+// vrsqrteq_f32() keeps 8 bits of mantissa like the hardware estimate, so the Newton-Raphson step done by the caller matters as it does on AArch64.
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef float           float32x4_t __attribute__((vector_size(16)));
+typedef float           float32x2_t __attribute__((vector_size(8)));
+typedef uint32_t        uint32x4_t  __attribute__((vector_size(16)));
+typedef int8_t          int8x16_t   __attribute__((vector_size(16)));
+typedef uint8_t         uint8x16_t  __attribute__((vector_size(16)));
+struct float32x4x2_t    { float32x4_t val[2]; };
+
+static inline float32x4_t   vdupq_n_f32(float v)                                { float32x4_t r = { v, v, v, v }; return r; }
+static inline float32x4_t   vaddq_f32(float32x4_t a, float32x4_t b)             { return a + b; }
+static inline float32x4_t   vsubq_f32(float32x4_t a, float32x4_t b)             { return a - b; }
+static inline float32x4_t   vmulq_f32(float32x4_t a, float32x4_t b)             { return a * b; }
+static inline float32x4_t   vdivq_f32(float32x4_t a, float32x4_t b)             { return a / b; }
+static inline float32x4_t   vnegq_f32(float32x4_t a)                            { return -a; }
+static inline float32x4_t   vminq_f32(float32x4_t a, float32x4_t b)             { float32x4_t r; for (int n = 0; n < 4; n++) r[n] = (a[n] < b[n]) ? a[n] : b[n]; return r; }
+static inline uint32x4_t    vcgtq_f32(float32x4_t a, float32x4_t b)             { uint32x4_t r; for (int n = 0; n < 4; n++) r[n] = (a[n] > b[n]) ? 0xFFFFFFFFu : 0u; return r; }
+static inline float32x4_t   vbslq_f32(uint32x4_t m, float32x4_t a, float32x4_t b)
+{
+    uint32x4_t ua, ub;
+    memcpy(&ua, &a, sizeof(ua));
+    memcpy(&ub, &b, sizeof(ub));
+    const uint32x4_t ur = (ua & m) | (ub & ~m);
+    float32x4_t r;
+    memcpy(&r, &ur, sizeof(r));
+    return r;
+}
+static inline float32x4_t   vrsqrteq_f32(float32x4_t a)
+{
+    float32x4_t r;
+    for (int n = 0; n < 4; n++)
+    {
+        float e = 1.0f / sqrtf(a[n]);
+        uint32_t bits;
+        memcpy(&bits, &e, sizeof(bits));
+        bits &= 0xFFFF8000u;
+        memcpy(&e, &bits, sizeof(e));
+        r[n] = e;
+    }
+    return r;
+}
+static inline float32x4_t   vrsqrtsq_f32(float32x4_t a, float32x4_t b)          { return (vdupq_n_f32(3.0f) - a * b) * vdupq_n_f32(0.5f); }
+static inline float32x4x2_t vld2q_f32(const float* p)                           { float32x4x2_t r; for (int n = 0; n < 4; n++) { r.val[0][n] = p[n * 2]; r.val[1][n] = p[n * 2 + 1]; } return r; }
+static inline float32x4x2_t vzipq_f32(float32x4_t a, float32x4_t b)             { float32x4x2_t r; for (int n = 0; n < 4; n++) { r.val[n / 2][(n % 2) * 2] = a[n]; r.val[n / 2][(n % 2) * 2 + 1] = b[n]; } return r; }
+static inline float32x2_t   vget_low_f32(float32x4_t a)                         { float32x2_t r = { a[0], a[1] }; return r; }
+static inline float32x2_t   vget_high_f32(float32x4_t a)                        { float32x2_t r = { a[2], a[3] }; return r; }
+static inline void          vst1_f32(float* p, float32x2_t a)                   { p[0] = a[0]; p[1] = a[1]; }
+
+static inline int8x16_t     vdupq_n_s8(int8_t v)                                { int8x16_t r; for (int n = 0; n < 16; n++) r[n] = v; return r; }
+static inline int8x16_t     vld1q_s8(const int8_t* p)                           { int8x16_t r; memcpy(&r, p, sizeof(r)); return r; }
+static inline uint8x16_t    vcltq_s8(int8x16_t a, int8x16_t b)                  { uint8x16_t r; for (int n = 0; n < 16; n++) r[n] = (a[n] < b[n]) ? 0xFF : 0x00; return r; }
+static inline uint8_t       vmaxvq_u8(uint8x16_t a)                             { uint8_t r = 0; for (int n = 0; n < 16; n++) r = (a[n] > r) ? a[n] : r; return r; }
@@ -601,6 +601,10 @@ CIMGUI_API void igBulletTextV(const char* fmt,va_list args)
 {
     return ImGui::BulletTextV(fmt,args);
 }
+CIMGUI_API void igTextView(const char* str_id,ImGuiTextView* view,const ImVec2 size,ImGuiTextViewFlags flags)
+{
+    return ImGui::TextView(str_id,view,size,flags);
+}
 CIMGUI_API bool igButton(const char* label,const ImVec2 size)
 {
     return ImGui::Button(label,size);
@@ -785,6 +789,10 @@ CIMGUI_API bool igInputTextMultiline(const char* label,char* buf,size_t buf_size
 {
     return ImGui::InputTextMultiline(label,buf,buf_size,size,flags,callback,user_data);
 }
+CIMGUI_API bool igInputTextMultiline_TextEditBufferPtr(const char* label,ImGuiTextEditBuffer* buffer,const ImVec2 size,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data)
+{
+    return ImGui::InputTextMultiline(label,buffer,size,flags,callback,user_data);
+}
 CIMGUI_API bool igInputTextWithHint(const char* label,const char* hint,char* buf,size_t buf_size,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data)
 {
     return ImGui::InputTextWithHint(label,hint,buf,buf_size,flags,callback,user_data);
@@ -1548,6 +1556,19 @@ CIMGUI_API bool igDebugCheckVersionAndDataLayout(const char* version_str,size_t
 {
     return ImGui::DebugCheckVersionAndDataLayout(version_str,sz_io,sz_style,sz_vec2,sz_vec4,sz_drawvert,sz_drawidx);
 }
+// Structures of this tree are mirrored by hand in cimgui.h: call with the sizes seen by the C side (e.g. @sizeOf() of @cImport types in Zig)
+CIMGUI_API bool igDebugCheckCimguiDataLayout(size_t sz_window,size_t sz_window_retained,size_t sz_drawlist,size_t sz_drawlistcache,size_t sz_drawdata,size_t sz_fontatlas,size_t sz_font)
+{
+    bool error = false;
+    if (sz_window != sizeof(ImGuiWindow)) { error = true; IM_ASSERT(sz_window == sizeof(ImGuiWindow) && "Mismatched struct layout between cimgui.h and imgui_internal.h!"); }
+    if (sz_window_retained != sizeof(ImGuiWindowRetainedDrawList)) { error = true; IM_ASSERT(sz_window_retained == sizeof(ImGuiWindowRetainedDrawList) && "Mismatched struct layout between cimgui.h and imgui_internal.h!"); }
+    if (sz_drawlist != sizeof(ImDrawList)) { error = true; IM_ASSERT(sz_drawlist == sizeof(ImDrawList) && "Mismatched struct layout between cimgui.h and imgui.h!"); }
+    if (sz_drawlistcache != sizeof(ImDrawListCache)) { error = true; IM_ASSERT(sz_drawlistcache == sizeof(ImDrawListCache) && "Mismatched struct layout between cimgui.h and imgui.h!"); }
+    if (sz_drawdata != sizeof(ImDrawData)) { error = true; IM_ASSERT(sz_drawdata == sizeof(ImDrawData) && "Mismatched struct layout between cimgui.h and imgui.h!"); }
+    if (sz_fontatlas != sizeof(ImFontAtlas)) { error = true; IM_ASSERT(sz_fontatlas == sizeof(ImFontAtlas) && "Mismatched struct layout between cimgui.h and imgui.h!"); }
+    if (sz_font != sizeof(ImFont)) { error = true; IM_ASSERT(sz_font == sizeof(ImFont) && "Mismatched struct layout between cimgui.h and imgui.h!"); }
+    return !error;
+}
 CIMGUI_API void igSetAllocatorFunctions(ImGuiMemAllocFunc alloc_func,ImGuiMemFreeFunc free_func,void* user_data)
 {
     return ImGui::SetAllocatorFunctions(alloc_func,free_func,user_data);
@@ -1800,6 +1821,110 @@ CIMGUI_API void ImGuiTextBuffer_appendfv(ImGuiTextBuffer* self,const char* fmt,v
 {
     return self->appendfv(fmt,args);
 }
+CIMGUI_API ImGuiTextView* ImGuiTextView_ImGuiTextView(void)
+{
+    return IM_NEW(ImGuiTextView)();
+}
+CIMGUI_API void ImGuiTextView_destroy(ImGuiTextView* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API void ImGuiTextView_Clear(ImGuiTextView* self)
+{
+    return self->Clear();
+}
+CIMGUI_API void ImGuiTextView_SetText(ImGuiTextView* self,const char* text,int text_size)
+{
+    return self->SetText(text,text_size);
+}
+CIMGUI_API int ImGuiTextView_GetLineCount(ImGuiTextView* self)
+{
+    return self->GetLineCount();
+}
+CIMGUI_API const char* ImGuiTextView_GetLineBegin(ImGuiTextView* self,int n)
+{
+    return self->GetLineBegin(n);
+}
+CIMGUI_API const char* ImGuiTextView_GetLineEnd(ImGuiTextView* self,int n)
+{
+    return self->GetLineEnd(n);
+}
+CIMGUI_API bool ImGuiTextView_HasSelection(ImGuiTextView* self)
+{
+    return self->HasSelection();
+}
+CIMGUI_API void ImGuiTextView_ClearSelection(ImGuiTextView* self)
+{
+    return self->ClearSelection();
+}
+CIMGUI_API void ImGuiTextView_SelectAll(ImGuiTextView* self)
+{
+    return self->SelectAll();
+}
+CIMGUI_API ImGuiTextEditBuffer* ImGuiTextEditBuffer_ImGuiTextEditBuffer(void)
+{
+    return IM_NEW(ImGuiTextEditBuffer)();
+}
+CIMGUI_API void ImGuiTextEditBuffer_destroy(ImGuiTextEditBuffer* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API void ImGuiTextEditBuffer_Clear(ImGuiTextEditBuffer* self)
+{
+    return self->Clear();
+}
+CIMGUI_API void ImGuiTextEditBuffer_SetText(ImGuiTextEditBuffer* self,const char* text,const char* text_end)
+{
+    return self->SetText(text,text_end);
+}
+CIMGUI_API int ImGuiTextEditBuffer_GetText(ImGuiTextEditBuffer* self,char* buf,int buf_size,int pos_begin,int pos_end)
+{
+    return self->GetText(buf,buf_size,pos_begin,pos_end);
+}
+CIMGUI_API int ImGuiTextEditBuffer_GetTextSizeA(ImGuiTextEditBuffer* self,int pos_begin,int pos_end)
+{
+    return self->GetTextSizeA(pos_begin,pos_end);
+}
+CIMGUI_API int ImGuiTextEditBuffer_GetLength(ImGuiTextEditBuffer* self)
+{
+    return self->GetLength();
+}
+CIMGUI_API ImWchar ImGuiTextEditBuffer_GetChar(ImGuiTextEditBuffer* self,int pos)
+{
+    return self->GetChar(pos);
+}
+CIMGUI_API int ImGuiTextEditBuffer_GetLineCount(ImGuiTextEditBuffer* self)
+{
+    return self->GetLineCount();
+}
+CIMGUI_API int ImGuiTextEditBuffer_GetLineStart(ImGuiTextEditBuffer* self,int line)
+{
+    return self->GetLineStart(line);
+}
+CIMGUI_API int ImGuiTextEditBuffer_GetLineBreak(ImGuiTextEditBuffer* self,int n)
+{
+    return self->GetLineBreak(n);
+}
+CIMGUI_API int ImGuiTextEditBuffer_GetLineFromPos(ImGuiTextEditBuffer* self,int pos)
+{
+    return self->GetLineFromPos(pos);
+}
+CIMGUI_API void ImGuiTextEditBuffer_Insert_WcharPtr(ImGuiTextEditBuffer* self,int pos,const ImWchar* text,int text_len)
+{
+    return self->Insert(pos,text,text_len);
+}
+CIMGUI_API void ImGuiTextEditBuffer_Insert_Str(ImGuiTextEditBuffer* self,int pos,const char* text,const char* text_end)
+{
+    return self->Insert(pos,text,text_end);
+}
+CIMGUI_API void ImGuiTextEditBuffer_Delete(ImGuiTextEditBuffer* self,int pos,int count)
+{
+    return self->Delete(pos,count);
+}
+CIMGUI_API void ImGuiTextEditBuffer_MoveGap(ImGuiTextEditBuffer* self,int pos,int min_gap_size)
+{
+    return self->MoveGap(pos,min_gap_size);
+}
 CIMGUI_API ImGuiStoragePair* ImGuiStoragePair_ImGuiStoragePair_Int(ImGuiID _key,int _val_i)
 {
     return IM_NEW(ImGuiStoragePair)(_key,_val_i);
@@ -2080,6 +2205,26 @@ CIMGUI_API void ImDrawList_AddBezierQuadratic(ImDrawList* self,const ImVec2 p1,c
 {
     return self->AddBezierQuadratic(p1,p2,p3,col,thickness,num_segments);
 }
+CIMGUI_API void ImDrawList_AddLineBatch(ImDrawList* self,const ImVec2* p1,const ImVec2* p2,const ImU32* cols,int count,float thickness)
+{
+    return self->AddLineBatch(p1,p2,cols,count,thickness);
+}
+CIMGUI_API void ImDrawList_AddRectFilledBatch(ImDrawList* self,const ImVec2* p_min,const ImVec2* p_max,const ImU32* cols,int count)
+{
+    return self->AddRectFilledBatch(p_min,p_max,cols,count);
+}
+CIMGUI_API void ImDrawList_AddQuadFilledBatch(ImDrawList* self,const ImVec2* points,const ImU32* cols,int count)
+{
+    return self->AddQuadFilledBatch(points,cols,count);
+}
+CIMGUI_API void ImDrawList_AddCircleFilledBatch(ImDrawList* self,const ImVec2* centers,const float* radii,const ImU32* cols,int count,int num_segments)
+{
+    return self->AddCircleFilledBatch(centers,radii,cols,count,num_segments);
+}
+CIMGUI_API void ImDrawList_AddDrawListCache(ImDrawList* self,const ImDrawListCache* cache,const ImVec2 offset,float scale,ImU32 tint_col)
+{
+    return self->AddDrawListCache(*cache,offset,scale,tint_col);
+}
 CIMGUI_API void ImDrawList_AddImage(ImDrawList* self,ImTextureID user_texture_id,const ImVec2 p_min,const ImVec2 p_max,const ImVec2 uv_min,const ImVec2 uv_max,ImU32 col)
 {
     return self->AddImage(user_texture_id,p_min,p_max,uv_min,uv_max,col);
@@ -2144,6 +2289,22 @@ CIMGUI_API ImDrawList* ImDrawList_CloneOutput(ImDrawList* self)
 {
     return self->CloneOutput();
 }
+CIMGUI_API void ImDrawList_ExpandInstancedQuads(ImDrawList* self)
+{
+    return self->ExpandInstancedQuads();
+}
+CIMGUI_API void ImDrawList_ResetForNewFrame(ImDrawList* self)
+{
+    return self->ResetForNewFrame();
+}
+CIMGUI_API void ImDrawList_AddDrawListDeferred(ImDrawList* self,const ImDrawList* draw_list)
+{
+    return self->AddDrawListDeferred(draw_list);
+}
+CIMGUI_API void ImDrawList_ResolveDeferredDrawLists(ImDrawList* self)
+{
+    return self->ResolveDeferredDrawLists();
+}
 CIMGUI_API void ImDrawList_ChannelsSplit(ImDrawList* self,int count)
 {
     return self->ChannelsSplit(count);
@@ -2188,6 +2349,18 @@ CIMGUI_API void ImDrawList_PrimVtx(ImDrawList* self,const ImVec2 pos,const ImVec
 {
     return self->PrimVtx(pos,uv,col);
 }
+CIMGUI_API ImDrawQuad* ImDrawList_PrimReserveQuads(ImDrawList* self,int quad_count)
+{
+    return self->PrimReserveQuads(quad_count);
+}
+CIMGUI_API void ImDrawList_PrimUnreserveQuads(ImDrawList* self,int quad_count)
+{
+    return self->PrimUnreserveQuads(quad_count);
+}
+CIMGUI_API void ImDrawList_PrimRectInstanced(ImDrawList* self,const ImVec2 a,const ImVec2 b,const ImVec2 uv_a,const ImVec2 uv_b,ImU32 col,float rounding,ImDrawFlags flags)
+{
+    return self->PrimRectInstanced(a,b,uv_a,uv_b,col,rounding,flags);
+}
 CIMGUI_API void ImDrawList__ResetForNewFrame(ImDrawList* self)
 {
     return self->_ResetForNewFrame();
@@ -2216,6 +2389,10 @@ CIMGUI_API void ImDrawList__OnChangedVtxOffset(ImDrawList* self)
 {
     return self->_OnChangedVtxOffset();
 }
+CIMGUI_API void ImDrawList__OnChangedCmdBuffer(ImDrawList* self)
+{
+    return self->_OnChangedCmdBuffer();
+}
 CIMGUI_API int ImDrawList__CalcCircleAutoSegmentCount(ImDrawList* self,float radius)
 {
     return self->_CalcCircleAutoSegmentCount(radius);
@@ -2228,6 +2405,34 @@ CIMGUI_API void ImDrawList__PathArcToN(ImDrawList* self,const ImVec2 center,floa
 {
     return self->_PathArcToN(center,radius,a_min,a_max,num_segments);
 }
+CIMGUI_API ImDrawListCache* ImDrawListCache_ImDrawListCache(void)
+{
+    return IM_NEW(ImDrawListCache)();
+}
+CIMGUI_API void ImDrawListCache_destroy(ImDrawListCache* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API void ImDrawListCache_Clear(ImDrawListCache* self)
+{
+    return self->Clear();
+}
+CIMGUI_API bool ImDrawListCache_IsEmpty(ImDrawListCache* self)
+{
+    return self->IsEmpty();
+}
+CIMGUI_API bool ImDrawListCache_IsStale(ImDrawListCache* self)
+{
+    return self->IsStale();
+}
+CIMGUI_API void ImDrawListCache_BeginRecord(ImDrawListCache* self,ImDrawList* draw_list)
+{
+    return self->BeginRecord(draw_list);
+}
+CIMGUI_API void ImDrawListCache_EndRecord(ImDrawListCache* self)
+{
+    return self->EndRecord();
+}
 CIMGUI_API ImDrawData* ImDrawData_ImDrawData(void)
 {
     return IM_NEW(ImDrawData)();
@@ -2248,6 +2453,14 @@ CIMGUI_API void ImDrawData_ScaleClipRects(ImDrawData* self,const ImVec2 fb_scale
 {
     return self->ScaleClipRects(fb_scale);
 }
+CIMGUI_API int ImDrawData_Optimize(ImDrawData* self)
+{
+    return self->Optimize();
+}
+CIMGUI_API void ImDrawData_CopyToBuffers(ImDrawData* self,void* vtx_dst,void* idx_dst,ImDrawIdxFormat fmt,int cmd_lists_begin,int cmd_lists_end)
+{
+    return self->CopyToBuffers(vtx_dst,idx_dst,fmt,cmd_lists_begin,cmd_lists_end);
+}
 CIMGUI_API ImFontConfig* ImFontConfig_ImFontConfig(void)
 {
     return IM_NEW(ImFontConfig)();
@@ -2348,6 +2561,10 @@ CIMGUI_API void ImFontAtlas_ClearFonts(ImFontAtlas* self)
 {
     return self->ClearFonts();
 }
+CIMGUI_API void ImFontAtlas_ClearTexDirtyRects(ImFontAtlas* self)
+{
+    return self->ClearTexDirtyRects();
+}
 CIMGUI_API void ImFontAtlas_Clear(ImFontAtlas* self)
 {
     return self->Clear();
@@ -2372,6 +2589,18 @@ CIMGUI_API void ImFontAtlas_SetTexID(ImFontAtlas* self,ImTextureID id)
 {
     return self->SetTexID(id);
 }
+CIMGUI_API bool ImFontAtlas_SaveBakedCache(ImFontAtlas* self,const char* filename)
+{
+    return self->SaveBakedCache(filename);
+}
+CIMGUI_API bool ImFontAtlas_LoadBakedCache(ImFontAtlas* self,const char* filename)
+{
+    return self->LoadBakedCache(filename);
+}
+CIMGUI_API bool ImFontAtlas_LoadBakedCacheFromMemory(ImFontAtlas* self,const void* data,size_t data_size)
+{
+    return self->LoadBakedCacheFromMemory(data,data_size);
+}
 CIMGUI_API const ImWchar* ImFontAtlas_GetGlyphRangesDefault(ImFontAtlas* self)
 {
     return self->GetGlyphRangesDefault();
@@ -2424,6 +2653,26 @@ CIMGUI_API bool ImFontAtlas_GetMouseCursorTexData(ImFontAtlas* self,ImGuiMouseCu
 {
     return self->GetMouseCursorTexData(cursor,out_offset,out_size,out_uv_border,out_uv_fill);
 }
+CIMGUI_API ImFontTextSizeCache* ImFontTextSizeCache_ImFontTextSizeCache(void)
+{
+    return IM_NEW(ImFontTextSizeCache)();
+}
+CIMGUI_API void ImFontTextSizeCache_destroy(ImFontTextSizeCache* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API void ImFontTextSizeCache_Clear(ImFontTextSizeCache* self)
+{
+    return self->Clear();
+}
+CIMGUI_API void ImFontTextSizeCache_ClearStats(ImFontTextSizeCache* self)
+{
+    return self->ClearStats();
+}
+CIMGUI_API float ImFontTextSizeCache_GetHitRate(ImFontTextSizeCache* self)
+{
+    return self->GetHitRate();
+}
 CIMGUI_API ImFont* ImFont_ImFont(void)
 {
     return IM_NEW(ImFont)();
@@ -2440,6 +2689,10 @@ CIMGUI_API const ImFontGlyph* ImFont_FindGlyphNoFallback(ImFont* self,ImWchar c)
 {
     return self->FindGlyphNoFallback(c);
 }
+CIMGUI_API int ImFont_GetIndexOffset(ImFont* self,unsigned int c)
+{
+    return self->GetIndexOffset(c);
+}
 CIMGUI_API float ImFont_GetCharAdvance(ImFont* self,ImWchar c)
 {
     return self->GetCharAdvance(c);
@@ -2456,6 +2709,10 @@ CIMGUI_API void ImFont_CalcTextSizeA(ImVec2 *pOut,ImFont* self,float size,float
 {
     *pOut = self->CalcTextSizeA(size,max_width,wrap_width,text_begin,text_end,remaining);
 }
+CIMGUI_API void ImFont_CalcTextSizeCached(ImVec2 *pOut,ImFont* self,float size,float wrap_width,const char* text_begin,const char* text_end)
+{
+    *pOut = self->CalcTextSizeCached(size,wrap_width,text_begin,text_end);
+}
 CIMGUI_API const char* ImFont_CalcWordWrapPositionA(ImFont* self,float scale,const char* text,const char* text_end,float wrap_width)
 {
     return self->CalcWordWrapPositionA(scale,text,text_end,wrap_width);
@@ -2480,6 +2737,10 @@ CIMGUI_API void ImFont_GrowIndex(ImFont* self,int new_size)
 {
     return self->GrowIndex(new_size);
 }
+CIMGUI_API int ImFont_AllocIndexPage(ImFont* self,unsigned int c)
+{
+    return self->AllocIndexPage(c);
+}
 CIMGUI_API void ImFont_AddGlyph(ImFont* self,const ImFontConfig* src_cfg,ImWchar c,float x0,float y0,float x1,float y1,float u0,float v0,float u1,float v1,float advance_x)
 {
     return self->AddGlyph(src_cfg,c,x0,y0,x1,y1,u0,v0,u1,v1,advance_x);
@@ -2664,6 +2925,10 @@ CIMGUI_API int igImTextCountUtf8BytesFromStr(const ImWchar* in_text,const ImWcha
 {
     return ImTextCountUtf8BytesFromStr(in_text,in_text_end);
 }
+CIMGUI_API const char* igImTextFindAsciiRunEnd(const char* in_text,const char* in_text_end)
+{
+    return ImTextFindAsciiRunEnd(in_text,in_text_end);
+}
 CIMGUI_API ImFileHandle igImFileOpen(const char* filename,const char* mode)
 {
     return ImFileOpen(filename,mode);
@@ -3044,6 +3309,10 @@ CIMGUI_API void ImDrawListSharedData_SetCircleTessellationMaxError(ImDrawListSha
 {
     return self->SetCircleTessellationMaxError(max_error);
 }
+CIMGUI_API float igImDrawQuadCalcCoverage(const ImDrawQuad quad,const ImVec2 p,float fringe_width)
+{
+    return ImDrawQuadCalcCoverage(quad,p,fringe_width);
+}
 CIMGUI_API void ImDrawDataBuilder_Clear(ImDrawDataBuilder* self)
 {
     return self->Clear();
@@ -3104,6 +3373,58 @@ CIMGUI_API void ImGuiMenuColumns_CalcNextTotalWidth(ImGuiMenuColumns* self,bool
 {
     return self->CalcNextTotalWidth(update_offsets);
 }
+CIMGUI_API ImGuiTextUndoStack* ImGuiTextUndoStack_ImGuiTextUndoStack(void)
+{
+    return IM_NEW(ImGuiTextUndoStack)();
+}
+CIMGUI_API void ImGuiTextUndoStack_destroy(ImGuiTextUndoStack* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API void ImGuiTextUndoStack_Clear(ImGuiTextUndoStack* self)
+{
+    return self->Clear();
+}
+CIMGUI_API int ImGuiTextUndoStack_GetCount(ImGuiTextUndoStack* self)
+{
+    return self->GetCount();
+}
+CIMGUI_API int ImGuiTextUndoStack_GetMemoryUsed(ImGuiTextUndoStack* self)
+{
+    return self->GetMemoryUsed();
+}
+CIMGUI_API const ImWchar* ImGuiTextUndoStack_GetTopChars(ImGuiTextUndoStack* self)
+{
+    return self->GetTopChars();
+}
+CIMGUI_API ImWchar* ImGuiTextUndoStack_Push(ImGuiTextUndoStack* self,int where,int insert_len,int delete_len)
+{
+    return self->Push(where,insert_len,delete_len);
+}
+CIMGUI_API void ImGuiTextUndoStack_Pop(ImGuiTextUndoStack* self)
+{
+    return self->Pop();
+}
+CIMGUI_API void ImGuiTextUndoStack_DiscardOldest(ImGuiTextUndoStack* self)
+{
+    return self->DiscardOldest();
+}
+CIMGUI_API ImGuiTextUndoState* ImGuiTextUndoState_ImGuiTextUndoState(void)
+{
+    return IM_NEW(ImGuiTextUndoState)();
+}
+CIMGUI_API void ImGuiTextUndoState_destroy(ImGuiTextUndoState* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API void ImGuiTextUndoState_ClearFreeMemory(ImGuiTextUndoState* self)
+{
+    return self->ClearFreeMemory();
+}
+CIMGUI_API int ImGuiTextUndoState_GetMemoryUsed(ImGuiTextUndoState* self)
+{
+    return self->GetMemoryUsed();
+}
 CIMGUI_API ImGuiInputTextState* ImGuiInputTextState_ImGuiInputTextState(void)
 {
     return IM_NEW(ImGuiInputTextState)();
@@ -4524,9 +4845,9 @@ CIMGUI_API bool igDataTypeClamp(ImGuiDataType data_type,void* p_data,const void*
 {
     return ImGui::DataTypeClamp(data_type,p_data,p_min,p_max);
 }
-CIMGUI_API bool igInputTextEx(const char* label,const char* hint,char* buf,int buf_size,const ImVec2 size_arg,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data)
+CIMGUI_API bool igInputTextEx(const char* label,const char* hint,char* buf,int buf_size,const ImVec2 size_arg,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data,ImGuiTextEditBuffer* edit_buf)
 {
-    return ImGui::InputTextEx(label,hint,buf,buf_size,size_arg,flags,callback,user_data);
+    return ImGui::InputTextEx(label,hint,buf,buf_size,size_arg,flags,callback,user_data,edit_buf);
 }
 CIMGUI_API bool igTempInputText(const ImRect bb,ImGuiID id,const char* label,char* buf,int buf_size,ImGuiInputTextFlags flags)
 {
@@ -4696,6 +5017,14 @@ CIMGUI_API void igImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[2
 {
     return ImFontAtlasBuildMultiplyRectAlpha8(table,pixels,x,y,w,h,stride);
 }
+CIMGUI_API float igImFontSdfCalcCoverage(float sdf_value,float sdf_spread,float texels_per_pixel)
+{
+    return ImFontSdfCalcCoverage(sdf_value,sdf_spread,texels_per_pixel);
+}
+CIMGUI_API void igImFontBuildAsciiGlyphs(ImFont* font)
+{
+    return ImFontBuildAsciiGlyphs(font);
+}
 
 
 
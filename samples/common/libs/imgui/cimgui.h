@@ -46,13 +46,18 @@ typedef struct ImDrawData ImDrawData;
 typedef struct ImDrawList ImDrawList;
 typedef struct ImDrawListSharedData ImDrawListSharedData;
 typedef struct ImDrawListSplitter ImDrawListSplitter;
+typedef struct ImDrawListCache ImDrawListCache;
+typedef struct ImDrawListCacheSegment ImDrawListCacheSegment;
 typedef struct ImDrawVert ImDrawVert;
+typedef struct ImDrawQuad ImDrawQuad;
 typedef struct ImFont ImFont;
 typedef struct ImFontAtlas ImFontAtlas;
+typedef struct ImFontAtlasDynamicGlyphs ImFontAtlasDynamicGlyphs;
 typedef struct ImFontBuilderIO ImFontBuilderIO;
 typedef struct ImFontConfig ImFontConfig;
 typedef struct ImFontGlyph ImFontGlyph;
 typedef struct ImFontGlyphRangesBuilder ImFontGlyphRangesBuilder;
+typedef struct ImFontTextSizeCache ImFontTextSizeCache;
 typedef struct ImColor ImColor;
 typedef struct ImGuiContext ImGuiContext;
 typedef struct ImGuiIO ImGuiIO;
@@ -68,11 +73,16 @@ typedef struct ImGuiStyle ImGuiStyle;
 typedef struct ImGuiTableSortSpecs ImGuiTableSortSpecs;
 typedef struct ImGuiTableColumnSortSpecs ImGuiTableColumnSortSpecs;
 typedef struct ImGuiTextBuffer ImGuiTextBuffer;
+typedef struct ImGuiTextEditBuffer ImGuiTextEditBuffer;
 typedef struct ImGuiTextFilter ImGuiTextFilter;
+typedef struct ImGuiTextView ImGuiTextView;
 typedef struct ImGuiViewport ImGuiViewport;
 typedef struct ImBitVector ImBitVector;
 typedef struct ImRect ImRect;
 typedef struct ImDrawDataBuilder ImDrawDataBuilder;
+typedef struct ImDrawDataDamageTracker ImDrawDataDamageTracker;
+typedef struct ImDrawListRetainPoint ImDrawListRetainPoint;
+typedef struct ImGuiWindowRetainedDrawList ImGuiWindowRetainedDrawList;
 typedef struct ImGuiColorMod ImGuiColorMod;
 typedef struct ImGuiContextHook ImGuiContextHook;
 typedef struct ImGuiDataTypeInfo ImGuiDataTypeInfo;
@@ -97,6 +107,7 @@ typedef struct ImGuiTableColumn ImGuiTableColumn;
 typedef struct ImGuiTableTempData ImGuiTableTempData;
 typedef struct ImGuiTableSettings ImGuiTableSettings;
 typedef struct ImGuiTableColumnsSettings ImGuiTableColumnsSettings;
+typedef struct ImGuiTextUndoState ImGuiTextUndoState;
 typedef struct ImGuiWindow ImGuiWindow;
 typedef struct ImGuiWindowTempData ImGuiWindowTempData;
 typedef struct ImGuiWindowSettings ImGuiWindowSettings;
@@ -106,13 +117,17 @@ struct ImDrawData;
 struct ImDrawList;
 struct ImDrawListSharedData;
 struct ImDrawListSplitter;
+struct ImDrawListCache;
+struct ImDrawListCacheSegment;
 struct ImDrawVert;
+struct ImDrawQuad;
 struct ImFont;
 struct ImFontAtlas;
 struct ImFontBuilderIO;
 struct ImFontConfig;
 struct ImFontGlyph;
 struct ImFontGlyphRangesBuilder;
+struct ImFontTextSizeCache;
 struct ImColor;
 struct ImGuiContext;
 struct ImGuiIO;
@@ -128,7 +143,9 @@ struct ImGuiStyle;
 struct ImGuiTableSortSpecs;
 struct ImGuiTableColumnSortSpecs;
 struct ImGuiTextBuffer;
+struct ImGuiTextEditBuffer;
 struct ImGuiTextFilter;
+struct ImGuiTextView;
 struct ImGuiViewport;
 typedef int ImGuiCol;
 typedef int ImGuiCond;
@@ -142,6 +159,7 @@ typedef int ImGuiSortDirection;
 typedef int ImGuiStyleVar;
 typedef int ImGuiTableBgTarget;
 typedef int ImDrawFlags;
+typedef int ImDrawIdxFormat;
 typedef int ImDrawListFlags;
 typedef int ImFontAtlasFlags;
 typedef int ImGuiBackendFlags;
@@ -162,6 +180,7 @@ typedef int ImGuiTabItemFlags;
 typedef int ImGuiTableFlags;
 typedef int ImGuiTableColumnFlags;
 typedef int ImGuiTableRowFlags;
+typedef int ImGuiTextViewFlags;
 typedef int ImGuiTreeNodeFlags;
 typedef int ImGuiViewportFlags;
 typedef int ImGuiWindowFlags;
@@ -183,6 +202,7 @@ typedef int (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);
 typedef void* (*ImGuiMemAllocFunc)(size_t sz, void* user_data);
 typedef void (*ImGuiMemFreeFunc)(void* ptr, void* user_data);
+typedef void (*ImFontAtlasParallelForFunc)(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count, void* user_data);
 typedef struct ImVec2 ImVec2;
 struct ImVec2
 {
@@ -215,6 +235,7 @@ typedef enum {
     ImGuiWindowFlags_NoNavInputs = 1 << 18,
     ImGuiWindowFlags_NoNavFocus = 1 << 19,
     ImGuiWindowFlags_UnsavedDocument = 1 << 20,
+    ImGuiWindowFlags_RetainDrawList = 1 << 21,
     ImGuiWindowFlags_NoNav = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -248,6 +269,13 @@ typedef enum {
     ImGuiInputTextFlags_CallbackResize = 1 << 18,
     ImGuiInputTextFlags_CallbackEdit = 1 << 19
 }ImGuiInputTextFlags_;
+typedef enum {
+    ImGuiTextViewFlags_None = 0,
+    ImGuiTextViewFlags_Border = 1 << 0,
+    ImGuiTextViewFlags_WordWrap = 1 << 1,
+    ImGuiTextViewFlags_AutoScroll = 1 << 2,
+    ImGuiTextViewFlags_NoSelection = 1 << 3
+}ImGuiTextViewFlags_;
 typedef enum {
     ImGuiTreeNodeFlags_None = 0,
     ImGuiTreeNodeFlags_Selected = 1 << 0,
@@ -591,7 +619,10 @@ typedef enum {
     ImGuiBackendFlags_HasGamepad = 1 << 0,
     ImGuiBackendFlags_HasMouseCursors = 1 << 1,
     ImGuiBackendFlags_HasSetMousePos = 1 << 2,
-    ImGuiBackendFlags_RendererHasVtxOffset = 1 << 3
+    ImGuiBackendFlags_RendererHasVtxOffset = 1 << 3,
+    ImGuiBackendFlags_RendererHasInstancedQuads = 1 << 4,
+    ImGuiBackendFlags_RendererHasSdfShapes = 1 << 5,
+    ImGuiBackendFlags_RendererHasSdfText = 1 << 6
 }ImGuiBackendFlags_;
 typedef enum {
     ImGuiCol_Text,
@@ -827,10 +858,12 @@ struct ImGuiIO
     bool ConfigMacOSXBehaviors;
     bool ConfigInputTrickleEventQueue;
     bool ConfigInputTextCursorBlink;
+    int ConfigInputTextUndoMemory;
     bool ConfigDragClickToInputText;
     bool ConfigWindowsResizeFromEdges;
     bool ConfigWindowsMoveFromTitleBarOnly;
     float ConfigMemoryCompactTimer;
+    bool ConfigDrawDataDamageRects;
     const char* BackendPlatformName;
     const char* BackendRendererName;
     void* BackendPlatformUserData;
@@ -964,6 +997,38 @@ struct ImGuiTextBuffer
 {
     ImVector_char Buf;
 };
+typedef struct ImVector_int {int Size;int Capacity;int* Data;} ImVector_int;
+
+struct ImGuiTextView
+{
+    const char* Text;
+    int TextSize;
+    ImVector_int LineOffsets;
+    int SelectionStart;
+    int SelectionEnd;
+    int WrapBytesPerFrame;
+    ImFont* MeasureFont;
+    float MeasureFontSize;
+    float ContentWidth;
+    float WrapWidth;
+    ImVector_int WrapRowStarts;
+    int WrapCacheLine;
+    int WrapCacheRow;
+    int WrapCacheOffset;
+    ImVector_int VisibleRows;
+};
+struct ImGuiTextEditBuffer
+{
+    ImVector_ImWchar Buf;
+    int GapBegin;
+    int GapEnd;
+    ImVector_int LineBreaks;
+    int LineGapBegin;
+    int LineGapEnd;
+    int TextSizeA;
+    int UndoMemory;
+    ImVector_char DisplayBuf;
+};
 struct ImGuiStoragePair
 {
         ImGuiID key;
@@ -971,11 +1036,21 @@ struct ImGuiStoragePair
 };
 typedef struct ImGuiStoragePair ImGuiStoragePair;
 
+struct ImGuiStorageSlot
+{
+        ImGuiID key;
+        int idx;
+};
+typedef struct ImGuiStorageSlot ImGuiStorageSlot;
+
 typedef struct ImVector_ImGuiStoragePair {int Size;int Capacity;ImGuiStoragePair* Data;} ImVector_ImGuiStoragePair;
 
+typedef struct ImVector_ImGuiStorageSlot {int Size;int Capacity;ImGuiStorageSlot* Data;} ImVector_ImGuiStorageSlot;
+
 struct ImGuiStorage
 {
     ImVector_ImGuiStoragePair Data;
+    ImVector_ImGuiStorageSlot Index;
 };
 typedef struct ImGuiStoragePair ImGuiStoragePair;
 struct ImGuiListClipper
@@ -999,15 +1074,48 @@ struct ImDrawCmd
     unsigned int VtxOffset;
     unsigned int IdxOffset;
     unsigned int ElemCount;
+    unsigned int QuadOffset;
+    unsigned int QuadCount;
     ImDrawCallback UserCallback;
     void* UserCallbackData;
 };
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#ifndef IM_DRAWVERT_POS_FRAC_BITS
+#define IM_DRAWVERT_POS_FRAC_BITS 3
+#endif
+#define IM_DRAWVERT_POS_SCALE ((float)(1 << IM_DRAWVERT_POS_FRAC_BITS))
+typedef struct ImDrawVertPos ImDrawVertPos;
+struct ImDrawVertPos
+{
+    ImS16 x16, y16;
+};
+typedef struct ImDrawVertUV ImDrawVertUV;
+struct ImDrawVertUV
+{
+    ImU16 u16, v16;
+};
+struct ImDrawVert
+{
+    ImDrawVertPos pos;
+    ImDrawVertUV uv;
+    ImU32 col;
+};
+#else
 struct ImDrawVert
 {
     ImVec2 pos;
     ImVec2 uv;
     ImU32 col;
 };
+#endif
+struct ImDrawQuad
+{
+    ImVec2 Min, Max;
+    ImVec2 UvMin, UvMax;
+    ImU32 Col;
+    float Rounding;
+    ImDrawFlags Flags;
+};
 typedef struct ImDrawCmdHeader ImDrawCmdHeader;
 struct ImDrawCmdHeader
 {
@@ -1053,21 +1161,30 @@ typedef enum {
     ImDrawListFlags_AntiAliasedLines = 1 << 0,
     ImDrawListFlags_AntiAliasedLinesUseTex = 1 << 1,
     ImDrawListFlags_AntiAliasedFill = 1 << 2,
-    ImDrawListFlags_AllowVtxOffset = 1 << 3
+    ImDrawListFlags_AllowVtxOffset = 1 << 3,
+    ImDrawListFlags_Fingerprint = 1 << 4,
+    ImDrawListFlags_FingerprintOnly = 1 << 5,
+    ImDrawListFlags_InstancedQuads = 1 << 6,
+    ImDrawListFlags_SdfShapes = 1 << 7
 }ImDrawListFlags_;
 typedef struct ImVector_ImDrawVert {int Size;int Capacity;ImDrawVert* Data;} ImVector_ImDrawVert;
 
+typedef struct ImVector_ImDrawQuad {int Size;int Capacity;ImDrawQuad* Data;} ImVector_ImDrawQuad;
+
 typedef struct ImVector_ImVec4 {int Size;int Capacity;ImVec4* Data;} ImVector_ImVec4;
 
 typedef struct ImVector_ImTextureID {int Size;int Capacity;ImTextureID* Data;} ImVector_ImTextureID;
 
 typedef struct ImVector_ImVec2 {int Size;int Capacity;ImVec2* Data;} ImVector_ImVec2;
 
+typedef struct ImVector_const_ImDrawListPtr {int Size;int Capacity;const ImDrawList** Data;} ImVector_const_ImDrawListPtr;
+
 struct ImDrawList
 {
     ImVector_ImDrawCmd CmdBuffer;
     ImVector_ImDrawIdx IdxBuffer;
     ImVector_ImDrawVert VtxBuffer;
+    ImVector_ImDrawQuad QuadBuffer;
     ImDrawListFlags Flags;
     unsigned int _VtxCurrentIdx;
     const ImDrawListSharedData* _Data;
@@ -1080,17 +1197,53 @@ struct ImDrawList
     ImDrawCmdHeader _CmdHeader;
     ImDrawListSplitter _Splitter;
     float _FringeScale;
+    ImU32 _Fingerprint;
+    struct ImGuiWindowRetainedDrawList* _Retained;
+    ImVector_const_ImDrawListPtr _DeferredDrawLists;
+};
+struct ImDrawListCacheSegment
+{
+    ImTextureID TextureId;
+    bool UseCurrentTexture;
+    int VtxOffset;
+    int VtxCount;
+    int IdxOffset;
+    int IdxCount;
+};
+typedef struct ImVector_ImDrawListCacheSegment {int Size;int Capacity;ImDrawListCacheSegment* Data;} ImVector_ImDrawListCacheSegment;
+
+struct ImDrawListCache
+{
+    ImVector_ImDrawVert VtxBuffer;
+    ImVector_ImDrawIdx IdxBuffer;
+    ImVector_ImDrawListCacheSegment Segments;
+    ImVec2 BoundsMin;
+    ImVec2 BoundsMax;
+    ImFontAtlas* FontAtlas;
+    int FontAtlasTexGeneration;
+    ImDrawList* _RecordDrawList;
+    int _RecordVtxStart;
+    int _RecordIdxStart;
+    ImTextureID _RecordTextureId;
+    ImDrawListFlags _RecordDrawListFlags;
 };
+typedef enum {
+    ImDrawIdxFormat_Native = 0,
+    ImDrawIdxFormat_U32 = 1
+}ImDrawIdxFormat_;
 struct ImDrawData
 {
     bool Valid;
     int CmdListsCount;
     int TotalIdxCount;
     int TotalVtxCount;
+    int TotalQuadCount;
     ImDrawList** CmdLists;
     ImVec2 DisplayPos;
     ImVec2 DisplaySize;
     ImVec2 FramebufferScale;
+    int DamageRectsCount;
+    ImVec4* DamageRects;
 };
 struct ImFontConfig
 {
@@ -1111,6 +1264,7 @@ struct ImFontConfig
     unsigned int FontBuilderFlags;
     float RasterizerMultiply;
     ImWchar EllipsisChar;
+    bool SignedDistanceField;
     char Name[40];
     ImFont* DstFont;
 };
@@ -1139,14 +1293,23 @@ struct ImFontAtlasCustomRect
     ImVec2 GlyphOffset;
     ImFont* Font;
 };
+typedef struct ImFontAtlasDirtyRect ImFontAtlasDirtyRect;
+struct ImFontAtlasDirtyRect
+{
+    unsigned short X, Y;
+    unsigned short Width, Height;
+};
 typedef enum {
     ImFontAtlasFlags_None = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,
     ImFontAtlasFlags_NoMouseCursors = 1 << 1,
-    ImFontAtlasFlags_NoBakedLines = 1 << 2
+    ImFontAtlasFlags_NoBakedLines = 1 << 2,
+    ImFontAtlasFlags_DynamicGlyphs = 1 << 3
 }ImFontAtlasFlags_;
 typedef struct ImVector_ImFontPtr {int Size;int Capacity;ImFont** Data;} ImVector_ImFontPtr;
 
+typedef struct ImVector_ImFontAtlasDirtyRect {int Size;int Capacity;ImFontAtlasDirtyRect* Data;} ImVector_ImFontAtlasDirtyRect;
+
 typedef struct ImVector_ImFontAtlasCustomRect {int Size;int Capacity;ImFontAtlasCustomRect* Data;} ImVector_ImFontAtlasCustomRect;
 
 typedef struct ImVector_ImFontConfig {int Size;int Capacity;ImFontConfig* Data;} ImVector_ImFontConfig;
@@ -1157,7 +1320,13 @@ struct ImFontAtlas
     ImTextureID TexID;
     int TexDesiredWidth;
     int TexGlyphPadding;
+    int TexDynamicHeight;
+    int TexSdfSpread;
+    ImFontAtlasParallelForFunc BuildParallelFor;
+    void* BuildParallelForUserData;
     bool Locked;
+    ImVector_ImFontAtlasDirtyRect TexDirtyRects;
+    int TexGeneration;
     bool TexReady;
     bool TexPixelsUseColors;
     unsigned char* TexPixelsAlpha8;
@@ -1166,6 +1335,7 @@ struct ImFontAtlas
     int TexHeight;
     ImVec2 TexUvScale;
     ImVec2 TexUvWhitePixel;
+    float TexUvSdfMinV;
     ImVector_ImFontPtr Fonts;
     ImVector_ImFontAtlasCustomRect CustomRects;
     ImVector_ImFontConfig ConfigData;
@@ -1174,19 +1344,50 @@ struct ImFontAtlas
     unsigned int FontBuilderFlags;
     int PackIdMouseCursors;
     int PackIdLines;
+    ImFontAtlasDynamicGlyphs* DynamicGlyphs;
 };
 typedef struct ImVector_float {int Size;int Capacity;float* Data;} ImVector_float;
+typedef struct ImVector_ImU16 {int Size;int Capacity;ImU16* Data;} ImVector_ImU16;
 
 typedef struct ImVector_ImFontGlyph {int Size;int Capacity;ImFontGlyph* Data;} ImVector_ImFontGlyph;
 
+typedef struct ImFontTextSizeCacheEntry ImFontTextSizeCacheEntry;
+struct ImFontTextSizeCacheEntry
+{
+    ImGuiID Key;
+    int TextOffset;
+    int TextLen;
+    float FontSize;
+    float WrapWidth;
+    int LastUsedFrame;
+    ImVec2 Size;
+};
+typedef struct ImVector_ImFontTextSizeCacheEntry {int Size;int Capacity;ImFontTextSizeCacheEntry* Data;} ImVector_ImFontTextSizeCacheEntry;
+
+struct ImFontTextSizeCache
+{
+    bool Enabled;
+    int MaxAge;
+    int MinTextLen;
+    int Hits;
+    int Misses;
+    int Frame;
+    int LastSweepFrame;
+    int SweepSize;
+    ImVector_ImFontTextSizeCacheEntry Entries;
+    ImVector_char TextBuffer;
+    ImGuiStorage Map;
+};
 struct ImFont
 {
     ImVector_float IndexAdvanceX;
+    ImVector_ImU16 IndexPages;
     float FallbackAdvanceX;
     float FontSize;
     ImVector_ImWchar IndexLookup;
     ImVector_ImFontGlyph Glyphs;
     const ImFontGlyph* FallbackGlyph;
+    const ImFontGlyph* AsciiGlyphs[128];
     ImFontAtlas* ContainerAtlas;
     const ImFontConfig* ConfigData;
     short ConfigDataCount;
@@ -1197,7 +1398,9 @@ struct ImFont
     float Scale;
     float Ascent, Descent;
     int MetricsTotalSurface;
+    int DynamicGlyphsOffset;
     ImU8 Used4kPagesMap[(0xFFFF +1)/4096/8];
+    ImFontTextSizeCache TextSizeCache;
 };
 typedef enum {
     ImGuiViewportFlags_None = 0,
@@ -1223,6 +1426,9 @@ struct ImGuiPlatformImeData
 struct ImBitVector;
 struct ImRect;
 struct ImDrawDataBuilder;
+struct ImDrawDataDamageTracker;
+struct ImDrawListRetainPoint;
+struct ImGuiWindowRetainedDrawList;
 struct ImDrawListSharedData;
 struct ImGuiColorMod;
 struct ImGuiContext;
@@ -1249,6 +1455,7 @@ struct ImGuiTableColumn;
 struct ImGuiTableTempData;
 struct ImGuiTableSettings;
 struct ImGuiTableColumnsSettings;
+struct ImGuiTextUndoState;
 struct ImGuiWindow;
 struct ImGuiWindowTempData;
 struct ImGuiWindowSettings;
@@ -1268,6 +1475,29 @@ typedef int ImGuiTextFlags;
 typedef int ImGuiTooltipFlags;
 typedef void (*ImGuiErrorLogCallback)(void* user_data, const char* fmt, ...);
 extern ImGuiContext* GImGui;
+typedef struct ImGuiTextUndoRecord ImGuiTextUndoRecord;
+struct ImGuiTextUndoRecord
+{
+    int Where;
+    int InsertLen;
+    int DeleteLen;
+};
+typedef struct ImVector_ImGuiTextUndoRecord {int Size;int Capacity;ImGuiTextUndoRecord* Data;} ImVector_ImGuiTextUndoRecord;
+
+typedef struct ImGuiTextUndoStack ImGuiTextUndoStack;
+struct ImGuiTextUndoStack
+{
+    ImVector_ImGuiTextUndoRecord Records;
+    ImVector_ImWchar Chars;
+    int RecordsBegin;
+    int CharsBegin;
+};
+struct ImGuiTextUndoState
+{
+    ImGuiTextUndoStack UndoStack;
+    ImGuiTextUndoStack RedoStack;
+    int MemoryBudget;
+};
 typedef struct StbUndoRecord StbUndoRecord;
 struct StbUndoRecord
 {
@@ -1298,7 +1528,7 @@ struct STB_TexteditState
    unsigned char single_line;
    unsigned char padding1, padding2, padding3;
    float preferred_x;
-   StbUndoState undostate;
+   ImGuiTextUndoState undostate;
 };
 typedef struct StbTexteditRow StbTexteditRow;
 struct StbTexteditRow
@@ -1349,6 +1579,46 @@ struct ImDrawDataBuilder
 {
     ImVector_ImDrawListPtr Layers[2];
 };
+struct ImDrawDataDamageTracker
+{
+    ImVector_ImU32 TileHashes;
+    ImVector_ImU32 TileHashesPrev;
+    ImVector_ImVec4 Rects;
+    int TilesX, TilesY;
+    int FrameCount;
+    ImVec2 DisplayPos;
+    ImVec2 DisplaySize;
+    ImVec2 FramebufferScale;
+};
+struct ImDrawListRetainPoint
+{
+    ImU32 Fingerprint;
+    int CmdCount;
+    int IdxCount;
+    int VtxCount;
+    int QuadCount;
+    ImDrawCmd LastCmd;
+};
+typedef struct ImVector_ImDrawListRetainPoint {int Size;int Capacity;ImDrawListRetainPoint* Data;} ImVector_ImDrawListRetainPoint;
+
+struct ImGuiWindowRetainedDrawList
+{
+    ImVector_ImDrawCmd CmdBuffer;
+    ImVector_ImDrawIdx IdxBuffer;
+    ImVector_ImDrawVert VtxBuffer;
+    ImVector_ImDrawQuad QuadBuffer;
+    ImVector_ImDrawListRetainPoint Points;
+    ImVector_ImDrawListRetainPoint PointsNext;
+    ImU32 Fingerprint;
+    int PointsMatched;
+    int ResumePoint;
+    bool PointsStopped;
+    bool Valid;
+    bool Stable;
+    bool FingerprintOnly;
+    int HitCount;
+    int MissCount;
+};
 typedef enum {
     ImGuiItemFlags_None = 0,
     ImGuiItemFlags_NoTabStop = 1 << 0,
@@ -1525,6 +1795,7 @@ struct ImGuiInputTextState
     ImVector_ImWchar TextW;
     ImVector_char TextA;
     ImVector_char InitialTextA;
+    ImGuiTextEditBuffer* EditBuffer;
     bool TextAIsValid;
     int BufCapacityA;
     float ScrollX;
@@ -1830,6 +2101,7 @@ struct ImGuiViewportP
     ImDrawList* DrawLists[2];
     ImDrawData DrawDataP;
     ImDrawDataBuilder DrawDataBuilder;
+    ImDrawDataDamageTracker DrawDataDamage;
     ImVec2 WorkOffsetMin;
     ImVec2 WorkOffsetMax;
     ImVec2 BuildWorkOffsetMin;
@@ -2149,6 +2421,8 @@ struct ImGuiContext
     ImGuiID DebugItemPickerBreakId;
     ImGuiMetricsConfig DebugMetricsConfig;
     ImGuiStackTool DebugStackTool;
+    int DebugRetainedDrawListHits;
+    int DebugRetainedDrawListMisses;
     float FramerateSecPerFrame[120];
     int FramerateSecPerFrameIdx;
     int FramerateSecPerFrameCount;
@@ -2271,6 +2545,7 @@ struct ImGuiWindow
     int SettingsOffset;
     ImDrawList* DrawList;
     ImDrawList DrawListInst;
+    ImGuiWindowRetainedDrawList RetainedDrawList;
     ImGuiWindow* ParentWindow;
     ImGuiWindow* ParentWindowInBeginStack;
     ImGuiWindow* RootWindow;
@@ -2558,6 +2833,7 @@ typedef union SDL_Event SDL_Event;
 
 #ifndef CIMGUI_DEFINE_ENUMS_AND_STRUCTS
 typedef struct ImGuiStorage::ImGuiStoragePair ImGuiStoragePair;
+typedef struct ImGuiStorage::ImGuiStorageSlot ImGuiStorageSlot;
 typedef struct ImGuiTextFilter::ImGuiTextRange ImGuiTextRange;
 typedef ImStb::STB_TexteditState STB_TexteditState;
 typedef ImStb::StbTexteditRow StbTexteditRow;
@@ -2573,12 +2849,18 @@ typedef ImSpan<ImGuiTableColumnIdx> ImSpan_ImGuiTableColumnIdx;
 typedef ImVector<ImDrawChannel> ImVector_ImDrawChannel;
 typedef ImVector<ImDrawCmd> ImVector_ImDrawCmd;
 typedef ImVector<ImDrawIdx> ImVector_ImDrawIdx;
+typedef ImVector<const ImDrawList*> ImVector_const_ImDrawListPtr;
 typedef ImVector<ImDrawList*> ImVector_ImDrawListPtr;
+typedef ImVector<ImDrawListCacheSegment> ImVector_ImDrawListCacheSegment;
+typedef ImVector<ImDrawListRetainPoint> ImVector_ImDrawListRetainPoint;
 typedef ImVector<ImDrawVert> ImVector_ImDrawVert;
+typedef ImVector<ImDrawQuad> ImVector_ImDrawQuad;
 typedef ImVector<ImFont*> ImVector_ImFontPtr;
 typedef ImVector<ImFontAtlasCustomRect> ImVector_ImFontAtlasCustomRect;
+typedef ImVector<ImFontAtlasDirtyRect> ImVector_ImFontAtlasDirtyRect;
 typedef ImVector<ImFontConfig> ImVector_ImFontConfig;
 typedef ImVector<ImFontGlyph> ImVector_ImFontGlyph;
+typedef ImVector<ImFontTextSizeCacheEntry> ImVector_ImFontTextSizeCacheEntry;
 typedef ImVector<ImGuiColorMod> ImVector_ImGuiColorMod;
 typedef ImVector<ImGuiContextHook> ImVector_ImGuiContextHook;
 typedef ImVector<ImGuiGroupData> ImVector_ImGuiGroupData;
@@ -2595,21 +2877,25 @@ typedef ImVector<ImGuiSettingsHandler> ImVector_ImGuiSettingsHandler;
 typedef ImVector<ImGuiShrinkWidthItem> ImVector_ImGuiShrinkWidthItem;
 typedef ImVector<ImGuiStackLevelInfo> ImVector_ImGuiStackLevelInfo;
 typedef ImVector<ImGuiStoragePair> ImVector_ImGuiStoragePair;
+typedef ImVector<ImGuiStorageSlot> ImVector_ImGuiStorageSlot;
 typedef ImVector<ImGuiStyleMod> ImVector_ImGuiStyleMod;
 typedef ImVector<ImGuiTabItem> ImVector_ImGuiTabItem;
 typedef ImVector<ImGuiTableColumnSortSpecs> ImVector_ImGuiTableColumnSortSpecs;
 typedef ImVector<ImGuiTableTempData> ImVector_ImGuiTableTempData;
 typedef ImVector<ImGuiTextRange> ImVector_ImGuiTextRange;
+typedef ImVector<ImGuiTextUndoRecord> ImVector_ImGuiTextUndoRecord;
 typedef ImVector<ImGuiViewportP*> ImVector_ImGuiViewportPPtr;
 typedef ImVector<ImGuiWindow*> ImVector_ImGuiWindowPtr;
 typedef ImVector<ImGuiWindowStackData> ImVector_ImGuiWindowStackData;
 typedef ImVector<ImTextureID> ImVector_ImTextureID;
+typedef ImVector<ImU16> ImVector_ImU16;
 typedef ImVector<ImU32> ImVector_ImU32;
 typedef ImVector<ImVec2> ImVector_ImVec2;
 typedef ImVector<ImVec4> ImVector_ImVec4;
 typedef ImVector<ImWchar> ImVector_ImWchar;
 typedef ImVector<char> ImVector_char;
 typedef ImVector<float> ImVector_float;
+typedef ImVector<int> ImVector_int;
 typedef ImVector<unsigned char> ImVector_unsigned_char;
 #endif //CIMGUI_DEFINE_ENUMS_AND_STRUCTS
 CIMGUI_API ImVec2* ImVec2_ImVec2_Nil(void);
@@ -2753,6 +3039,7 @@ CIMGUI_API void igLabelText(const char* label,const char* fmt,...);
 CIMGUI_API void igLabelTextV(const char* label,const char* fmt,va_list args);
 CIMGUI_API void igBulletText(const char* fmt,...);
 CIMGUI_API void igBulletTextV(const char* fmt,va_list args);
+CIMGUI_API void igTextView(const char* str_id,ImGuiTextView* view,const ImVec2 size,ImGuiTextViewFlags flags);
 CIMGUI_API bool igButton(const char* label,const ImVec2 size);
 CIMGUI_API bool igSmallButton(const char* label);
 CIMGUI_API bool igInvisibleButton(const char* str_id,const ImVec2 size,ImGuiButtonFlags flags);
@@ -2799,6 +3086,7 @@ CIMGUI_API bool igVSliderInt(const char* label,const ImVec2 size,int* v,int v_mi
 CIMGUI_API bool igVSliderScalar(const char* label,const ImVec2 size,ImGuiDataType data_type,void* p_data,const void* p_min,const void* p_max,const char* format,ImGuiSliderFlags flags);
 CIMGUI_API bool igInputText(const char* label,char* buf,size_t buf_size,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data);
 CIMGUI_API bool igInputTextMultiline(const char* label,char* buf,size_t buf_size,const ImVec2 size,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data);
+CIMGUI_API bool igInputTextMultiline_TextEditBufferPtr(const char* label,ImGuiTextEditBuffer* buffer,const ImVec2 size,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data);
 CIMGUI_API bool igInputTextWithHint(const char* label,const char* hint,char* buf,size_t buf_size,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data);
 CIMGUI_API bool igInputFloat(const char* label,float* v,float step,float step_fast,const char* format,ImGuiInputTextFlags flags);
 CIMGUI_API bool igInputFloat2(const char* label,float v[2],const char* format,ImGuiInputTextFlags flags);
@@ -2985,6 +3273,7 @@ CIMGUI_API void igLoadIniSettingsFromMemory(const char* ini_data,size_t ini_size
 CIMGUI_API void igSaveIniSettingsToDisk(const char* ini_filename);
 CIMGUI_API const char* igSaveIniSettingsToMemory(size_t* out_ini_size);
 CIMGUI_API bool igDebugCheckVersionAndDataLayout(const char* version_str,size_t sz_io,size_t sz_style,size_t sz_vec2,size_t sz_vec4,size_t sz_drawvert,size_t sz_drawidx);
+CIMGUI_API bool igDebugCheckCimguiDataLayout(size_t sz_window,size_t sz_window_retained,size_t sz_drawlist,size_t sz_drawlistcache,size_t sz_drawdata,size_t sz_fontatlas,size_t sz_font);
 CIMGUI_API void igSetAllocatorFunctions(ImGuiMemAllocFunc alloc_func,ImGuiMemFreeFunc free_func,void* user_data);
 CIMGUI_API void igGetAllocatorFunctions(ImGuiMemAllocFunc* p_alloc_func,ImGuiMemFreeFunc* p_free_func,void** p_user_data);
 CIMGUI_API void* igMemAlloc(size_t size);
@@ -3048,6 +3337,32 @@ CIMGUI_API void ImGuiTextBuffer_reserve(ImGuiTextBuffer* self,int capacity);
 CIMGUI_API const char* ImGuiTextBuffer_c_str(ImGuiTextBuffer* self);
 CIMGUI_API void ImGuiTextBuffer_append(ImGuiTextBuffer* self,const char* str,const char* str_end);
 CIMGUI_API void ImGuiTextBuffer_appendfv(ImGuiTextBuffer* self,const char* fmt,va_list args);
+CIMGUI_API ImGuiTextView* ImGuiTextView_ImGuiTextView(void);
+CIMGUI_API void ImGuiTextView_destroy(ImGuiTextView* self);
+CIMGUI_API void ImGuiTextView_Clear(ImGuiTextView* self);
+CIMGUI_API void ImGuiTextView_SetText(ImGuiTextView* self,const char* text,int text_size);
+CIMGUI_API int ImGuiTextView_GetLineCount(ImGuiTextView* self);
+CIMGUI_API const char* ImGuiTextView_GetLineBegin(ImGuiTextView* self,int n);
+CIMGUI_API const char* ImGuiTextView_GetLineEnd(ImGuiTextView* self,int n);
+CIMGUI_API bool ImGuiTextView_HasSelection(ImGuiTextView* self);
+CIMGUI_API void ImGuiTextView_ClearSelection(ImGuiTextView* self);
+CIMGUI_API void ImGuiTextView_SelectAll(ImGuiTextView* self);
+CIMGUI_API ImGuiTextEditBuffer* ImGuiTextEditBuffer_ImGuiTextEditBuffer(void);
+CIMGUI_API void ImGuiTextEditBuffer_destroy(ImGuiTextEditBuffer* self);
+CIMGUI_API void ImGuiTextEditBuffer_Clear(ImGuiTextEditBuffer* self);
+CIMGUI_API void ImGuiTextEditBuffer_SetText(ImGuiTextEditBuffer* self,const char* text,const char* text_end);
+CIMGUI_API int ImGuiTextEditBuffer_GetText(ImGuiTextEditBuffer* self,char* buf,int buf_size,int pos_begin,int pos_end);
+CIMGUI_API int ImGuiTextEditBuffer_GetTextSizeA(ImGuiTextEditBuffer* self,int pos_begin,int pos_end);
+CIMGUI_API int ImGuiTextEditBuffer_GetLength(ImGuiTextEditBuffer* self);
+CIMGUI_API ImWchar ImGuiTextEditBuffer_GetChar(ImGuiTextEditBuffer* self,int pos);
+CIMGUI_API int ImGuiTextEditBuffer_GetLineCount(ImGuiTextEditBuffer* self);
+CIMGUI_API int ImGuiTextEditBuffer_GetLineStart(ImGuiTextEditBuffer* self,int line);
+CIMGUI_API int ImGuiTextEditBuffer_GetLineBreak(ImGuiTextEditBuffer* self,int n);
+CIMGUI_API int ImGuiTextEditBuffer_GetLineFromPos(ImGuiTextEditBuffer* self,int pos);
+CIMGUI_API void ImGuiTextEditBuffer_Insert_WcharPtr(ImGuiTextEditBuffer* self,int pos,const ImWchar* text,int text_len);
+CIMGUI_API void ImGuiTextEditBuffer_Insert_Str(ImGuiTextEditBuffer* self,int pos,const char* text,const char* text_end);
+CIMGUI_API void ImGuiTextEditBuffer_Delete(ImGuiTextEditBuffer* self,int pos,int count);
+CIMGUI_API void ImGuiTextEditBuffer_MoveGap(ImGuiTextEditBuffer* self,int pos,int min_gap_size);
 CIMGUI_API ImGuiStoragePair* ImGuiStoragePair_ImGuiStoragePair_Int(ImGuiID _key,int _val_i);
 CIMGUI_API void ImGuiStoragePair_destroy(ImGuiStoragePair* self);
 CIMGUI_API ImGuiStoragePair* ImGuiStoragePair_ImGuiStoragePair_Float(ImGuiID _key,float _val_f);
@@ -3118,6 +3433,11 @@ CIMGUI_API void ImDrawList_AddPolyline(ImDrawList* self,const ImVec2* points,int
 CIMGUI_API void ImDrawList_AddConvexPolyFilled(ImDrawList* self,const ImVec2* points,int num_points,ImU32 col);
 CIMGUI_API void ImDrawList_AddBezierCubic(ImDrawList* self,const ImVec2 p1,const ImVec2 p2,const ImVec2 p3,const ImVec2 p4,ImU32 col,float thickness,int num_segments);
 CIMGUI_API void ImDrawList_AddBezierQuadratic(ImDrawList* self,const ImVec2 p1,const ImVec2 p2,const ImVec2 p3,ImU32 col,float thickness,int num_segments);
+CIMGUI_API void ImDrawList_AddLineBatch(ImDrawList* self,const ImVec2* p1,const ImVec2* p2,const ImU32* cols,int count,float thickness);
+CIMGUI_API void ImDrawList_AddRectFilledBatch(ImDrawList* self,const ImVec2* p_min,const ImVec2* p_max,const ImU32* cols,int count);
+CIMGUI_API void ImDrawList_AddQuadFilledBatch(ImDrawList* self,const ImVec2* points,const ImU32* cols,int count);
+CIMGUI_API void ImDrawList_AddCircleFilledBatch(ImDrawList* self,const ImVec2* centers,const float* radii,const ImU32* cols,int count,int num_segments);
+CIMGUI_API void ImDrawList_AddDrawListCache(ImDrawList* self,const ImDrawListCache* cache,const ImVec2 offset,float scale,ImU32 tint_col);
 CIMGUI_API void ImDrawList_AddImage(ImDrawList* self,ImTextureID user_texture_id,const ImVec2 p_min,const ImVec2 p_max,const ImVec2 uv_min,const ImVec2 uv_max,ImU32 col);
 CIMGUI_API void ImDrawList_AddImageQuad(ImDrawList* self,ImTextureID user_texture_id,const ImVec2 p1,const ImVec2 p2,const ImVec2 p3,const ImVec2 p4,const ImVec2 uv1,const ImVec2 uv2,const ImVec2 uv3,const ImVec2 uv4,ImU32 col);
 CIMGUI_API void ImDrawList_AddImageRounded(ImDrawList* self,ImTextureID user_texture_id,const ImVec2 p_min,const ImVec2 p_max,const ImVec2 uv_min,const ImVec2 uv_max,ImU32 col,float rounding,ImDrawFlags flags);
@@ -3134,6 +3454,10 @@ CIMGUI_API void ImDrawList_PathRect(ImDrawList* self,const ImVec2 rect_min,const
 CIMGUI_API void ImDrawList_AddCallback(ImDrawList* self,ImDrawCallback callback,void* callback_data);
 CIMGUI_API void ImDrawList_AddDrawCmd(ImDrawList* self);
 CIMGUI_API ImDrawList* ImDrawList_CloneOutput(ImDrawList* self);
+CIMGUI_API void ImDrawList_ExpandInstancedQuads(ImDrawList* self);
+CIMGUI_API void ImDrawList_ResetForNewFrame(ImDrawList* self);
+CIMGUI_API void ImDrawList_AddDrawListDeferred(ImDrawList* self,const ImDrawList* draw_list);
+CIMGUI_API void ImDrawList_ResolveDeferredDrawLists(ImDrawList* self);
 CIMGUI_API void ImDrawList_ChannelsSplit(ImDrawList* self,int count);
 CIMGUI_API void ImDrawList_ChannelsMerge(ImDrawList* self);
 CIMGUI_API void ImDrawList_ChannelsSetCurrent(ImDrawList* self,int n);
@@ -3145,6 +3469,9 @@ CIMGUI_API void ImDrawList_PrimQuadUV(ImDrawList* self,const ImVec2 a,const ImVe
 CIMGUI_API void ImDrawList_PrimWriteVtx(ImDrawList* self,const ImVec2 pos,const ImVec2 uv,ImU32 col);
 CIMGUI_API void ImDrawList_PrimWriteIdx(ImDrawList* self,ImDrawIdx idx);
 CIMGUI_API void ImDrawList_PrimVtx(ImDrawList* self,const ImVec2 pos,const ImVec2 uv,ImU32 col);
+CIMGUI_API ImDrawQuad* ImDrawList_PrimReserveQuads(ImDrawList* self,int quad_count);
+CIMGUI_API void ImDrawList_PrimUnreserveQuads(ImDrawList* self,int quad_count);
+CIMGUI_API void ImDrawList_PrimRectInstanced(ImDrawList* self,const ImVec2 a,const ImVec2 b,const ImVec2 uv_a,const ImVec2 uv_b,ImU32 col,float rounding,ImDrawFlags flags);
 CIMGUI_API void ImDrawList__ResetForNewFrame(ImDrawList* self);
 CIMGUI_API void ImDrawList__ClearFreeMemory(ImDrawList* self);
 CIMGUI_API void ImDrawList__PopUnusedDrawCmd(ImDrawList* self);
@@ -3152,14 +3479,24 @@ CIMGUI_API void ImDrawList__TryMergeDrawCmds(ImDrawList* self);
 CIMGUI_API void ImDrawList__OnChangedClipRect(ImDrawList* self);
 CIMGUI_API void ImDrawList__OnChangedTextureID(ImDrawList* self);
 CIMGUI_API void ImDrawList__OnChangedVtxOffset(ImDrawList* self);
+CIMGUI_API void ImDrawList__OnChangedCmdBuffer(ImDrawList* self);
 CIMGUI_API int ImDrawList__CalcCircleAutoSegmentCount(ImDrawList* self,float radius);
 CIMGUI_API void ImDrawList__PathArcToFastEx(ImDrawList* self,const ImVec2 center,float radius,int a_min_sample,int a_max_sample,int a_step);
 CIMGUI_API void ImDrawList__PathArcToN(ImDrawList* self,const ImVec2 center,float radius,float a_min,float a_max,int num_segments);
+CIMGUI_API ImDrawListCache* ImDrawListCache_ImDrawListCache(void);
+CIMGUI_API void ImDrawListCache_destroy(ImDrawListCache* self);
+CIMGUI_API void ImDrawListCache_Clear(ImDrawListCache* self);
+CIMGUI_API bool ImDrawListCache_IsEmpty(ImDrawListCache* self);
+CIMGUI_API bool ImDrawListCache_IsStale(ImDrawListCache* self);
+CIMGUI_API void ImDrawListCache_BeginRecord(ImDrawListCache* self,ImDrawList* draw_list);
+CIMGUI_API void ImDrawListCache_EndRecord(ImDrawListCache* self);
 CIMGUI_API ImDrawData* ImDrawData_ImDrawData(void);
 CIMGUI_API void ImDrawData_destroy(ImDrawData* self);
 CIMGUI_API void ImDrawData_Clear(ImDrawData* self);
 CIMGUI_API void ImDrawData_DeIndexAllBuffers(ImDrawData* self);
 CIMGUI_API void ImDrawData_ScaleClipRects(ImDrawData* self,const ImVec2 fb_scale);
+CIMGUI_API int ImDrawData_Optimize(ImDrawData* self);
+CIMGUI_API void ImDrawData_CopyToBuffers(ImDrawData* self,void* vtx_dst,void* idx_dst,ImDrawIdxFormat fmt,int cmd_lists_begin,int cmd_lists_end);
 CIMGUI_API ImFontConfig* ImFontConfig_ImFontConfig(void);
 CIMGUI_API void ImFontConfig_destroy(ImFontConfig* self);
 CIMGUI_API ImFontGlyphRangesBuilder* ImFontGlyphRangesBuilder_ImFontGlyphRangesBuilder(void);
@@ -3185,12 +3522,16 @@ CIMGUI_API ImFont* ImFontAtlas_AddFontFromMemoryCompressedBase85TTF(ImFontAtlas*
 CIMGUI_API void ImFontAtlas_ClearInputData(ImFontAtlas* self);
 CIMGUI_API void ImFontAtlas_ClearTexData(ImFontAtlas* self);
 CIMGUI_API void ImFontAtlas_ClearFonts(ImFontAtlas* self);
+CIMGUI_API void ImFontAtlas_ClearTexDirtyRects(ImFontAtlas* self);
 CIMGUI_API void ImFontAtlas_Clear(ImFontAtlas* self);
 CIMGUI_API bool ImFontAtlas_Build(ImFontAtlas* self);
 CIMGUI_API void ImFontAtlas_GetTexDataAsAlpha8(ImFontAtlas* self,unsigned char** out_pixels,int* out_width,int* out_height,int* out_bytes_per_pixel);
 CIMGUI_API void ImFontAtlas_GetTexDataAsRGBA32(ImFontAtlas* self,unsigned char** out_pixels,int* out_width,int* out_height,int* out_bytes_per_pixel);
 CIMGUI_API bool ImFontAtlas_IsBuilt(ImFontAtlas* self);
 CIMGUI_API void ImFontAtlas_SetTexID(ImFontAtlas* self,ImTextureID id);
+CIMGUI_API bool ImFontAtlas_SaveBakedCache(ImFontAtlas* self,const char* filename);
+CIMGUI_API bool ImFontAtlas_LoadBakedCache(ImFontAtlas* self,const char* filename);
+CIMGUI_API bool ImFontAtlas_LoadBakedCacheFromMemory(ImFontAtlas* self,const void* data,size_t data_size);
 CIMGUI_API const ImWchar* ImFontAtlas_GetGlyphRangesDefault(ImFontAtlas* self);
 CIMGUI_API const ImWchar* ImFontAtlas_GetGlyphRangesKorean(ImFontAtlas* self);
 CIMGUI_API const ImWchar* ImFontAtlas_GetGlyphRangesJapanese(ImFontAtlas* self);
@@ -3204,20 +3545,28 @@ CIMGUI_API int ImFontAtlas_AddCustomRectFontGlyph(ImFontAtlas* self,ImFont* font
 CIMGUI_API ImFontAtlasCustomRect* ImFontAtlas_GetCustomRectByIndex(ImFontAtlas* self,int index);
 CIMGUI_API void ImFontAtlas_CalcCustomRectUV(ImFontAtlas* self,const ImFontAtlasCustomRect* rect,ImVec2* out_uv_min,ImVec2* out_uv_max);
 CIMGUI_API bool ImFontAtlas_GetMouseCursorTexData(ImFontAtlas* self,ImGuiMouseCursor cursor,ImVec2* out_offset,ImVec2* out_size,ImVec2 out_uv_border[2],ImVec2 out_uv_fill[2]);
+CIMGUI_API ImFontTextSizeCache* ImFontTextSizeCache_ImFontTextSizeCache(void);
+CIMGUI_API void ImFontTextSizeCache_destroy(ImFontTextSizeCache* self);
+CIMGUI_API void ImFontTextSizeCache_Clear(ImFontTextSizeCache* self);
+CIMGUI_API void ImFontTextSizeCache_ClearStats(ImFontTextSizeCache* self);
+CIMGUI_API float ImFontTextSizeCache_GetHitRate(ImFontTextSizeCache* self);
 CIMGUI_API ImFont* ImFont_ImFont(void);
 CIMGUI_API void ImFont_destroy(ImFont* self);
 CIMGUI_API const ImFontGlyph* ImFont_FindGlyph(ImFont* self,ImWchar c);
 CIMGUI_API const ImFontGlyph* ImFont_FindGlyphNoFallback(ImFont* self,ImWchar c);
+CIMGUI_API int ImFont_GetIndexOffset(ImFont* self,unsigned int c);
 CIMGUI_API float ImFont_GetCharAdvance(ImFont* self,ImWchar c);
 CIMGUI_API bool ImFont_IsLoaded(ImFont* self);
 CIMGUI_API const char* ImFont_GetDebugName(ImFont* self);
 CIMGUI_API void ImFont_CalcTextSizeA(ImVec2 *pOut,ImFont* self,float size,float max_width,float wrap_width,const char* text_begin,const char* text_end,const char** remaining);
+CIMGUI_API void ImFont_CalcTextSizeCached(ImVec2 *pOut,ImFont* self,float size,float wrap_width,const char* text_begin,const char* text_end);
 CIMGUI_API const char* ImFont_CalcWordWrapPositionA(ImFont* self,float scale,const char* text,const char* text_end,float wrap_width);
 CIMGUI_API void ImFont_RenderChar(ImFont* self,ImDrawList* draw_list,float size,ImVec2 pos,ImU32 col,ImWchar c);
 CIMGUI_API void ImFont_RenderText(ImFont* self,ImDrawList* draw_list,float size,ImVec2 pos,ImU32 col,const ImVec4 clip_rect,const char* text_begin,const char* text_end,float wrap_width,bool cpu_fine_clip);
 CIMGUI_API void ImFont_BuildLookupTable(ImFont* self);
 CIMGUI_API void ImFont_ClearOutputData(ImFont* self);
 CIMGUI_API void ImFont_GrowIndex(ImFont* self,int new_size);
+CIMGUI_API int ImFont_AllocIndexPage(ImFont* self,unsigned int c);
 CIMGUI_API void ImFont_AddGlyph(ImFont* self,const ImFontConfig* src_cfg,ImWchar c,float x0,float y0,float x1,float y1,float u0,float v0,float u1,float v1,float advance_x);
 CIMGUI_API void ImFont_AddRemapChar(ImFont* self,ImWchar dst,ImWchar src,bool overwrite_dst);
 CIMGUI_API void ImFont_SetGlyphVisible(ImFont* self,ImWchar c,bool visible);
@@ -3263,6 +3612,7 @@ CIMGUI_API int igImTextStrFromUtf8(ImWchar* out_buf,int out_buf_size,const char*
 CIMGUI_API int igImTextCountCharsFromUtf8(const char* in_text,const char* in_text_end);
 CIMGUI_API int igImTextCountUtf8BytesFromChar(const char* in_text,const char* in_text_end);
 CIMGUI_API int igImTextCountUtf8BytesFromStr(const ImWchar* in_text,const ImWchar* in_text_end);
+CIMGUI_API const char* igImTextFindAsciiRunEnd(const char* in_text,const char* in_text_end);
 CIMGUI_API ImFileHandle igImFileOpen(const char* filename,const char* mode);
 CIMGUI_API bool igImFileClose(ImFileHandle file);
 CIMGUI_API ImU64 igImFileGetSize(ImFileHandle file);
@@ -3358,6 +3708,7 @@ CIMGUI_API void ImBitVector_ClearBit(ImBitVector* self,int n);
 CIMGUI_API ImDrawListSharedData* ImDrawListSharedData_ImDrawListSharedData(void);
 CIMGUI_API void ImDrawListSharedData_destroy(ImDrawListSharedData* self);
 CIMGUI_API void ImDrawListSharedData_SetCircleTessellationMaxError(ImDrawListSharedData* self,float max_error);
+CIMGUI_API float igImDrawQuadCalcCoverage(const ImDrawQuad quad,const ImVec2 p,float fringe_width);
 CIMGUI_API void ImDrawDataBuilder_Clear(ImDrawDataBuilder* self);
 CIMGUI_API void ImDrawDataBuilder_ClearFreeMemory(ImDrawDataBuilder* self);
 CIMGUI_API int ImDrawDataBuilder_GetDrawListCount(ImDrawDataBuilder* self);
@@ -3373,6 +3724,19 @@ CIMGUI_API void ImGuiMenuColumns_destroy(ImGuiMenuColumns* self);
 CIMGUI_API void ImGuiMenuColumns_Update(ImGuiMenuColumns* self,float spacing,bool window_reappearing);
 CIMGUI_API float ImGuiMenuColumns_DeclColumns(ImGuiMenuColumns* self,float w_icon,float w_label,float w_shortcut,float w_mark);
 CIMGUI_API void ImGuiMenuColumns_CalcNextTotalWidth(ImGuiMenuColumns* self,bool update_offsets);
+CIMGUI_API ImGuiTextUndoStack* ImGuiTextUndoStack_ImGuiTextUndoStack(void);
+CIMGUI_API void ImGuiTextUndoStack_destroy(ImGuiTextUndoStack* self);
+CIMGUI_API void ImGuiTextUndoStack_Clear(ImGuiTextUndoStack* self);
+CIMGUI_API int ImGuiTextUndoStack_GetCount(ImGuiTextUndoStack* self);
+CIMGUI_API int ImGuiTextUndoStack_GetMemoryUsed(ImGuiTextUndoStack* self);
+CIMGUI_API const ImWchar* ImGuiTextUndoStack_GetTopChars(ImGuiTextUndoStack* self);
+CIMGUI_API ImWchar* ImGuiTextUndoStack_Push(ImGuiTextUndoStack* self,int where,int insert_len,int delete_len);
+CIMGUI_API void ImGuiTextUndoStack_Pop(ImGuiTextUndoStack* self);
+CIMGUI_API void ImGuiTextUndoStack_DiscardOldest(ImGuiTextUndoStack* self);
+CIMGUI_API ImGuiTextUndoState* ImGuiTextUndoState_ImGuiTextUndoState(void);
+CIMGUI_API void ImGuiTextUndoState_destroy(ImGuiTextUndoState* self);
+CIMGUI_API void ImGuiTextUndoState_ClearFreeMemory(ImGuiTextUndoState* self);
+CIMGUI_API int ImGuiTextUndoState_GetMemoryUsed(ImGuiTextUndoState* self);
 CIMGUI_API ImGuiInputTextState* ImGuiInputTextState_ImGuiInputTextState(void);
 CIMGUI_API void ImGuiInputTextState_destroy(ImGuiInputTextState* self);
 CIMGUI_API void ImGuiInputTextState_ClearText(ImGuiInputTextState* self);
@@ -3728,7 +4092,7 @@ CIMGUI_API void igDataTypeApplyOp(ImGuiDataType data_type,int op,void* output,co
 CIMGUI_API bool igDataTypeApplyFromText(const char* buf,ImGuiDataType data_type,void* p_data,const char* format);
 CIMGUI_API int igDataTypeCompare(ImGuiDataType data_type,const void* arg_1,const void* arg_2);
 CIMGUI_API bool igDataTypeClamp(ImGuiDataType data_type,void* p_data,const void* p_min,const void* p_max);
-CIMGUI_API bool igInputTextEx(const char* label,const char* hint,char* buf,int buf_size,const ImVec2 size_arg,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data);
+CIMGUI_API bool igInputTextEx(const char* label,const char* hint,char* buf,int buf_size,const ImVec2 size_arg,ImGuiInputTextFlags flags,ImGuiInputTextCallback callback,void* user_data,ImGuiTextEditBuffer* edit_buf);
 CIMGUI_API bool igTempInputText(const ImRect bb,ImGuiID id,const char* label,char* buf,int buf_size,ImGuiInputTextFlags flags);
 CIMGUI_API bool igTempInputScalar(const ImRect bb,ImGuiID id,const char* label,ImGuiDataType data_type,void* p_data,const char* format,const void* p_clamp_min,const void* p_clamp_max);
 CIMGUI_API bool igTempInputIsActive(ImGuiID id);
@@ -3771,6 +4135,8 @@ CIMGUI_API void igImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas,in
 CIMGUI_API void igImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas,int x,int y,int w,int h,const char* in_str,char in_marker_char,unsigned int in_marker_pixel_value);
 CIMGUI_API void igImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256],float in_multiply_factor);
 CIMGUI_API void igImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256],unsigned char* pixels,int x,int y,int w,int h,int stride);
+CIMGUI_API float igImFontSdfCalcCoverage(float sdf_value,float sdf_spread,float texels_per_pixel);
+CIMGUI_API void igImFontBuildAsciiGlyphs(ImFont* font);
 
 
 /////////////////////////hand written functions
@@ -48,6 +48,7 @@
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_DISABLE_NEON                                // Disable use of NEON intrinsics even if available (AArch64)
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -65,6 +66,12 @@
 //#define IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
 //#define IMGUI_DISABLE_STB_RECT_PACK_IMPLEMENTATION
 
+//---- Use CRC32-C (Castagnoli) instead of CRC32 (IEEE) for ID hashing in ImHashData()/ImHashStr(), computed with the SSE4.2 or ARMv8 CRC32 instructions.
+// Requires the instructions to be enabled at compile time (e.g. '-msse4.2' or '-march=armv8-a+crc'), otherwise compilation will fail.
+// IDs are NOT bit-compatible with the default: IDs persisted by another build (e.g. table settings in .ini files) won't be matched anymore.
+// The default CRC32 path stays bit-compatible with every previous version and already uses ARMv8 CRC32 instructions when available.
+//#define IMGUI_USE_CRC32C
+
 //---- Use stb_printf's faster implementation of vsnprintf instead of the one from libc (unless IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS is defined)
 // Requires 'stb_sprintf.h' to be available in the include path. Compatibility checks of arguments and formats done by clang and GCC will be disabled in order to support the extra formats provided by STB sprintf.
 // #define IMGUI_USE_STB_SPRINTF
@@ -96,6 +103,12 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert (default is 20 bytes): 16-bit fixed point positions, 16-bit normalized UV.
+// Your renderer backend will need to fetch vertices accordingly, see comments above ImDrawVert in imgui.h.
+// Positions are clamped to [-4096,+4096) with the default 3 fractional bits, which can be changed with IM_DRAWVERT_POS_FRAC_BITS.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+//#define IM_DRAWVERT_POS_FRAC_BITS 3
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
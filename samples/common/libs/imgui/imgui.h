@@ -31,8 +31,8 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
-// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiLiteralID, ImGuiTextFilter, ImGuiTextBuffer, ImGuiTextView, ImGuiTextEditBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawListCache, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
 // [SECTION] Platform Dependent Interfaces (ImGuiPlatformImeData)
@@ -135,21 +135,27 @@ struct ImDrawChannel;               // Temporary storage to output draw commands
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
+struct ImDrawListCache;             // A recorded fragment of a draw list, which can be replayed with a translation/scale and tint color
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawQuad;                  // A single instanced quad (axis aligned rectangle + uv rectangle + col + rounding = 44 bytes), output instead of vertices/indices with ImDrawListFlags_InstancedQuads
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasDirtyRect;        // Region of the font atlas texture modified since it was last uploaded (ImFontAtlasFlags_DynamicGlyphs)
+struct ImFontAtlasDynamicGlyphs;    // Opaque storage for glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
+struct ImFontTextSizeCache;         // Optional per-font cache of text sizes measured by ImGui::CalcTextSize()
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiLiteralID;              // Helper to hash a string literal label at compile-time (see IM_LITERAL_ID())
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformImeData;        // Platform IME data for io.SetPlatformImeDataFn() function.
@@ -159,7 +165,9 @@ struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
+struct ImGuiTextEditBuffer;         // Helper to hold a large editable text for InputTextMultiline()
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextView;               // Helper to index a large read-only text buffer for TextView()
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
 
 // Enums/Flags (declared as int for compatibility with old C++, to allow using as flags without overhead, and to not pollute the top of this file)
@@ -178,6 +186,7 @@ typedef int ImGuiSortDirection;     // -> enum ImGuiSortDirection_   // Enum: A
 typedef int ImGuiStyleVar;          // -> enum ImGuiStyleVar_        // Enum: A variable identifier for styling
 typedef int ImGuiTableBgTarget;     // -> enum ImGuiTableBgTarget_   // Enum: A color target for TableSetBgColor()
 typedef int ImDrawFlags;            // -> enum ImDrawFlags_          // Flags: for ImDrawList functions
+typedef int ImDrawIdxFormat;        // -> enum ImDrawIdxFormat_      // Enum: An index format for ImDrawData::CopyToBuffers()
 typedef int ImDrawListFlags;        // -> enum ImDrawListFlags_      // Flags: for ImDrawList instance
 typedef int ImFontAtlasFlags;       // -> enum ImFontAtlasFlags_     // Flags: for ImFontAtlas build
 typedef int ImGuiBackendFlags;      // -> enum ImGuiBackendFlags_    // Flags: for io.BackendFlags
@@ -198,6 +207,7 @@ typedef int ImGuiTabItemFlags;      // -> enum ImGuiTabItemFlags_    // Flags: f
 typedef int ImGuiTableFlags;        // -> enum ImGuiTableFlags_      // Flags: For BeginTable()
 typedef int ImGuiTableColumnFlags;  // -> enum ImGuiTableColumnFlags_// Flags: For TableSetupColumn()
 typedef int ImGuiTableRowFlags;     // -> enum ImGuiTableRowFlags_   // Flags: For TableNextRow()
+typedef int ImGuiTextViewFlags;     // -> enum ImGuiTextViewFlags_   // Flags: for TextView()
 typedef int ImGuiTreeNodeFlags;     // -> enum ImGuiTreeNodeFlags_   // Flags: for TreeNode(), TreeNodeEx(), CollapsingHeader()
 typedef int ImGuiViewportFlags;     // -> enum ImGuiViewportFlags_   // Flags: for ImGuiViewport
 typedef int ImGuiWindowFlags;       // -> enum ImGuiWindowFlags_     // Flags: for Begin(), BeginChild()
@@ -242,6 +252,7 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef void    (*ImFontAtlasParallelForFunc)(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count, void* user_data); // Function signature for ImFontAtlas::BuildParallelFor
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -466,10 +477,12 @@ namespace ImGui
     IMGUI_API void          PushID(const char* str_id_begin, const char* str_id_end);       // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const void* ptr_id);                                     // push pointer into the ID stack (will hash pointer).
     IMGUI_API void          PushID(int int_id);                                             // push integer into the ID stack (will hash integer).
+    IMGUI_API void          PushID(const ImGuiLiteralID& str_id);                           // push string literal into the ID stack (hashed at compile-time, only combined with the ID stack at runtime). Use with IM_LITERAL_ID("...").
     IMGUI_API void          PopID();                                                        // pop from the ID stack.
     IMGUI_API ImGuiID       GetID(const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(const void* ptr_id);
+    IMGUI_API ImGuiID       GetID(const ImGuiLiteralID& str_id);                            // == GetID(str_id.Str), but hashed at compile-time. Use with IM_LITERAL_ID("...").
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
@@ -486,10 +499,17 @@ namespace ImGui
     IMGUI_API void          BulletText(const char* fmt, ...)                                IM_FMTARGS(1); // shortcut for Bullet()+Text()
     IMGUI_API void          BulletTextV(const char* fmt, va_list args)                      IM_FMTLIST(1);
 
+    // Widgets: Text View
+    // - Scrolling view over a large read-only text (e.g. a multi-megabyte log or a memory-mapped file). See ImGuiTextView for how the text is indexed.
+    // - Only visible lines are measured and rendered: the cost per frame doesn't depend on the size of the text.
+    // - Supports mouse selection (double-click selects a word, shift-click extends), Ctrl+A and Ctrl+C.
+    IMGUI_API void          TextView(const char* str_id, ImGuiTextView* view, const ImVec2& size = ImVec2(0, 0), ImGuiTextViewFlags flags = 0);
+
     // Widgets: Main
     // - Most widgets return true when the value has been changed or when pressed/selected
     // - You may also use one of the many IsItemXXX functions (e.g. IsItemActive, IsItemHovered, etc.) to query widget state.
     IMGUI_API bool          Button(const char* label, const ImVec2& size = ImVec2(0, 0));   // button
+    IMGUI_API bool          Button(const ImGuiLiteralID& label, const ImVec2& size = ImVec2(0, 0)); // button with a label hashed at compile-time. Use with IM_LITERAL_ID("...").
     IMGUI_API bool          SmallButton(const char* label);                                 // button with FramePadding=(0,0) to easily embed within text
     IMGUI_API bool          InvisibleButton(const char* str_id, const ImVec2& size, ImGuiButtonFlags flags = 0); // flexible button behavior without the visuals, frequently useful to build custom behaviors using the public api (along with IsItemActive, IsItemHovered, etc.)
     IMGUI_API bool          ArrowButton(const char* str_id, ImGuiDir dir);                  // square button with an arrow shape
@@ -563,6 +583,7 @@ namespace ImGui
     // - Most of the ImGuiInputTextFlags flags are only useful for InputText() and not for InputFloatX, InputIntX, InputDouble etc.
     IMGUI_API bool          InputText(const char* label, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputTextMultiline(const char* label, char* buf, size_t buf_size, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
+    IMGUI_API bool          InputTextMultiline(const char* label, ImGuiTextEditBuffer* buffer, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL); // Edit a large text in place, see ImGuiTextEditBuffer. Return true when edited.
     IMGUI_API bool          InputTextWithHint(const char* label, const char* hint, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputFloat(const char* label, float* v, float step = 0.0f, float step_fast = 0.0f, const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
     IMGUI_API bool          InputFloat2(const char* label, float v[2], const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
@@ -589,6 +610,7 @@ namespace ImGui
     // Widgets: Trees
     // - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
     IMGUI_API bool          TreeNode(const char* label);
+    IMGUI_API bool          TreeNode(const ImGuiLiteralID& label);                              // tree node with a label hashed at compile-time. Use with IM_LITERAL_ID("...").
     IMGUI_API bool          TreeNode(const char* str_id, const char* fmt, ...) IM_FMTARGS(2);   // helper variation to easily decorelate the id from the displayed string. Read the FAQ about why and how to use ID. to align arbitrary text at the same level as a TreeNode() you can use Bullet().
     IMGUI_API bool          TreeNode(const void* ptr_id, const char* fmt, ...) IM_FMTARGS(2);   // "
     IMGUI_API bool          TreeNodeV(const char* str_id, const char* fmt, va_list args) IM_FMTLIST(2);
@@ -963,6 +985,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 18,  // No gamepad/keyboard navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 19,  // No focusing toward this window with gamepad/keyboard navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 20,  // Display a dot next to the title. When used in a tab/docking context, tab is selected when clicking the X + closure is not assumed (will wait for user to stop submitting the tab). Otherwise closure is assumed when pressing the X, so if you keep submitting the tab may reappear at end of tab bar.
+    ImGuiWindowFlags_RetainDrawList         = 1 << 21,  // Reuse the previous frame's draw output up to the first primitive which differs from the frame before (widgets still run, only tessellation is skipped). Vertices written directly with PrimReserve() are not fingerprinted: the window is then fully tessellated on the next frame. Code may skip them when ImDrawListFlags_FingerprintOnly is set if they only depend on primitives submitted before (e.g. ShadeVertsXXX functions).
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -1008,6 +1031,16 @@ enum ImGuiInputTextFlags_
 #endif
 };
 
+// Flags for ImGui::TextView()
+enum ImGuiTextViewFlags_
+{
+    ImGuiTextViewFlags_None                 = 0,
+    ImGuiTextViewFlags_Border               = 1 << 0,   // Show an outer border
+    ImGuiTextViewFlags_WordWrap             = 1 << 1,   // Wrap lines to the width of the view. Builds a row index for the current width and font, see ImGuiTextView::WrapBytesPerFrame.
+    ImGuiTextViewFlags_AutoScroll           = 1 << 2,   // Keep scrolled to the bottom when text is appended, if the view was already scrolled to the bottom
+    ImGuiTextViewFlags_NoSelection          = 1 << 3    // Disable mouse selection and copy
+};
+
 // Flags for ImGui::TreeNodeEx(), ImGui::CollapsingHeader*()
 enum ImGuiTreeNodeFlags_
 {
@@ -1520,7 +1553,10 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Backend Platform supports gamepad and currently has one connected.
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
-    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3    // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasInstancedQuads = 1 << 4, // Backend Renderer supports ImDrawCmd::QuadCount (instanced quads read from ImDrawList::QuadBuffer). This enables ImDrawListFlags_InstancedQuads on all draw lists.
+    ImGuiBackendFlags_RendererHasSdfShapes  = 1 << 5,   // Backend Renderer supports ImDrawQuad::Rounding (quads evaluated as rounded rectangles in the pixel shader, see ImDrawQuad). Requires ImGuiBackendFlags_RendererHasInstancedQuads. This enables ImDrawListFlags_SdfShapes on all draw lists.
+    ImGuiBackendFlags_RendererHasSdfText    = 1 << 6    // Backend Renderer supports font atlases holding signed distance field glyphs (ImFontConfig::SignedDistanceField): texels at V >= ImFontAtlas::TexUvSdfMinV are converted to coverage in the pixel shader, see ImFontAtlas.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1931,10 +1967,12 @@ struct ImGuiIO
     bool        ConfigMacOSXBehaviors;          // = defined(__APPLE__) // OS X style: Text editing cursor movement using Alt instead of Ctrl, Shortcuts using Cmd/Super instead of Ctrl, Line/Text Start and End using Cmd+Arrows instead of Home/End, Double click selects by word instead of selecting whole text, Multi-selection in lists uses Cmd/Super instead of Ctrl.
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
+    int         ConfigInputTextUndoMemory;      // = 4 MB           // Maximum memory used by the undo/redo history of the active text input, in bytes. The oldest edits are forgotten first. Freed when the text input is deactivated.
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigDrawDataDamageRects;      // = false          // Compute ImDrawData::DamageRects[] in Render(): areas of the display whose draw output changed since last frame. Useful for partial presentation, or to skip idle frames.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -2156,7 +2194,7 @@ struct ImGuiTableSortSpecs
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiLiteralID, ImGuiTextFilter, ImGuiTextBuffer, ImGuiTextView, ImGuiTextEditBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2176,6 +2214,39 @@ struct ImGuiOnceUponAFrame
     operator bool() const { int current_frame = ImGui::GetFrameCount(); if (RefFrame == current_frame) return false; RefFrame = current_frame; return true; }
 };
 
+// Helper: String literal label/ID hashed at compile-time.
+// Usage: if (ImGui::Button(IM_LITERAL_ID("OK"))) { ... }    or:    static constexpr ImGuiLiteralID id_ok("OK"); ImGui::PushID(id_ok);
+// - Produces the same ID as the equivalent 'const char*' call (including the "label###id" syntax), so the two may be mixed freely.
+// - CRC32 is linear: hash(seed, str) == hash(0, str) ^ hash(seed, zeros(len)). The first term is computed at compile-time,
+//   the second one is the only runtime work left: it needs no string access and costs 4 table lookups per 8 characters.
+// - Use IM_LITERAL_ID() rather than constructing a temporary ImGuiLiteralID inline: the macro guarantees compile-time evaluation,
+//   whereas an unoptimized build may otherwise evaluate the constexpr constructor at runtime (correct, but very slow).
+// - Literals are limited to a few hundred characters by the compiler's constexpr recursion depth.
+#ifdef IMGUI_USE_CRC32C
+#define IM_CRC32_POLY   0x82F63B78u     // CRC32-C (Castagnoli), reflected. Must match ImHashData()/ImHashStr() in imgui.cpp.
+#else
+#define IM_CRC32_POLY   0xEDB88320u     // CRC32 (IEEE 802.3), reflected. Must match ImHashData()/ImHashStr() in imgui.cpp.
+#endif
+#define IM_LITERAL_ID(_LITERAL)     ImGuiLiteralID(_LITERAL, ImGuiLiteralIDConst<ImGuiLiteralID(_LITERAL).Crc>::Value, ImGuiLiteralIDConst<ImGuiLiteralID(_LITERAL).HashLen>::Value)
+template<ImU32 V> struct ImGuiLiteralIDConst { static const ImU32 Value = V; };
+static inline constexpr ImU32   ImCrc32ConstBits(ImU32 crc, int n)                              { return n == 0 ? crc : ImCrc32ConstBits((crc >> 1) ^ ((crc & 1) ? IM_CRC32_POLY : 0), n - 1); }
+static inline constexpr ImU32   ImCrc32ConstStr(ImU32 crc, const char* s, size_t i, size_t end)  { return i == end ? crc : ImCrc32ConstStr(ImCrc32ConstBits(crc ^ (unsigned char)s[i], 8), s, i + 1, end); }
+static inline constexpr size_t  ImStrlenConst(const char* s, size_t i, size_t max)              { return (i == max || s[i] == 0) ? i : ImStrlenConst(s, i + 1, max); }
+static inline constexpr size_t  ImStrFindLastTripleHashConst(const char* s, size_t i, size_t end, size_t last) { return i + 3 > end ? last : ImStrFindLastTripleHashConst(s, i + 1, end, (s[i] == '#' && s[i + 1] == '#' && s[i + 2] == '#') ? i : last); }
+struct ImGuiLiteralID
+{
+    const char* Str;        // Zero-terminated label, as would be passed to the 'const char*' version of the function
+    ImU32       Crc;        // CRC32 register after hashing the hashed part of the label (after the last "###", if any) from zero
+    ImU32       HashLen;    // Length of the hashed part of the label
+
+    template<size_t N>
+    constexpr ImGuiLiteralID(const char (&str)[N]) :
+        Str(str),
+        Crc(ImCrc32ConstStr(0, str, ImStrFindLastTripleHashConst(str, 0, ImStrlenConst(str, 0, N - 1), 0), ImStrlenConst(str, 0, N - 1))),
+        HashLen((ImU32)(ImStrlenConst(str, 0, N - 1) - ImStrFindLastTripleHashConst(str, 0, ImStrlenConst(str, 0, N - 1), 0))) {}
+    constexpr ImGuiLiteralID(const char* str, ImU32 crc, ImU32 hash_len) : Str(str), Crc(crc), HashLen(hash_len) {}
+};
+
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
 struct ImGuiTextFilter
 {
@@ -2223,6 +2294,81 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Line index over a read-only text buffer, for ImGui::TextView()
+// - The text is NOT copied: it may be a memory-mapped file, the contents of an ImGuiTextBuffer, etc. It must stay valid while it is viewed.
+// - Text may only be appended to: call SetText() again with the (possibly moved) buffer and its new size, only the new bytes are indexed.
+//   If the text was modified in any other way, call Clear() before SetText().
+// - With ImGuiTextViewFlags_WordWrap, the number of rows of each line is measured at most WrapBytesPerFrame bytes per frame, starting from the top.
+//   Lines not measured yet are displayed as a single row. Changing the wrap width or the font starts measuring again.
+struct ImGuiTextView
+{
+    const char*         Text;               // Viewed text (not owned)
+    int                 TextSize;           // Size of Text in bytes
+    ImVector<int>       LineOffsets;        // Offset of the first byte of each line in Text. There is always at least one line.
+    int                 SelectionStart;     // Selection anchor, offset in Text
+    int                 SelectionEnd;       // Selection end, offset in Text (may be < SelectionStart)
+    int                 WrapBytesPerFrame;  // Maximum amount of text to measure per frame when building the word wrap index (default to 1 MB)
+
+    // [Internal]
+    ImFont*             MeasureFont;        // Font and size which ContentWidth and WrapRowStarts[] were measured with
+    float               MeasureFontSize;
+    float               ContentWidth;       // Width of the widest line displayed so far (without word wrap)
+    float               WrapWidth;          // Wrap width which WrapRowStarts[] was measured with
+    ImVector<int>       WrapRowStarts;      // First row of each measured line, followed by the number of rows of all measured lines
+    int                 WrapCacheLine;      // Last row located in a wrapped line, so long lines aren't re-wrapped from their beginning every frame
+    int                 WrapCacheRow;
+    int                 WrapCacheOffset;
+    ImVector<int>       VisibleRows;        // Begin/end offsets of the rows visible this frame, by pairs
+
+    ImGuiTextView()                         { WrapBytesPerFrame = 1024 * 1024; Clear(); }
+    IMGUI_API void      Clear();
+    IMGUI_API void      SetText(const char* text, int text_size);   // Set text and index the bytes appended since the last call. The first TextSize bytes must be unchanged.
+    int                 GetLineCount() const                        { return LineOffsets.Size; }
+    const char*         GetLineBegin(int n) const                   { return Text + LineOffsets[n]; }
+    const char*         GetLineEnd(int n) const                     { return Text + (n + 1 < LineOffsets.Size ? LineOffsets[n + 1] - 1 : TextSize); } // Excluding '\n'
+    bool                HasSelection() const                        { return SelectionStart != SelectionEnd; }
+    void                ClearSelection()                            { SelectionStart = SelectionEnd = 0; }
+    void                SelectAll()                                 { SelectionStart = 0; SelectionEnd = TextSize; }
+};
+
+// Helper: Editable text storage for InputTextMultiline(), for texts too large to be converted and scanned in full every frame
+// - The text is stored as wide characters with a gap at the last edit position: typing and deleting next to it is O(1),
+//   an edit elsewhere first moves the gap there (a memmove of the text in between).
+// - The position of every line break is indexed, so the widget only lays out and renders the lines which are visible.
+// - The text stays in this buffer while being edited, call GetText() to retrieve it as UTF-8 when you need it.
+// - Positions are in characters, not bytes. Escape doesn't revert the edits done since the widget was activated, use Undo.
+// - Among the callback flags only ImGuiInputTextFlags_CallbackCharFilter is supported. ImGuiInputTextFlags_Password is not supported.
+struct ImGuiTextEditBuffer
+{
+    ImVector<ImWchar>   Buf;                // Text before the gap, gap, text after the gap (not zero-terminated)
+    int                 GapBegin;           // Gap in Buf, where characters are inserted/deleted
+    int                 GapEnd;
+    ImVector<int>       LineBreaks;         // Position of each '\n'. Before the gap: as a position, after the gap: as a distance to the end of the text, so edits in the gap don't move them.
+    int                 LineGapBegin;       // Gap in LineBreaks, matching the gap in Buf
+    int                 LineGapEnd;
+    int                 TextSizeA;          // Size of the text in UTF-8, in bytes, excluding zero-terminator
+    int                 UndoMemory;         // Maximum memory used by the undo/redo history while editing this buffer, in bytes. 0 to use io.ConfigInputTextUndoMemory.
+
+    // [Internal]
+    ImVector<char>      DisplayBuf;         // Lines visible this frame, converted to UTF-8 for rendering
+
+    ImGuiTextEditBuffer()                   { UndoMemory = 0; Clear(); }
+    void                Clear()                                     { Buf.clear(); LineBreaks.clear(); GapBegin = GapEnd = LineGapBegin = LineGapEnd = TextSizeA = 0; }
+    IMGUI_API void      SetText(const char* text, const char* text_end = NULL);
+    IMGUI_API int       GetText(char* buf, int buf_size, int pos_begin = 0, int pos_end = -1) const;   // Write [pos_begin, pos_end) as zero-terminated UTF-8 into buf. Return number of bytes written, excluding zero-terminator.
+    IMGUI_API int       GetTextSizeA(int pos_begin = 0, int pos_end = -1) const;                          // Size of [pos_begin, pos_end) in UTF-8, excluding zero-terminator. Allocate GetTextSizeA() + 1 bytes for GetText().
+    int                 GetLength() const                           { return Buf.Size - (GapEnd - GapBegin); }
+    ImWchar             GetChar(int pos) const                      { if (pos < GapBegin) return Buf.Data[pos]; pos += GapEnd - GapBegin; return pos < Buf.Size ? Buf.Data[pos] : 0; } // Return 0 past the end
+    int                 GetLineCount() const                        { return LineBreaks.Size - (LineGapEnd - LineGapBegin) + 1; }
+    int                 GetLineStart(int line) const                { return line > 0 ? GetLineBreak(line - 1) + 1 : 0; }
+    int                 GetLineBreak(int n) const                   { return n < LineGapBegin ? LineBreaks.Data[n] : GetLength() - LineBreaks.Data[n + LineGapEnd - LineGapBegin]; } // Position of the n-th '\n'
+    IMGUI_API int       GetLineFromPos(int pos) const;              // Line containing the character at 'pos', O(log lines)
+    IMGUI_API void      Insert(int pos, const ImWchar* text, int text_len);
+    IMGUI_API void      Insert(int pos, const char* text, const char* text_end = NULL);   // Insert UTF-8 text
+    IMGUI_API void      Delete(int pos, int count);
+    IMGUI_API void      MoveGap(int pos, int min_gap_size);         // [Internal]
+};
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -2242,13 +2388,19 @@ struct ImGuiStorage
         ImGuiStoragePair(ImGuiID _key, float _val_f)    { key = _key; val_f = _val_f; }
         ImGuiStoragePair(ImGuiID _key, void* _val_p)    { key = _key; val_p = _val_p; }
     };
+    struct ImGuiStorageSlot
+    {
+        ImGuiID key;
+        int     idx;                                    // Index into Data[], -1 if the slot is empty
+    };
 
-    ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStoragePair>      Data;               // Pairs in insertion order (or key order after BuildSortByKey())
+    ImVector<ImGuiStorageSlot>      Index;              // Open-addressing hash table (power of two size, Robin Hood linear probing) mapping keys to Data[] indices
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    // - Get***() functions find pair, never add/allocate. Pairs are hashed so a query is O(1)
     // - Set***() functions find pair, insertion on demand if missing.
-    // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    // - Insertion appends to Data[] and is amortized O(1). A typical frame shouldn't need to insert any new pair.
+    void                Clear() { Data.clear(); Index.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2270,7 +2422,8 @@ struct ImGuiStorage
     // Use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
-    // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // For quicker full rebuild of a storage (instead of an incremental one), you may push_back() all your contents into Data then sort once.
+    // This also rebuilds Index, which is required after modifying Data directly.
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -2398,6 +2551,8 @@ struct ImDrawCmd
     unsigned int    VtxOffset;          // 4    // Start offset in vertex buffer. ImGuiBackendFlags_RendererHasVtxOffset: always 0, otherwise may be >0 to support meshes larger than 64K vertices with 16-bit indices.
     unsigned int    IdxOffset;          // 4    // Start offset in index buffer.
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
+    unsigned int    QuadOffset;         // 4    // Start offset in quad buffer.
+    unsigned int    QuadCount;          // 4    // Number of instanced quads to be rendered (ImGuiBackendFlags_RendererHasInstancedQuads). A command has either ElemCount != 0 or QuadCount != 0, never both. Quads are stored in the callee ImDrawList's QuadBuffer[] array.
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;   // 4-8  // The draw callback code can access this.
 
@@ -2408,7 +2563,41 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT) && defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT are mutually exclusive."
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+// Compact vertex layout (pos + uv + col = 12 bytes), enabled by defining IMGUI_USE_COMPACT_DRAWVERT in imconfig.h
+// - 'pos' is stored as signed 16-bit fixed point with IM_DRAWVERT_POS_FRAC_BITS fractional bits (default: 1/8 pixel, range [-4096,+4096)).
+//   Coordinates outside of the representable range are clamped to it (NaN maps to the lower bound): keep your display area within that range, or use less fractional bits.
+// - 'uv' is stored as unsigned normalized 16-bit. Coordinates outside of [0,1] are clamped to it: texture wrapping is not supported.
+// - Renderer backends need to fetch 'pos' as R16G16_SINT (and divide it by IM_DRAWVERT_POS_SCALE) and 'uv' as R16G16_UNORM.
+// - Both fields convert from/to ImVec2, e.g. 'vtx.pos = ImVec2(x, y)' or 'ImVec2 p = vtx.pos'. Raw values are x16/y16 and u16/v16.
+#ifndef IM_DRAWVERT_POS_FRAC_BITS
+#define IM_DRAWVERT_POS_FRAC_BITS   3
+#endif
+#define IM_DRAWVERT_POS_SCALE       ((float)(1 << IM_DRAWVERT_POS_FRAC_BITS))
+struct ImDrawVertPos
+{
+    ImS16   x16, y16;
+    static ImS16    Pack(float v)                       { v *= IM_DRAWVERT_POS_SCALE; v = (v >= -32768.0f) ? (v <= 32767.0f ? v : 32767.0f) : -32768.0f; return (ImS16)(int)(v >= 0.0f ? v + 0.5f : v - 0.5f); }
+    ImDrawVertPos&  operator=(const ImVec2& v)          { x16 = Pack(v.x); y16 = Pack(v.y); return *this; }
+    operator        ImVec2() const                      { return ImVec2(x16 * (1.0f / IM_DRAWVERT_POS_SCALE), y16 * (1.0f / IM_DRAWVERT_POS_SCALE)); }
+};
+struct ImDrawVertUV
+{
+    ImU16   u16, v16;
+    static ImU16    Pack(float v)                       { v = (v >= 0.0f) ? (v <= 1.0f ? v : 1.0f) : 0.0f; return (ImU16)(int)(v * 65535.0f + 0.5f); }
+    ImDrawVertUV&   operator=(const ImVec2& v)          { u16 = Pack(v.x); v16 = Pack(v.y); return *this; }
+    operator        ImVec2() const                      { return ImVec2(u16 * (1.0f / 65535.0f), v16 * (1.0f / 65535.0f)); }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos   pos;
+    ImDrawVertUV    uv;
+    ImU32           col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -2423,6 +2612,22 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Instanced quad, output for axis aligned filled rectangles, images and glyphs when ImDrawListFlags_InstancedQuads is set (see ImDrawCmd::QuadCount)
+// Renderer backends draw one instance of a 2 triangles quad per ImDrawQuad. Corners and their texture coordinates are, in order:
+// (Min.x, Min.y)/(UvMin.x, UvMin.y), (Max.x, Min.y)/(UvMax.x, UvMin.y), (Max.x, Max.y)/(UvMax.x, UvMax.y), (Min.x, Max.y)/(UvMin.x, UvMax.y)
+// Triangles are (0, 1, 2) and (0, 2, 3), which matches the output of PrimRectUV(). See ImDrawList::ExpandInstancedQuads() for the reference implementation.
+// With ImDrawListFlags_SdfShapes, filled rounded rectangles, rounded images and circles are output as a single quad with Rounding > 0.0f:
+// the pixel shader multiplies the color by an anti-aliased coverage computed from the signed distance to the rounded rectangle. See ImDrawQuadCalcCoverage() in imgui_draw.cpp for the reference implementation.
+// Their anti-aliased fringe extends half a pixel outside of Min/Max: draw them expanded by half a pixel on each side (extrapolating texture coordinates).
+struct ImDrawQuad
+{
+    ImVec2      Min, Max;
+    ImVec2      UvMin, UvMax;
+    ImU32       Col;
+    float       Rounding;       // Corner radius, 0.0f for a plain quad. A circle is a square with Rounding == half its size.
+    ImDrawFlags Flags;          // ImDrawFlags_RoundCornersXXX: corners using Rounding
+};
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
@@ -2484,7 +2689,11 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLines        = 1 << 0,  // Enable anti-aliased lines/borders (*2 the number of triangles for 1.0f wide line or lines thin enough to be drawn using textures, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering.
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
-    ImDrawListFlags_AllowVtxOffset          = 1 << 3   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_Fingerprint             = 1 << 4,  // Hash parameters of submitted primitives into _Fingerprint. Set by Begin() for windows using ImGuiWindowFlags_RetainDrawList.
+    ImDrawListFlags_FingerprintOnly         = 1 << 5,  // Only hash parameters of submitted primitives, don't output any geometry while they match the retained output (requires ImDrawListFlags_Fingerprint). Cleared when they differ, or when PrimReserve() is called.
+    ImDrawListFlags_InstancedQuads          = 1 << 6,  // Output axis aligned filled rectangles, images and glyphs as one ImDrawQuad each in QuadBuffer instead of 4 vertices + 6 indices. Set when 'ImGuiBackendFlags_RendererHasInstancedQuads' is enabled.
+    ImDrawListFlags_SdfShapes               = 1 << 7   // Output filled rounded rectangles, rounded images and circles (with automatic segment count) as one rounded ImDrawQuad each (requires ImDrawListFlags_InstancedQuads and ImDrawListFlags_AntiAliasedFill). Set when 'ImGuiBackendFlags_RendererHasSdfShapes' is enabled.
 };
 
 // Draw command list
@@ -2496,12 +2705,23 @@ enum ImDrawListFlags_
 // In single viewport mode, top-left is == GetMainViewport()->Pos (generally 0,0), bottom-right is == GetMainViewport()->Pos+Size (generally io.DisplaySize).
 // You are totally free to apply whatever transformation matrix to want to the data (depending on the use of the transformation you may want to apply it to ClipRect as well!)
 // Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects.
+// Building draw lists on worker threads:
+// - ImDrawList functions only read from their ImDrawListSharedData and font, so standalone ImDrawList instances can be filled concurrently on
+//   other threads, as long as no ImGui:: function is called from them. Because PushFont() modifies the shared data of the context, make a
+//   copy on the main thread after NewFrame() (e.g. 'ImDrawListSharedData data = *ImGui::GetDrawListSharedData();') and create worker lists with it.
+// - Call ResetForNewFrame() on a worker list before filling it, it will use the same ImDrawListFlags as the draw lists of the context.
+// - On the main thread, call AddDrawListDeferred() on a window draw list or on the background/foreground draw list to insert the output
+//   of a worker list at the current position. Contents are copied by ImGui::Render() (or by ResolveDeferredDrawLists() on your own lists):
+//   worker threads must be done by then, and worker lists must stay alive and unmodified until then.
+// - Spliced contents are rendered in order of submission, between what was submitted before and after the AddDrawListDeferred() call,
+//   and clipped with the intersection of their own clipping rectangles and the current one.
 struct ImDrawList
 {
     // This is what you have to render
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImDrawQuad>    QuadBuffer;         // Instanced quads buffer (ImDrawListFlags_InstancedQuads). Each command consume ImDrawCmd::QuadCount of those
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -2516,6 +2736,9 @@ struct ImDrawList
     ImDrawCmdHeader         _CmdHeader;         // [Internal] template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    ImU32                   _Fingerprint;       // [Internal] hash of submitted primitives when ImDrawListFlags_Fingerprint is set
+    struct ImGuiWindowRetainedDrawList* _Retained; // [Internal] previous output of the window when ImDrawListFlags_Fingerprint is set by Begin()
+    ImVector<const ImDrawList*> _DeferredDrawLists; // [Internal] draw lists submitted with AddDrawListDeferred(), in order, until ResolveDeferredDrawLists() is called
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
     ImDrawList(const ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
@@ -2554,6 +2777,17 @@ struct ImDrawList
     IMGUI_API void  AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0); // Cubic Bezier (4 control points)
     IMGUI_API void  AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments = 0);               // Quadratic Bezier (3 control points)
 
+    // Batched primitives
+    // - Submit 'count' primitives in one call: buffers are reserved once per chunk of elements, then vertices and indices are written in a tight loop.
+    // - Output is the same as calling the matching function above once per element. 'cols' holds one color per element, fully transparent elements are skipped.
+    IMGUI_API void  AddLineBatch(const ImVec2* p1, const ImVec2* p2, const ImU32* cols, int count, float thickness = 1.0f);
+    IMGUI_API void  AddRectFilledBatch(const ImVec2* p_min, const ImVec2* p_max, const ImU32* cols, int count);                                             // No rounding
+    IMGUI_API void  AddQuadFilledBatch(const ImVec2* points, const ImU32* cols, int count);                                                                 // 4 consecutive points per quad
+    IMGUI_API void  AddCircleFilledBatch(const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments = 0);
+
+    // Replay a fragment recorded with ImDrawListCache: pos * scale + offset, colors multiplied by 'tint_col'.
+    IMGUI_API void  AddDrawListCache(const ImDrawListCache& cache, const ImVec2& offset = ImVec2(0, 0), float scale = 1.0f, ImU32 tint_col = IM_COL32_WHITE);
+
     // Image primitives
     // - Read FAQ to understand what ImTextureID is.
     // - "p_min" and "p_max" represent the upper-left and lower-right corners of the rectangle.
@@ -2577,7 +2811,11 @@ struct ImDrawList
     // Advanced
     IMGUI_API void  AddCallback(ImDrawCallback callback, void* callback_data);  // Your rendering function must check for 'UserCallback' in ImDrawCmd and call the function instead of rendering triangles.
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
-    IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer/QuadBuffer.
+    IMGUI_API void  ExpandInstancedQuads();                                     // Convert instanced quads to indexed triangles. Done by Render() when the backend doesn't set 'ImGuiBackendFlags_RendererHasInstancedQuads'.
+    IMGUI_API void  ResetForNewFrame();                                         // Clear and setup a standalone draw list (e.g. built on a worker thread): full-screen clipping rectangle and font atlas texture.
+    IMGUI_API void  AddDrawListDeferred(const ImDrawList* draw_list);          // Insert the output of another draw list at the current position. It is copied when calling ResolveDeferredDrawLists(), so it may still be built on another thread until then.
+    IMGUI_API void  ResolveDeferredDrawLists();                                 // Copy the output of draw lists submitted with AddDrawListDeferred(). Done by Render() for all draw lists of the context.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -2592,6 +2830,8 @@ struct ImDrawList
     // Advanced: Primitives allocations
     // - We render triangles (three vertices)
     // - All primitives needs to be reserved via PrimReserve() beforehand.
+    // - Vertices written directly are not part of the fingerprint of ImGuiWindowFlags_RetainDrawList windows: calling PrimReserve() while ImDrawListFlags_FingerprintOnly is set resumes tessellation, and makes the window fully tessellated on the next frame.
+    //   Likewise, no longer writing them doesn't change the fingerprint: something fingerprinted needs to change in the same frame.
     IMGUI_API void  PrimReserve(int idx_count, int vtx_count);
     IMGUI_API void  PrimUnreserve(int idx_count, int vtx_count);
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
@@ -2601,6 +2841,12 @@ struct ImDrawList
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
+    // Advanced: Instanced quads allocations (ImDrawListFlags_InstancedQuads)
+    // - Quads are written into QuadBuffer[] instead of VtxBuffer[]/IdxBuffer[], no PrimReserve() call is needed.
+    IMGUI_API ImDrawQuad* PrimReserveQuads(int quad_count);                      // Return a pointer to 'quad_count' quads to fill. Same as PrimReserve(), you must finish filling them before calling any other function.
+    IMGUI_API void  PrimUnreserveQuads(int quad_count);
+    inline    void  PrimRectInstanced(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col, float rounding = 0.0f, ImDrawFlags flags = 0) { ImDrawQuad* q = PrimReserveQuads(1); q->Min = a; q->Max = b; q->UvMin = uv_a; q->UvMax = uv_b; q->Col = col; q->Rounding = rounding; q->Flags = flags; }
+
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     inline    void  AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0) { AddBezierCubic(p1, p2, p3, p4, col, thickness, num_segments); } // OBSOLETED in 1.80 (Jan 2021)
     inline    void  PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments = 0) { PathBezierCubicCurveTo(p2, p3, p4, num_segments); } // OBSOLETED in 1.80 (Jan 2021)
@@ -2614,11 +2860,64 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _OnChangedCmdBuffer();
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
 };
 
+// [Internal] For use by ImDrawListCache
+struct ImDrawListCacheSegment
+{
+    ImTextureID     TextureId;          // Texture the geometry was recorded with
+    bool            UseCurrentTexture;  // Recorded with the texture that was current at BeginRecord() time: replay with the current texture of the target draw list
+    int             VtxOffset;          // Start offset in VtxBuffer
+    int             VtxCount;
+    int             IdxOffset;          // Start offset in IdxBuffer. Indices are relative to VtxOffset.
+    int             IdxCount;
+};
+
+// A recorded fragment of a draw list, replayed with ImDrawList::AddDrawListCache()
+// - Use for static content that is expensive to tessellate (icons, grids, paths, text): record it once with BeginRecord()/EndRecord()
+//   around regular ImDrawList calls (it is also rendered normally on that frame), then replay it on following frames as a bulk copy of
+//   vertices and indices, with an optional translation/scale and tint color.
+// - Replayed geometry uses the current clip rectangle of the target draw list. Geometry recorded with the texture that was current at
+//   BeginRecord() time (generally the font atlas) uses the current texture of the target, geometry recorded with other textures (e.g. AddImage()) keeps its own.
+// - Scaling also scales anti-aliased fringes, so prefer recording at the size you are going to replay at.
+// - Don't use ChannelsSplit() while recording. Recorded callbacks are dropped. Geometry is always recorded as triangles (ImDrawListFlags_InstancedQuads is ignored).
+// - Recorded text refers to glyphs of the font atlas, which may move (e.g. ImFontAtlas::Build(), ImFontAtlasFlags_DynamicGlyphs): record again when IsStale() returns true.
+struct ImDrawListCache
+{
+    ImVector<ImDrawVert>                VtxBuffer;
+    ImVector<ImDrawIdx>                 IdxBuffer;
+    ImVector<ImDrawListCacheSegment>    Segments;
+    ImVec2                              BoundsMin;      // Bounding box of recorded vertices, used to skip replaying fully clipped fragments
+    ImVec2                              BoundsMax;
+    ImFontAtlas*                        FontAtlas;      // Atlas of the font of the draw list at EndRecord() time, and its TexGeneration then: see IsStale()
+    int                                 FontAtlasTexGeneration;
+
+    // [Internal] Recording state
+    ImDrawList*                         _RecordDrawList;
+    int                                 _RecordVtxStart;
+    int                                 _RecordIdxStart;
+    ImTextureID                         _RecordTextureId;
+    ImDrawListFlags                     _RecordDrawListFlags;   // Flags of the draw list, ImDrawListFlags_InstancedQuads is cleared while recording
+
+    ImDrawListCache()                   { _RecordDrawList = NULL; _RecordVtxStart = _RecordIdxStart = 0; _RecordTextureId = (ImTextureID)NULL; _RecordDrawListFlags = ImDrawListFlags_None; Clear(); }
+    void            Clear()             { VtxBuffer.resize(0); IdxBuffer.resize(0); Segments.resize(0); BoundsMin = BoundsMax = ImVec2(0.0f, 0.0f); FontAtlas = NULL; FontAtlasTexGeneration = 0; }
+    bool            IsEmpty() const     { return IdxBuffer.Size == 0; }
+    IMGUI_API bool  IsStale() const;    // Texture coordinates of glyphs changed since recording (see ImFontAtlas::TexGeneration). AddDrawListCache() asserts on stale caches.
+    IMGUI_API void  BeginRecord(ImDrawList* draw_list);
+    IMGUI_API void  EndRecord();
+};
+
+// Index format written by ImDrawData::CopyToBuffers()
+enum ImDrawIdxFormat_
+{
+    ImDrawIdxFormat_Native                  = 0,    // ImDrawIdx, copied as is. Draw each command with a base vertex of (number of vertices of previous draw lists + ImDrawCmd::VtxOffset).
+    ImDrawIdxFormat_U32                     = 1     // 32-bit indices with all vertex offsets applied. Draw each command with a base vertex of 0 (for graphics API without base vertex, or meshes larger than 64K vertices).
+};
+
 // All draw data to render a Dear ImGui frame
 // (NB: the style and the naming convention here is a little inconsistent, we currently preserve them for backward compatibility purpose,
 // as this is one of the oldest structure exposed by the library! Basically, ImDrawList == CmdList)
@@ -2628,16 +2927,21 @@ struct ImDrawData
     int             CmdListsCount;          // Number of ImDrawList* to render
     int             TotalIdxCount;          // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int             TotalVtxCount;          // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int             TotalQuadCount;         // For convenience, sum of all ImDrawList's QuadBuffer.Size (always 0 unless 'ImGuiBackendFlags_RendererHasInstancedQuads' is set)
     ImDrawList**    CmdLists;               // Array of ImDrawList* to render. The ImDrawList are owned by ImGuiContext and only pointed to from here.
     ImVec2          DisplayPos;             // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2          DisplaySize;            // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
+    int             DamageRectsCount;       // Number of rectangles in DamageRects[]. -1 when not computed (io.ConfigDrawDataDamageRects == false): assume everything changed. 0 when nothing changed since last frame.
+    ImVec4*         DamageRects;            // Rectangles (x1, y1, x2, y2) in display coordinates, covering all areas whose draw output changed since last frame. Changes in contents of textures are not tracked.
 
     // Functions
     ImDrawData()    { Clear(); }
     void Clear()    { memset(this, 0, sizeof(*this)); }     // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API int   Optimize();                             // Helper to reduce the number of draw calls after Render(): drop empty/fully clipped ImDrawCmd, merge consecutive ImDrawCmd sharing the same texture and clip rectangle (including across ImDrawList). Return number of ImDrawCmd removed. Modifies the draw lists in place: lists owned by the context (e.g. GetWindowDrawList()) may receive the output of following lists, and don't match their window until the next frame.
+    IMGUI_API void  CopyToBuffers(void* vtx_dst, void* idx_dst, ImDrawIdxFormat fmt = ImDrawIdxFormat_Native, int cmd_lists_begin = 0, int cmd_lists_end = -1) const; // Helper to copy vertices/indices of all draw lists into contiguous buffers (TotalVtxCount vertices, TotalIdxCount indices), e.g. mapped upload buffers. Ranges of draw lists may be copied in parallel.
 };
 
 //-----------------------------------------------------------------------------
@@ -2663,6 +2967,7 @@ struct ImFontConfig
     unsigned int    FontBuilderFlags;       // 0        // Settings for custom font builder. THIS IS BUILDER IMPLEMENTATION DEPENDENT. Leave as zero if unsure.
     float           RasterizerMultiply;     // 1.0f     // Brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable.
     ImWchar         EllipsisChar;           // -1       // Explicitly specify unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            SignedDistanceField;    // false    // Store glyphs as signed distance fields instead of coverage, so a single bake stays sharp at any scale (ImFont::Scale, SetWindowFontScale()). Bake at a large SizePixels (e.g. 32-48). Requires the stb_truetype builder and a renderer setting ImGuiBackendFlags_RendererHasSdfText. OversampleH/V and RasterizerMultiply are ignored.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -2712,13 +3017,21 @@ struct ImFontAtlasCustomRect
     bool IsPacked() const           { return X != 0xFFFF; }
 };
 
+// See ImFontAtlas::TexDirtyRects.
+struct ImFontAtlasDirtyRect
+{
+    unsigned short  X, Y;           // Position in texture, in pixels
+    unsigned short  Width, Height;  // Size, in pixels
+};
+
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2    // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 3    // Only rasterize glyphs the first time they are used, recycling least recently used ones when the texture is full. Requires the stb_truetype builder. See 'Dynamic glyphs' below.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2738,6 +3051,25 @@ enum ImFontAtlasFlags_
 //   You can set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed,
 // - Even though many functions are suffixed with "TTF", OTF data is supported just as well.
 // - This is an old API and it is currently awkward for those and and various other reasons! We will address them in the future!
+// Dynamic glyphs (ImFontAtlasFlags_DynamicGlyphs):
+// - Build() only computes glyph metrics (so text layout is unchanged and CalcTextSize() never rasterizes anything), and reserves
+//   TexDynamicHeight lines of texture under the regular contents (custom rectangles, mouse cursors, baked lines).
+// - ImFont::FindGlyph() rasterizes glyphs into that region the first time they are used. It may be called from worker threads building draw lists.
+// - NewFrame() evicts least recently used glyphs when the region is full. A glyph used during a frame keeps its texture coordinates until the next NewFrame().
+//   If no room can be found during a frame, the fallback glyph is rendered instead until NewFrame() frees some room.
+//   Only FindGlyph() marks glyphs as used, so geometry reused without tessellating text (ImGuiWindowFlags_RetainDrawList, ImDrawListCache) may refer to
+//   evicted glyphs: TexGeneration is incremented when it happens, which makes retained windows tessellate again and ImDrawListCache::IsStale() return true.
+// - The texture size never changes. After Render(), upload the regions listed in TexDirtyRects[] from TexPixelsAlpha8 (or TexPixelsRGBA32) then call ClearTexDirtyRects().
+// - Font data is read when rasterizing glyphs: ClearInputData() and ClearTexData() cannot be used.
+// Signed distance field glyphs (ImFontConfig::SignedDistanceField):
+// - They are packed under everything else (custom rectangles, mouse cursors, baked lines, regular glyphs), starting at texture coordinate V = TexUvSdfMinV.
+//   A renderer can tell them apart per pixel without splitting draw calls: no texel with V < TexUvSdfMinV is a distance field.
+// - A texel value of 128 (0.5f once normalized) lies on the glyph outline, and each step of 128 / TexSdfSpread is one texel of distance (higher is inside).
+//   The pixel shader converts the sampled alpha into coverage, then multiplies the vertex color by it:
+//      float dist = (texel.a * 255.0f - 128.0f) * (TexSdfSpread / 128.0f);                                 // Distance to the outline in texels
+//      float texels_per_pixel = max(length(dFdx(uv) * tex_size), length(dFdy(uv) * tex_size));
+//      float coverage = clamp(dist / texels_per_pixel + 0.5f, 0.0f, 1.0f);
+//   See ImFontSdfCalcCoverage() in imgui_internal.h for the CPU reference implementation.
 struct ImFontAtlas
 {
     IMGUI_API ImFontAtlas();
@@ -2764,6 +3096,16 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't built texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Baked cache: save the output of Build() to a file, and load it on next runs instead of rasterizing TTF/OTF data again.
+    // - Usage: 'if (!atlas->LoadBakedCache("fonts.bin")) { atlas->Build(); atlas->SaveBakedCache("fonts.bin"); }'
+    // - The file is keyed by the font data and all settings Build() depends on (ImFontConfig, glyph ranges, flags, custom rectangles).
+    //   Loading fails without modifying fonts when any of them changed, or when the file is truncated or corrupted: call Build() then.
+    // - Custom rectangles are restored at the same position: render your pixels into them after loading, as you would after Build().
+    // - Data is stored in native byte order. Not supported with ImFontAtlasFlags_DynamicGlyphs.
+    IMGUI_API bool              SaveBakedCache(const char* filename);                           // Call after Build() and before ClearInputData().
+    IMGUI_API bool              LoadBakedCache(const char* filename);                           // Call instead of Build(), after adding fonts.
+    IMGUI_API bool              LoadBakedCacheFromMemory(const void* data, size_t data_size);   // Same as LoadBakedCache(), e.g. from a memory-mapped file. Data is copied.
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2795,6 +3137,9 @@ struct ImFontAtlas
     IMGUI_API int               AddCustomRectFontGlyph(ImFont* font, ImWchar id, int width, int height, float advance_x, const ImVec2& offset = ImVec2(0, 0));
     ImFontAtlasCustomRect*      GetCustomRectByIndex(int index) { IM_ASSERT(index >= 0); return &CustomRects[index]; }
 
+    // Texture updates (ImFontAtlasFlags_DynamicGlyphs)
+    void                        ClearTexDirtyRects()            { TexDirtyRects.resize(0); } // Call after uploading TexDirtyRects[] to your texture.
+
     // [Internal]
     IMGUI_API void              CalcCustomRectUV(const ImFontAtlasCustomRect* rect, ImVec2* out_uv_min, ImVec2* out_uv_max) const;
     IMGUI_API bool              GetMouseCursorTexData(ImGuiMouseCursor cursor, ImVec2* out_offset, ImVec2* out_size, ImVec2 out_uv_border[2], ImVec2 out_uv_fill[2]);
@@ -2807,7 +3152,13 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
+    int                         TexDynamicHeight;   // Height of the texture region holding glyphs rasterized on demand with ImFontAtlasFlags_DynamicGlyphs. 0 = TexWidth / 2. Any extra space from rounding TexHeight to a power of two is also used.
+    int                         TexSdfSpread;       // Distance in texels encoded around the outline of signed distance field glyphs, which are padded by as much. Defaults to 4. Larger values allow effects (outlines, glow) and heavier downscaling.
+    ImFontAtlasParallelForFunc  BuildParallelFor;   // Optional. Build() calls it to rasterize glyphs on multiple threads: it must call job_func(job_data, n) for every n in [0, job_count), in any order and from any thread, and return once all calls completed. Output is identical to a serial build. Memory allocators must be thread-safe.
+    void*                       BuildParallelForUserData; // Passed to BuildParallelFor
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
+    ImVector<ImFontAtlasDirtyRect> TexDirtyRects;   // Regions of the texture which changed since the last call to ClearTexDirtyRects() (ImFontAtlasFlags_DynamicGlyphs). Pitch = TexWidth * BytesPerPixel.
+    int                         TexGeneration;      // Incremented when texture coordinates of glyphs used before may have changed: by Build() and LoadBakedCache(), and by NewFrame() when glyphs are evicted or couldn't be rasterized (ImFontAtlasFlags_DynamicGlyphs). Geometry reused across frames (ImGuiWindowFlags_RetainDrawList, ImDrawListCache) needs to be rebuilt.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2819,6 +3170,7 @@ struct ImFontAtlas
     int                         TexHeight;          // Texture height calculated during Build().
     ImVec2                      TexUvScale;         // = (1.0f/TexWidth, 1.0f/TexHeight)
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
+    float                       TexUvSdfMinV;       // Texture coordinate V where signed distance field glyphs start (ImFontConfig::SignedDistanceField). FLT_MAX when the atlas has none.
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
@@ -2832,25 +3184,76 @@ struct ImFontAtlas
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
 
+    // [Internal] Glyphs rasterized on demand
+    ImFontAtlasDynamicGlyphs*   DynamicGlyphs;      // Cache state, created by Build() when using ImFontAtlasFlags_DynamicGlyphs
+
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
     //typedef ImFontGlyphRangesBuilder GlyphRangesBuilder; // OBSOLETED in 1.67+
 };
 
+// An entry of ImFontTextSizeCache
+struct ImFontTextSizeCacheEntry
+{
+    ImGuiID         Key;                // Hash of the text, seeded with FontSize and WrapWidth
+    int             TextOffset;         // Copy of the text in ImFontTextSizeCache::TextBuffer[], compared on lookup as different texts may share the same Key
+    int             TextLen;
+    float           FontSize;
+    float           WrapWidth;
+    int             LastUsedFrame;
+    ImVec2          Size;               // Output of ImFont::CalcTextSizeA(), before rounding
+};
+
+// Optional cache of text sizes measured by ImGui::CalcTextSize(), which is called for the same labels many times per frame and again every frame.
+// - Enable with e.g. 'io.Fonts->Fonts[0]->TextSizeCache.Enabled = true'. Entries are keyed by (hash of the text, font size, wrap width),
+//   and keep a copy of the text which is compared before returning a size.
+// - Each call to NewFrame() starts a new frame: entries not used during the last MaxAge frames are evicted.
+// - Only ImGui::CalcTextSize() reads and writes it. ImFont::CalcTextSizeA() doesn't use it, so ImDrawList functions (which measure text
+//   for wrapping and clipping) are still safe to call from worker threads. Don't enable it on a font shared by contexts updated on different threads.
+// - Cleared when the font is rebuilt. Call Clear() if you modify glyph advances yourself.
+struct ImFontTextSizeCache
+{
+    bool            Enabled;            // false    // Set to use the cache.
+    int             MaxAge;             // 60       // Evict entries not used during that many frames.
+    int             MinTextLen;         // 8        // Measure texts shorter than this (in bytes) directly unless they are wrapped: it is about as fast as a lookup.
+    int             Hits;               // out      // Number of ImGui::CalcTextSize() calls which found their entry (since the last call to ClearStats()).
+    int             Misses;             // out      // Number of ImGui::CalcTextSize() calls which measured the text and added an entry (short texts bypassing the cache are not counted).
+
+    // [Internal]
+    int             Frame;              // Incremented by NewFrame()
+    int             LastSweepFrame;
+    int             SweepSize;          // Entries.Size after the last eviction pass
+    ImVector<ImFontTextSizeCacheEntry> Entries;
+    ImVector<char>  TextBuffer;         // Texts of Entries[], compacted when evicting entries
+    ImGuiStorage    Map;                // Key -> index into Entries[]
+
+    ImFontTextSizeCache()               { Enabled = false; MaxAge = 60; MinTextLen = 8; Hits = Misses = 0; Frame = LastSweepFrame = SweepSize = 0; }
+    void            Clear()             { Entries.clear(); TextBuffer.clear(); Map.Clear(); SweepSize = 0; }
+    void            ClearStats()        { Hits = Misses = 0; }
+    float           GetHitRate() const  { return (Hits + Misses > 0) ? (float)Hits / (float)(Hits + Misses) : 0.0f; }
+};
+
 // Font runtime data and rendering
 // ImFontAtlas automatically loads a default embedded font for you when you call GetTexDataAsAlpha8() or GetTexDataAsRGBA32().
+// IndexAdvanceX[] and IndexLookup[] are paged: IndexPages[] maps each block of IM_FONT_INDEX_PAGE_SIZE code-points to a page of them.
+// Blocks without any glyph all map to page 0, which is shared and never written to, so large ImWchar32 ranges with few glyphs stay cheap.
+#define IM_FONT_INDEX_PAGE_SIZE     256
 struct ImFont
 {
-    // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    // Members: Hot ~32/40 bytes (for CalcTextSize)
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Paged. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI). Use GetIndexOffset().
+    ImVector<ImU16>             IndexPages;         // 12-16 // out //            // Page of IndexAdvanceX[]/IndexLookup[] used by each block of IM_FONT_INDEX_PAGE_SIZE code-points. 0 for blocks without glyphs.
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
 
     // Members: Hot ~28/40 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Paged. Index glyphs by Unicode code-point. Use GetIndexOffset().
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
 
+    // Members: Hot 512/1024 bytes (for render loop ASCII fast path)
+    const ImFontGlyph*          AsciiGlyphs[128];   // 512-1024 // out //         // Dense. = FindGlyph(c) for c < 128, so runs of ASCII skip the UTF-8 decoding and IndexLookup indirection. All NULL until built. Not used with ImFontAtlasFlags_DynamicGlyphs.
+
     // Members: Cold ~32/40 bytes
     ImFontAtlas*                ContainerAtlas;     // 4-8   // out //            // What we has been loaded into
     const ImFontConfig*         ConfigData;         // 4-8   // in  //            // Pointer within ContainerAtlas->ConfigData
@@ -2862,20 +3265,24 @@ struct ImFont
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
+    int                         DynamicGlyphsOffset;// 4     // out // = -1       // Index of the cache state of Glyphs[0] within ContainerAtlas->DynamicGlyphs. -1 unless built with ImFontAtlasFlags_DynamicGlyphs.
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImFontTextSizeCache         TextSizeCache;      //       // in/out //         // Optional cache used by ImGui::CalcTextSize() (disabled by default, see ImFontTextSizeCache)
 
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
-    IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
-    IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;                 // With ImFontAtlasFlags_DynamicGlyphs, rasterize the glyph if needed.
+    IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;       // With ImFontAtlasFlags_DynamicGlyphs, doesn't rasterize the glyph: use to query metrics or existence, UV are only valid after FindGlyph().
+    int                         GetIndexOffset(unsigned int c) const { const unsigned int block = c / IM_FONT_INDEX_PAGE_SIZE; return (block < (unsigned int)IndexPages.Size) ? (int)IndexPages.Data[block] * IM_FONT_INDEX_PAGE_SIZE + (int)(c % IM_FONT_INDEX_PAGE_SIZE) : -1; } // Offset of 'c' in IndexAdvanceX[] and IndexLookup[], -1 if past the end.
+    float                       GetCharAdvance(ImWchar c) const     { const int offset = GetIndexOffset(c); return (offset >= 0) ? IndexAdvanceX.Data[offset] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
     // 'max_width' stops rendering after a certain width (could be turned into a 2d size). FLT_MAX to disable.
     // 'wrap_width' enable automatic word-wrapping across multiple lines to fit into given width. 0.0f to disable.
     IMGUI_API ImVec2            CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end = NULL, const char** remaining = NULL) const; // utf8
+    IMGUI_API ImVec2            CalcTextSizeCached(float size, float wrap_width, const char* text_begin, const char* text_end);   // Same as CalcTextSizeA() with max_width = FLT_MAX, using TextSizeCache when enabled. Not thread-safe.
     IMGUI_API const char*       CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const;
     IMGUI_API void              RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, ImWchar c) const;
     IMGUI_API void              RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width = 0.0f, bool cpu_fine_clip = false) const;
@@ -2883,7 +3290,8 @@ struct ImFont
     // [Internal] Don't use!
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
-    IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API void              GrowIndex(int new_size);                    // Map blocks of code-points up to 'new_size' (new blocks use the shared empty page 0)
+    IMGUI_API int               AllocIndexPage(unsigned int c);             // Give the block of 'c' its own page if it was using page 0, return GetIndexOffset(c)
     IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
@@ -468,6 +468,8 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::Checkbox("io.ConfigWindowsResizeFromEdges", &io.ConfigWindowsResizeFromEdges);
             ImGui::SameLine(); HelpMarker("Enable resizing of windows from their edges and from the lower-left corner.\nThis requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback.");
             ImGui::Checkbox("io.ConfigWindowsMoveFromTitleBarOnly", &io.ConfigWindowsMoveFromTitleBarOnly);
+            ImGui::Checkbox("io.ConfigDrawDataDamageRects", &io.ConfigDrawDataDamageRects);
+            ImGui::SameLine(); HelpMarker("Compute ImDrawData::DamageRects[] in Render(), covering the areas of the display which changed since last frame.\nBackends may use them for partial presentation, or skip rendering when nothing changed.");
             ImGui::Checkbox("io.MouseDrawCursor", &io.MouseDrawCursor);
             ImGui::SameLine(); HelpMarker("Instruct Dear ImGui to render a mouse cursor itself. Note that a mouse cursor rendered via your application GPU rendering path will feel more laggy than hardware cursor, but will be more in sync with your other visuals.\n\nSome desktop applications may use both kinds of cursors (e.g. enable software cursor only when resizing/dragging something).");
             ImGui::Text("Also see Style->Rendering for rendering options.");
@@ -988,6 +990,35 @@ static void ShowDemoWindowWidgets()
             ImGui::InputText("UTF-8 input", buf, IM_ARRAYSIZE(buf));
             ImGui::TreePop();
         }
+
+        IMGUI_DEMO_MARKER("Widgets/Text/Text View");
+        if (ImGui::TreeNode("Text View"))
+        {
+            // TextView() displays a large read-only text without copying it: only the new bytes are indexed when text is appended,
+            // and only visible lines are measured and rendered every frame.
+            static ImGuiTextBuffer log;
+            static ImGuiTextView view;
+            static bool word_wrap = false;
+            static bool auto_scroll = true;
+            HelpMarker("Only visible lines are measured and rendered, try adding a few megabytes of text.\nSelect with the mouse, use CTRL+A and CTRL+C to copy.");
+            ImGui::Checkbox("Word wrap", &word_wrap); ImGui::SameLine();
+            ImGui::Checkbox("Auto-scroll", &auto_scroll); ImGui::SameLine();
+            int lines_to_add = 0;
+            if (ImGui::Button("Add 10 lines")) lines_to_add = 10; ImGui::SameLine();
+            if (ImGui::Button("Add 100000 lines")) lines_to_add = 100000; ImGui::SameLine();
+            if (ImGui::Button("Clear")) { log.clear(); view.Clear(); }
+            for (int n = 0; n < lines_to_add; n++)
+                log.appendf("[%05d] Hello, current time is %.1f, here's a word: '%s'%s\n", view.GetLineCount() - 1 + n, ImGui::GetTime(), (n & 1) ? "world" : "text",
+                    (n % 7) ? "" : " and a longer sentence which may need to be wrapped when the view is narrow enough.");
+            view.SetText(log.begin(), log.size()); // ImGuiTextBuffer may move its contents when growing: pass the current pointer every frame
+            ImGui::Text("%d lines, %.2f MB", view.GetLineCount(), log.size() / (1024.0f * 1024.0f));
+
+            ImGuiTextViewFlags flags = ImGuiTextViewFlags_Border;
+            if (word_wrap)   flags |= ImGuiTextViewFlags_WordWrap;
+            if (auto_scroll) flags |= ImGuiTextViewFlags_AutoScroll;
+            ImGui::TextView("##view", &view, ImVec2(0.0f, ImGui::GetTextLineHeight() * 16), flags);
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 
@@ -1484,6 +1515,30 @@ static void ShowDemoWindowWidgets()
             ImGui::TreePop();
         }
 
+        IMGUI_DEMO_MARKER("Widgets/Text Input/Large Text Editing");
+        if (ImGui::TreeNode("Large Text Editing"))
+        {
+            // ImGuiTextEditBuffer holds the text being edited, so InputTextMultiline() doesn't convert and scan it all every frame.
+            // Retrieve the text as UTF-8 with GetText() when you need it (e.g. when saving), not every frame.
+            static ImGuiTextEditBuffer edit_buf;
+            static bool initialized = false;
+            HelpMarker("Edits, cursor moves and rendering only touch the visible lines and the text around the cursor, try adding a few megabytes of text.");
+            int lines_to_add = initialized ? 0 : 100;
+            if (ImGui::Button("Add 100000 lines")) lines_to_add = 100000; ImGui::SameLine();
+            if (ImGui::Button("Clear")) edit_buf.Clear();
+            if (lines_to_add > 0)
+            {
+                ImGuiTextBuffer lines;
+                for (int n = 0; n < lines_to_add; n++)
+                    lines.appendf("%d: The quick brown fox jumps over the lazy dog.\n", edit_buf.GetLineCount() + n);
+                edit_buf.Insert(edit_buf.GetLength(), lines.begin(), lines.end());
+                initialized = true;
+            }
+            ImGui::Text("%d lines, %.2f MB", edit_buf.GetLineCount(), edit_buf.TextSizeA / (1024.0f * 1024.0f));
+            ImGui::InputTextMultiline("##large", &edit_buf, ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 16), ImGuiInputTextFlags_AllowTabInput);
+            ImGui::TreePop();
+        }
+
         ImGui::TreePop();
     }
 
@@ -5956,6 +6011,9 @@ void ImGui::ShowAboutWindow(bool* p_open)
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
         ImGui::Text("define: IMGUI_USE_BGRA_PACKED_COLOR");
 #endif
+#ifdef IMGUI_USE_CRC32C
+        ImGui::Text("define: IMGUI_USE_CRC32C");
+#endif
 #ifdef _WIN32
         ImGui::Text("define: _WIN32");
 #endif
@@ -6002,6 +6060,7 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigDrawDataDamageRects)                               ImGui::Text("io.ConfigDrawDataDamageRects");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
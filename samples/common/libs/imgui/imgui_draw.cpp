@@ -9,10 +9,13 @@ Index of this file:
 // [SECTION] Style functions
 // [SECTION] ImDrawList
 // [SECTION] ImDrawListSplitter
+// [SECTION] ImDrawListCache
 // [SECTION] ImDrawData
+// [SECTION] ImDrawDataDamageTracker
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas
+// [SECTION] ImFontAtlas baked cache
 // [SECTION] ImFontAtlas glyph ranges helpers
 // [SECTION] ImFontGlyphRangesBuilder
 // [SECTION] ImFont
@@ -398,6 +401,104 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+// Fingerprinting, used by ImGuiWindowFlags_RetainDrawList
+// - When ImDrawListFlags_Fingerprint is set, the parameters of submitted primitives are hashed into _Fingerprint, so that two frames
+//   submitting the same primitives end up with the same fingerprint.
+// - Each primitive then calls ImDrawListFingerprintSkip(), which records the fingerprint and the size of the output so far (ImDrawListRetainPoint).
+// - When ImDrawListFlags_FingerprintOnly is also set, primitives are not tessellated as long as the fingerprint matches the one recorded at
+//   the same point of the retained output. At the first difference, tessellation resumes in an empty draw list, and
+//   ImGuiWindowRetainedDrawList::RestoreOutput() later copies the retained output up to that point in front of it.
+// - Output following ImDrawListSplitter::Split() or AddDrawListDeferred() is reordered or appended at the end of the buffers, so it can't be
+//   copied from the retained output: tessellation always resumes there (see ImDrawListFingerprintStop()).
+// - Hooks are placed on the functions doing the actual tessellation (AddPolyline(), AddConvexPolyFilled(), AddText() etc.), which
+//   covers the higher-level functions building paths. Vertices written directly after PrimReserve() are not part of the fingerprint:
+//   when PrimReserve() is called while only computing the fingerprint, tessellation resumes and the window is fully tessellated on the next frame.
+static inline void ImDrawListFingerprint(ImDrawList* draw_list, const void* data, size_t data_size)
+{
+    draw_list->_Fingerprint = ImHashData(data, data_size, draw_list->_Fingerprint);
+}
+
+static void ImDrawListFingerprintRecord(ImDrawList* draw_list)
+{
+    ImDrawListRetainPoint point;
+    point.Fingerprint = draw_list->_Fingerprint;
+    point.CmdCount = draw_list->CmdBuffer.Size;
+    point.IdxCount = draw_list->IdxBuffer.Size;
+    point.VtxCount = draw_list->VtxBuffer.Size;
+    point.QuadCount = draw_list->QuadBuffer.Size;
+    point.LastCmd = draw_list->CmdBuffer.back();
+    draw_list->_Retained->PointsNext.push_back(point);
+}
+
+// Resume tessellation in an empty draw list. The output up to Points[PointsMatched] is copied from the retained output by RestoreOutput().
+static void ImDrawListFingerprintResume(ImDrawList* draw_list)
+{
+    ImGuiWindowRetainedDrawList* retained = draw_list->_Retained;
+    IM_ASSERT(draw_list->VtxBuffer.Size == 0 && draw_list->IdxBuffer.Size == 0 && draw_list->QuadBuffer.Size == 0);
+    IM_ASSERT(draw_list->_DeferredDrawLists.Size == 0);
+    draw_list->Flags &= ~ImDrawListFlags_FingerprintOnly;
+    retained->ResumePoint = retained->PointsMatched;
+    retained->PointsStopped = true;
+    draw_list->CmdBuffer.resize(0);
+    draw_list->_CmdHeader.VtxOffset = 0;
+    draw_list->_VtxCurrentIdx = 0;
+    draw_list->AddDrawCmd();
+    draw_list->_VtxWritePtr = draw_list->VtxBuffer.Data;
+    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data;
+}
+
+// Called by primitives after hashing their parameters, when ImDrawListFlags_Fingerprint is set. Return true if their output can be skipped.
+static bool ImDrawListFingerprintSkip(ImDrawList* draw_list)
+{
+    ImGuiWindowRetainedDrawList* retained = draw_list->_Retained;
+    if (retained == NULL)
+        return (draw_list->Flags & ImDrawListFlags_FingerprintOnly) != 0;
+    if (!(draw_list->Flags & ImDrawListFlags_FingerprintOnly))
+    {
+        if (!retained->PointsStopped)
+            ImDrawListFingerprintRecord(draw_list);
+        return false;
+    }
+    if (retained->PointsMatched < retained->Points.Size && retained->Points.Data[retained->PointsMatched].Fingerprint == draw_list->_Fingerprint)
+    {
+        retained->PointsMatched++;
+        return true;
+    }
+    ImDrawListFingerprintResume(draw_list);
+    return false;
+}
+
+// Called by PrimReserve()/PrimReserveQuads() while only computing the fingerprint: the caller is going to write vertices which are not part of
+// the fingerprint, so the retained output can't be trusted. Output them, and don't reuse the retained output on the next frame.
+static void ImDrawListFingerprintUntracked(ImDrawList* draw_list)
+{
+    ImGuiWindowRetainedDrawList* retained = draw_list->_Retained;
+    if (retained == NULL)
+    {
+        draw_list->Flags &= ~ImDrawListFlags_FingerprintOnly;
+        return;
+    }
+    ImDrawListFingerprintResume(draw_list);
+    retained->Valid = retained->Stable = false;
+}
+
+// Called when following output can't be copied from the retained output.
+static void ImDrawListFingerprintStop(ImDrawList* draw_list)
+{
+    ImGuiWindowRetainedDrawList* retained = draw_list->_Retained;
+    if (retained == NULL)
+        return;
+    if (draw_list->Flags & ImDrawListFlags_FingerprintOnly)
+    {
+        ImDrawListFingerprintResume(draw_list);
+    }
+    else if (!retained->PointsStopped)
+    {
+        ImDrawListFingerprintRecord(draw_list);
+        retained->PointsStopped = true;
+    }
+}
+
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 void ImDrawList::_ResetForNewFrame()
 {
@@ -409,6 +510,7 @@ void ImDrawList::_ResetForNewFrame()
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    QuadBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -420,6 +522,9 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+    _Fingerprint = 0;
+    _Retained = NULL;
+    _DeferredDrawLists.resize(0);
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -427,6 +532,7 @@ void ImDrawList::_ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    QuadBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -435,6 +541,8 @@ void ImDrawList::_ClearFreeMemory()
     _TextureIdStack.clear();
     _Path.clear();
     _Splitter.ClearFreeMemory();
+    _Retained = NULL;
+    _DeferredDrawLists.clear();
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
@@ -443,10 +551,21 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    dst->QuadBuffer = QuadBuffer;
     dst->Flags = Flags;
+    dst->_DeferredDrawLists = _DeferredDrawLists;
     return dst;
 }
 
+// Same setup as the draw list of a window, for draw lists created by the user (e.g. to be filled on a worker thread then passed to AddDrawListDeferred())
+void ImDrawList::ResetForNewFrame()
+{
+    _ResetForNewFrame();
+    if (_Data->Font != NULL)
+        PushTextureID(_Data->Font->ContainerAtlas->TexID);
+    PushClipRectFullScreen();
+}
+
 void ImDrawList::AddDrawCmd()
 {
     ImDrawCmd draw_cmd;
@@ -454,6 +573,7 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.TextureId = _CmdHeader.TextureId;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
     draw_cmd.IdxOffset = IdxBuffer.Size;
+    draw_cmd.QuadOffset = QuadBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
     CmdBuffer.push_back(draw_cmd);
@@ -466,16 +586,24 @@ void ImDrawList::_PopUnusedDrawCmd()
     if (CmdBuffer.Size == 0)
         return;
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount == 0 && curr_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0 && curr_cmd->UserCallback == NULL)
         CmdBuffer.pop_back();
 }
 
 void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
 {
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        ImDrawListFingerprint(this, &callback, sizeof(callback));
+        ImDrawListFingerprint(this, &callback_data, sizeof(callback_data));
+        if (ImDrawListFingerprintSkip(this))
+            return;
+    }
+
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     IM_ASSERT(curr_cmd->UserCallback == NULL);
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0)
     {
         AddDrawCmd();
         curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
@@ -486,11 +614,32 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
 
+// Placeholder command for AddDrawListDeferred(), replaced by ResolveDeferredDrawLists(). Never seen by renderer backends.
+#define ImDrawCallback_DeferredDrawList     (ImDrawCallback)(-2)
+
+// This only records a pointer: 'draw_list' may still be built on another thread until ResolveDeferredDrawLists() is called.
+// Its contents are fingerprinted when resolved, here we only hash the position of submission (draw lists are often allocated per frame).
+void ImDrawList::AddDrawListDeferred(const ImDrawList* draw_list)
+{
+    IM_ASSERT(draw_list != NULL && draw_list != this);
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        ImDrawListFingerprint(this, &_DeferredDrawLists.Size, sizeof(_DeferredDrawLists.Size));
+        ImDrawListFingerprintStop(this);
+    }
+    const ImDrawListFlags backup_flags = Flags;
+    Flags &= ~ImDrawListFlags_Fingerprint;
+    AddCallback(ImDrawCallback_DeferredDrawList, (void*)draw_list);
+    Flags = backup_flags;
+    _DeferredDrawLists.push_back(draw_list);
+}
+
 // Compare ClipRect, TextureId and VtxOffset with a single memcmp()
 #define ImDrawCmd_HeaderSize                            (IM_OFFSETOF(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
 #define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
 #define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
 #define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset)
+#define ImDrawCmd_AreSequentialQuadOffset(CMD_0, CMD_1) ((CMD_0->QuadCount == 0) ? (CMD_1->QuadCount == 0) : (CMD_1->ElemCount == 0 && CMD_0->QuadOffset + CMD_0->QuadCount == CMD_1->QuadOffset)) // Also false when mixing triangles and quads
 
 // Try to merge two last draw commands
 void ImDrawList::_TryMergeDrawCmds()
@@ -498,9 +647,10 @@ void ImDrawList::_TryMergeDrawCmds()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
+    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && ImDrawCmd_AreSequentialQuadOffset(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
     {
         prev_cmd->ElemCount += curr_cmd->ElemCount;
+        prev_cmd->QuadCount += curr_cmd->QuadCount;
         CmdBuffer.pop_back();
     }
 }
@@ -509,10 +659,13 @@ void ImDrawList::_TryMergeDrawCmds()
 // The cost of figuring out if a new command has to be added or if we can merge is paid in those Update** functions only.
 void ImDrawList::_OnChangedClipRect()
 {
+    if (Flags & ImDrawListFlags_Fingerprint)
+        ImDrawListFingerprint(this, &_CmdHeader.ClipRect, sizeof(_CmdHeader.ClipRect));
+
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0) && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
     {
         AddDrawCmd();
         return;
@@ -521,7 +674,7 @@ void ImDrawList::_OnChangedClipRect()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -532,10 +685,13 @@ void ImDrawList::_OnChangedClipRect()
 
 void ImDrawList::_OnChangedTextureID()
 {
+    if (Flags & ImDrawListFlags_Fingerprint)
+        ImDrawListFingerprint(this, &_CmdHeader.TextureId, sizeof(_CmdHeader.TextureId));
+
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && curr_cmd->TextureId != _CmdHeader.TextureId)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0) && curr_cmd->TextureId != _CmdHeader.TextureId)
     {
         AddDrawCmd();
         return;
@@ -544,7 +700,7 @@ void ImDrawList::_OnChangedTextureID()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -560,7 +716,7 @@ void ImDrawList::_OnChangedVtxOffset()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     //IM_ASSERT(curr_cmd->VtxOffset != _CmdHeader.VtxOffset); // See #3349
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0)
     {
         AddDrawCmd();
         return;
@@ -630,6 +786,9 @@ void ImDrawList::PopTextureID()
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    if (Flags & ImDrawListFlags_FingerprintOnly)
+        ImDrawListFingerprintUntracked(this);
+
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
@@ -642,6 +801,11 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     }
 
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->QuadCount != 0)
+    {
+        AddDrawCmd();
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
@@ -664,17 +828,351 @@ void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
     IdxBuffer.shrink(IdxBuffer.Size - idx_count);
 }
 
+// Reserve space for a number of instanced quads (ImDrawListFlags_InstancedQuads), appended to the current command unless it holds triangles.
+// Commands of different channels share QuadBuffer[], so we also need a new command when another channel appended quads in the meanwhile.
+ImDrawQuad* ImDrawList::PrimReserveQuads(int quad_count)
+{
+    if (Flags & ImDrawListFlags_FingerprintOnly)
+        ImDrawListFingerprintUntracked(this);
+    IM_ASSERT_PARANOID(quad_count >= 0);
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->ElemCount != 0 || (draw_cmd->QuadCount != 0 && draw_cmd->QuadOffset + draw_cmd->QuadCount != (unsigned int)QuadBuffer.Size))
+    {
+        AddDrawCmd();
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
+    else if (draw_cmd->QuadCount == 0)
+    {
+        draw_cmd->QuadOffset = QuadBuffer.Size;
+    }
+    draw_cmd->QuadCount += quad_count;
+
+    int quad_buffer_old_size = QuadBuffer.Size;
+    QuadBuffer.resize(quad_buffer_old_size + quad_count);
+    return QuadBuffer.Data + quad_buffer_old_size;
+}
+
+// Release a number of reserved quads from the end of the last reservation made with PrimReserveQuads().
+void ImDrawList::PrimUnreserveQuads(int quad_count)
+{
+    IM_ASSERT_PARANOID(quad_count >= 0);
+
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    draw_cmd->QuadCount -= quad_count;
+    QuadBuffer.shrink(QuadBuffer.Size - quad_count);
+}
+
+// Convert all instanced quads into indexed triangles, which is the reference for what renderer backends supporting
+// ImGuiBackendFlags_RendererHasInstancedQuads are expected to draw. Called by Render() for other backends.
+// - Commands are kept in order and rendered the same, but expanded geometry is appended at the end of VtxBuffer/IdxBuffer:
+//   renderers need to use ImDrawCmd::IdxOffset (and not assume that commands consume indices sequentially).
+// - Quads are replayed through PrimReserve(), so large commands may be split and use ImDrawCmd::VtxOffset like regular output.
+// - Rounded quads (ImDrawListFlags_SdfShapes) are tessellated the same way as AddRectFilled()/AddImageRounded()/AddCircleFilled() would.
+void ImDrawList::ExpandInstancedQuads()
+{
+    if (QuadBuffer.Size == 0)
+        return;
+    IM_ASSERT(_Splitter._Count <= 1 && "Cannot expand instanced quads while channels are split!");
+
+    ImVector<ImDrawCmd> src_cmd_buffer;
+    ImVector<ImDrawQuad> src_quad_buffer;
+    src_cmd_buffer.swap(CmdBuffer);
+    src_quad_buffer.swap(QuadBuffer);
+    CmdBuffer.reserve(src_cmd_buffer.Size);
+
+    const ImDrawCmdHeader backup_cmd_header = _CmdHeader;
+    const ImDrawListFlags backup_flags = Flags;
+    Flags &= ~(ImDrawListFlags_InstancedQuads | ImDrawListFlags_SdfShapes | ImDrawListFlags_Fingerprint | ImDrawListFlags_FingerprintOnly);
+    for (int cmd_n = 0; cmd_n < src_cmd_buffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* src_cmd = &src_cmd_buffer.Data[cmd_n];
+        if (src_cmd->QuadCount == 0)
+        {
+            CmdBuffer.push_back(*src_cmd);
+            continue;
+        }
+        ImDrawCmd_HeaderCopy(&_CmdHeader, src_cmd);
+        _VtxCurrentIdx = (unsigned int)VtxBuffer.Size - _CmdHeader.VtxOffset;
+        AddDrawCmd();
+
+        const ImDrawQuad* quad = src_quad_buffer.Data + src_cmd->QuadOffset;
+        const ImDrawQuad* quad_end = quad + src_cmd->QuadCount;
+        while (quad < quad_end)
+        {
+            if (quad->Rounding > 0.0f)
+            {
+                const int vtx_start_idx = VtxBuffer.Size;
+                if (quad->Rounding * 2.0f >= quad->Max.x - quad->Min.x && quad->Max.x - quad->Min.x == quad->Max.y - quad->Min.y && (quad->Flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersAll)
+                {
+                    // Same as AddCircleFilled() with automatic segment count
+                    _PathArcToFastEx((quad->Min + quad->Max) * 0.5f, quad->Rounding, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
+                    _Path.Size--;
+                }
+                else
+                {
+                    PathRect(quad->Min, quad->Max, quad->Rounding, quad->Flags);
+                }
+                PathFillConvex(quad->Col);
+                if (quad->UvMin.x != quad->UvMax.x || quad->UvMin.y != quad->UvMax.y)
+                    ImGui::ShadeVertsLinearUV(this, vtx_start_idx, VtxBuffer.Size, quad->Min, quad->Max, quad->UvMin, quad->UvMax, true);
+                quad++;
+                continue;
+            }
+
+            // Batch consecutive plain quads, keeping each reservation well below 64K vertices so PrimReserve() can move VtxOffset when needed
+            const ImDrawQuad* quad_run_end = quad + 1;
+            while (quad_run_end < quad_end && quad_run_end->Rounding <= 0.0f && quad_run_end - quad < 8192)
+                quad_run_end++;
+            const int quad_count = (int)(quad_run_end - quad);
+            PrimReserve(quad_count * 6, quad_count * 4);
+            for (; quad < quad_run_end; quad++)
+                PrimRectUV(quad->Min, quad->Max, quad->UvMin, quad->UvMax, quad->Col);
+        }
+    }
+    Flags = backup_flags;
+    _CmdHeader = backup_cmd_header;
+    _OnChangedCmdBuffer();
+}
+
+// Copy the output of draw lists submitted with AddDrawListDeferred() in place of their placeholder command.
+// - Commands are inserted in order, but their vertices/indices/quads are appended at the end of our buffers: renderers need to use ImDrawCmd::IdxOffset.
+// - With ImDrawListFlags_AllowVtxOffset the copied commands use ImDrawCmd::VtxOffset, otherwise their indices are rebased (and the total number of vertices needs to fit in ImDrawIdx).
+// - With ImDrawListFlags_Fingerprint the output of submitted draw lists is hashed, as this is the only way for a retained window to notice them changing.
+//   With ImDrawListFlags_FingerprintOnly nothing is copied (a retained window always resumes tessellation in AddDrawListDeferred(), so this doesn't happen for them).
+void ImDrawList::ResolveDeferredDrawLists()
+{
+    if (_DeferredDrawLists.Size == 0)
+        return;
+    IM_ASSERT(_Splitter._Count <= 1 && "Cannot resolve deferred draw lists while channels are split!");
+
+    // Hash in order of submission, which doesn't depend on the use of channels
+    if (Flags & ImDrawListFlags_Fingerprint)
+        for (int list_n = 0; list_n < _DeferredDrawLists.Size; list_n++)
+        {
+            const ImDrawList* src_list = _DeferredDrawLists.Data[list_n];
+            for (const ImDrawCmd* src_cmd = src_list->CmdBuffer.begin(); src_cmd != src_list->CmdBuffer.end(); src_cmd++)
+            {
+                ImDrawListFingerprint(this, src_cmd, IM_OFFSETOF(ImDrawCmd, QuadCount) + sizeof(src_cmd->QuadCount)); // Up to padding before UserCallback
+                ImDrawListFingerprint(this, &src_cmd->UserCallback, sizeof(src_cmd->UserCallback));
+                ImDrawListFingerprint(this, &src_cmd->UserCallbackData, sizeof(src_cmd->UserCallbackData));
+            }
+            ImDrawListFingerprint(this, src_list->VtxBuffer.Data, src_list->VtxBuffer.size_in_bytes());
+            ImDrawListFingerprint(this, src_list->IdxBuffer.Data, src_list->IdxBuffer.size_in_bytes());
+            ImDrawListFingerprint(this, src_list->QuadBuffer.Data, src_list->QuadBuffer.size_in_bytes());
+        }
+
+    ImVector<ImDrawCmd> old_cmd_buffer;
+    old_cmd_buffer.swap(CmdBuffer);
+    CmdBuffer.reserve(old_cmd_buffer.Size);
+    int resolved_count = 0;
+    for (const ImDrawCmd* placeholder_cmd = old_cmd_buffer.begin(); placeholder_cmd != old_cmd_buffer.end(); placeholder_cmd++)
+    {
+        if (placeholder_cmd->UserCallback != ImDrawCallback_DeferredDrawList)
+        {
+            CmdBuffer.push_back(*placeholder_cmd);
+            continue;
+        }
+        resolved_count++;
+        if (Flags & ImDrawListFlags_FingerprintOnly)
+            continue;
+
+        const ImDrawList* src_list = (const ImDrawList*)placeholder_cmd->UserCallbackData;
+        IM_ASSERT(src_list->_DeferredDrawLists.Size == 0 && "Draw lists submitted with AddDrawListDeferred() need to be resolved first!");
+        IM_ASSERT((src_list->QuadBuffer.Size == 0 || (Flags & ImDrawListFlags_InstancedQuads)) && "Instanced quads can only be copied into a draw list using ImDrawListFlags_InstancedQuads. Use the same flags as the draw lists of the context!");
+        const unsigned int vtx_base = (unsigned int)VtxBuffer.Size;
+        const unsigned int idx_base = (unsigned int)IdxBuffer.Size;
+        const unsigned int quad_base = (unsigned int)QuadBuffer.Size;
+        const bool use_vtx_offset = (Flags & ImDrawListFlags_AllowVtxOffset) != 0;
+
+        VtxBuffer.resize(VtxBuffer.Size + src_list->VtxBuffer.Size);
+        if (src_list->VtxBuffer.Size > 0)
+            memcpy(VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, src_list->VtxBuffer.size_in_bytes());
+        IdxBuffer.resize(IdxBuffer.Size + src_list->IdxBuffer.Size);
+        if (use_vtx_offset || vtx_base == 0)
+        {
+            if (src_list->IdxBuffer.Size > 0)
+                memcpy(IdxBuffer.Data + idx_base, src_list->IdxBuffer.Data, src_list->IdxBuffer.size_in_bytes());
+        }
+        else
+        {
+            for (int idx_n = 0; idx_n < src_list->IdxBuffer.Size; idx_n++)
+                IdxBuffer.Data[idx_base + idx_n] = (ImDrawIdx)(src_list->IdxBuffer.Data[idx_n] + vtx_base);
+        }
+        QuadBuffer.resize(QuadBuffer.Size + src_list->QuadBuffer.Size);
+        if (src_list->QuadBuffer.Size > 0)
+            memcpy(QuadBuffer.Data + quad_base, src_list->QuadBuffer.Data, src_list->QuadBuffer.size_in_bytes());
+
+        const ImVec4& clip_rect = placeholder_cmd->ClipRect;
+        for (const ImDrawCmd* src_cmd = src_list->CmdBuffer.begin(); src_cmd != src_list->CmdBuffer.end(); src_cmd++)
+        {
+            if (src_cmd->ElemCount == 0 && src_cmd->QuadCount == 0 && src_cmd->UserCallback == NULL)
+                continue;
+            IM_ASSERT((use_vtx_offset || src_cmd->VtxOffset == 0) && "Draw list was built with ImDrawListFlags_AllowVtxOffset, but not the one it is copied into!");
+            ImDrawCmd cmd = *src_cmd;
+            cmd.ClipRect.x = ImMax(cmd.ClipRect.x, clip_rect.x);
+            cmd.ClipRect.y = ImMax(cmd.ClipRect.y, clip_rect.y);
+            cmd.ClipRect.z = ImMax(ImMin(cmd.ClipRect.z, clip_rect.z), cmd.ClipRect.x);
+            cmd.ClipRect.w = ImMax(ImMin(cmd.ClipRect.w, clip_rect.w), cmd.ClipRect.y);
+            if (use_vtx_offset)
+                cmd.VtxOffset += vtx_base;
+            cmd.IdxOffset += idx_base;
+            cmd.QuadOffset += quad_base;
+            CmdBuffer.push_back(cmd);
+        }
+    }
+    IM_ASSERT(resolved_count == _DeferredDrawLists.Size);
+    IM_UNUSED(resolved_count);
+    _DeferredDrawLists.resize(0);
+    _OnChangedCmdBuffer();
+}
+
+// Keep the draw list usable for further primitives after CmdBuffer was rebuilt: they need to go into a command consuming the end of our buffers.
+void ImDrawList::_OnChangedCmdBuffer()
+{
+    ImDrawCmd* last_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    _CmdHeader.VtxOffset = last_cmd->VtxOffset;
+    if (sizeof(ImDrawIdx) == 2 && (Flags & ImDrawListFlags_AllowVtxOffset) && (unsigned int)VtxBuffer.Size - _CmdHeader.VtxOffset >= (1 << 16))
+        _CmdHeader.VtxOffset = VtxBuffer.Size; // Last command was built before vertices were appended at the end of VtxBuffer
+    _VtxCurrentIdx = (unsigned int)VtxBuffer.Size - _CmdHeader.VtxOffset;
+    if (last_cmd->ElemCount == 0 && last_cmd->QuadCount == 0 && last_cmd->UserCallback == NULL)
+    {
+        ImDrawCmd_HeaderCopy(last_cmd, &_CmdHeader);
+        last_cmd->IdxOffset = IdxBuffer.Size;
+        last_cmd->QuadOffset = QuadBuffer.Size;
+    }
+    else if (last_cmd->UserCallback != NULL || last_cmd->IdxOffset + last_cmd->ElemCount != (unsigned int)IdxBuffer.Size || ImDrawCmd_HeaderCompare(last_cmd, &_CmdHeader) != 0)
+    {
+        AddDrawCmd();
+    }
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+}
+
+// Copy the retained output into 'draw_list', at the end of a frame which used ImDrawListFlags_FingerprintOnly (see ImGui::UpdateWindowRetainedDrawList()).
+// - If tessellation never resumed, the draw list holds no output: copy the retained output up to the first point that didn't match (all of it if none).
+// - Otherwise the draw list holds the output following Points[ResumePoint]: copy the retained output up to that point in front of it.
+//   Commands of the new output use ImDrawCmd::VtxOffset with ImDrawListFlags_AllowVtxOffset, otherwise their indices are rebased.
+void ImGuiWindowRetainedDrawList::RestoreOutput(ImDrawList* draw_list)
+{
+    const bool resumed = (ResumePoint >= 0);
+    const int point_n = resumed ? ResumePoint : PointsMatched;
+    const ImDrawListRetainPoint* point = (point_n < Points.Size) ? &Points.Data[point_n] : NULL;
+    const int cmd_count = point ? point->CmdCount - 1 : CmdBuffer.Size; // Last command is point->LastCmd
+    const int idx_count = point ? point->IdxCount : IdxBuffer.Size;
+    const int vtx_count = point ? point->VtxCount : VtxBuffer.Size;
+    const int quad_count = point ? point->QuadCount : QuadBuffer.Size;
+
+    ImVector<ImDrawCmd> new_cmd_buffer;
+    ImVector<ImDrawIdx> new_idx_buffer;
+    ImVector<ImDrawVert> new_vtx_buffer;
+    ImVector<ImDrawQuad> new_quad_buffer;
+    if (resumed)
+    {
+        new_cmd_buffer.swap(draw_list->CmdBuffer);
+        new_idx_buffer.swap(draw_list->IdxBuffer);
+        new_vtx_buffer.swap(draw_list->VtxBuffer);
+        new_quad_buffer.swap(draw_list->QuadBuffer);
+    }
+
+    // Commands before the point. One of them may have been continued after the point was recorded (when the following empty command was merged into it).
+    draw_list->CmdBuffer.resize(0);
+    draw_list->CmdBuffer.reserve(cmd_count + 1 + new_cmd_buffer.Size);
+    for (int cmd_n = 0; cmd_n < cmd_count; cmd_n++)
+    {
+        ImDrawCmd cmd = CmdBuffer.Data[cmd_n];
+        cmd.ElemCount = (unsigned int)ImMin((int)cmd.ElemCount, idx_count - (int)cmd.IdxOffset);
+        if (cmd.QuadCount > 0)
+            cmd.QuadCount = (unsigned int)ImMin((int)cmd.QuadCount, quad_count - (int)cmd.QuadOffset);
+        draw_list->CmdBuffer.push_back(cmd);
+    }
+    if (point && (point->LastCmd.ElemCount != 0 || point->LastCmd.QuadCount != 0 || point->LastCmd.UserCallback != NULL))
+        draw_list->CmdBuffer.push_back(point->LastCmd);
+
+    draw_list->IdxBuffer.resize(idx_count + new_idx_buffer.Size);
+    if (idx_count > 0)
+        memcpy(draw_list->IdxBuffer.Data, IdxBuffer.Data, (size_t)idx_count * sizeof(ImDrawIdx));
+    draw_list->VtxBuffer.resize(vtx_count + new_vtx_buffer.Size);
+    if (vtx_count > 0)
+        memcpy(draw_list->VtxBuffer.Data, VtxBuffer.Data, (size_t)vtx_count * sizeof(ImDrawVert));
+    draw_list->QuadBuffer.resize(quad_count + new_quad_buffer.Size);
+    if (quad_count > 0)
+        memcpy(draw_list->QuadBuffer.Data, QuadBuffer.Data, (size_t)quad_count * sizeof(ImDrawQuad));
+
+    // New output
+    const bool use_vtx_offset = (draw_list->Flags & ImDrawListFlags_AllowVtxOffset) != 0;
+    if (new_idx_buffer.Size > 0)
+    {
+        if (use_vtx_offset || vtx_count == 0)
+            memcpy(draw_list->IdxBuffer.Data + idx_count, new_idx_buffer.Data, new_idx_buffer.size_in_bytes());
+        else
+            for (int idx_n = 0; idx_n < new_idx_buffer.Size; idx_n++)
+                draw_list->IdxBuffer.Data[idx_count + idx_n] = (ImDrawIdx)(new_idx_buffer.Data[idx_n] + vtx_count);
+    }
+    if (new_vtx_buffer.Size > 0)
+        memcpy(draw_list->VtxBuffer.Data + vtx_count, new_vtx_buffer.Data, new_vtx_buffer.size_in_bytes());
+    if (new_quad_buffer.Size > 0)
+        memcpy(draw_list->QuadBuffer.Data + quad_count, new_quad_buffer.Data, new_quad_buffer.size_in_bytes());
+    for (const ImDrawCmd* src_cmd = new_cmd_buffer.begin(); src_cmd != new_cmd_buffer.end(); src_cmd++)
+    {
+        if (src_cmd->ElemCount == 0 && src_cmd->QuadCount == 0 && src_cmd->UserCallback == NULL)
+            continue;
+        ImDrawCmd cmd = *src_cmd;
+        if (use_vtx_offset)
+            cmd.VtxOffset += vtx_count;
+        cmd.IdxOffset += idx_count;
+        cmd.QuadOffset += quad_count;
+        draw_list->CmdBuffer.push_back(cmd);
+    }
+
+    if (draw_list->CmdBuffer.Size == 0)
+    {
+        draw_list->_CmdHeader.VtxOffset = 0;
+        draw_list->AddDrawCmd();
+    }
+    draw_list->_OnChangedCmdBuffer();
+}
+
+// CPU reference of the coverage renderer backends supporting ImGuiBackendFlags_RendererHasSdfShapes are expected to compute for a pixel of an ImDrawQuad.
+// - 'p' is the position of the pixel center, 'fringe_width' the size of a pixel in the same units (1.0f / FramebufferScale when working in display coordinates).
+// - The final color is Col * Texture(uv) * coverage, with uv interpolated over the quad as for plain quads.
+// - Rounded quads are anti-aliased over a fringe centered on their outline, as tessellated shapes are: the renderer needs to rasterize them
+//   expanded by half 'fringe_width' on each side (extrapolating uv), pixels outside of that can be skipped.
+float ImDrawQuadCalcCoverage(const ImDrawQuad& quad, const ImVec2& p, float fringe_width)
+{
+    if (quad.Rounding <= 0.0f)
+        return (p.x >= quad.Min.x && p.y >= quad.Min.y && p.x < quad.Max.x && p.y < quad.Max.y) ? 1.0f : 0.0f;
+
+    // Signed distance to a rectangle with a rounded corner in the quadrant of 'p' (negative inside)
+    const ImVec2 center = (quad.Min + quad.Max) * 0.5f;
+    const ImVec2 half_size = (quad.Max - quad.Min) * 0.5f;
+    const ImDrawFlags corner_flag = (p.y < center.y) ? ((p.x < center.x) ? ImDrawFlags_RoundCornersTopLeft : ImDrawFlags_RoundCornersTopRight) : ((p.x < center.x) ? ImDrawFlags_RoundCornersBottomLeft : ImDrawFlags_RoundCornersBottomRight);
+    const float r = (quad.Flags & corner_flag) ? quad.Rounding : 0.0f;
+    const ImVec2 d(ImFabs(p.x - center.x) - half_size.x + r, ImFabs(p.y - center.y) - half_size.y + r);
+    const float dist = ImSqrt(ImMax(d.x, 0.0f) * ImMax(d.x, 0.0f) + ImMax(d.y, 0.0f) * ImMax(d.y, 0.0f)) + ImMin(ImMax(d.x, d.y), 0.0f) - r;
+    return ImSaturate(0.5f - dist / fringe_width);
+}
+
 // Fully unrolled with inline call to keep our debug builds decently fast.
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
-    ImVec2 b(c.x, a.y), d(a.x, c.y), uv(_Data->TexUvWhitePixel);
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Pack each coordinate once and share them between the 4 corners.
+    ImDrawVertPos pa, pc; pa = a; pc = c;
+    ImDrawVertUV uv; uv = _Data->TexUvWhitePixel;
+    _VtxWritePtr[0].pos.x16 = pa.x16; _VtxWritePtr[0].pos.y16 = pa.y16; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+    _VtxWritePtr[1].pos.x16 = pc.x16; _VtxWritePtr[1].pos.y16 = pa.y16; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
+    _VtxWritePtr[2].pos.x16 = pc.x16; _VtxWritePtr[2].pos.y16 = pc.y16; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
+    _VtxWritePtr[3].pos.x16 = pa.x16; _VtxWritePtr[3].pos.y16 = pc.y16; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+#else
+    ImVec2 b(c.x, a.y), d(a.x, c.y), uv(_Data->TexUvWhitePixel);
     _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
     _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
     _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
     _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+#endif
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -682,14 +1180,24 @@ void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 
 void ImDrawList::PrimRectUV(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a, const ImVec2& uv_c, ImU32 col)
 {
-    ImVec2 b(c.x, a.y), d(a.x, c.y), uv_b(uv_c.x, uv_a.y), uv_d(uv_a.x, uv_c.y);
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Pack each coordinate once and share them between the 4 corners.
+    ImDrawVertPos pa, pc; pa = a; pc = c;
+    ImDrawVertUV ta, tc; ta = uv_a; tc = uv_c;
+    _VtxWritePtr[0].pos.x16 = pa.x16; _VtxWritePtr[0].pos.y16 = pa.y16; _VtxWritePtr[0].uv.u16 = ta.u16; _VtxWritePtr[0].uv.v16 = ta.v16; _VtxWritePtr[0].col = col;
+    _VtxWritePtr[1].pos.x16 = pc.x16; _VtxWritePtr[1].pos.y16 = pa.y16; _VtxWritePtr[1].uv.u16 = tc.u16; _VtxWritePtr[1].uv.v16 = ta.v16; _VtxWritePtr[1].col = col;
+    _VtxWritePtr[2].pos.x16 = pc.x16; _VtxWritePtr[2].pos.y16 = pc.y16; _VtxWritePtr[2].uv.u16 = tc.u16; _VtxWritePtr[2].uv.v16 = tc.v16; _VtxWritePtr[2].col = col;
+    _VtxWritePtr[3].pos.x16 = pa.x16; _VtxWritePtr[3].pos.y16 = pc.y16; _VtxWritePtr[3].uv.u16 = ta.u16; _VtxWritePtr[3].uv.v16 = tc.v16; _VtxWritePtr[3].col = col;
+#else
+    ImVec2 b(c.x, a.y), d(a.x, c.y), uv_b(uv_c.x, uv_a.y), uv_d(uv_a.x, uv_c.y);
     _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
     _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
     _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
     _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+#endif
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -716,12 +1224,187 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// AddPolyline() batched kernels
+// - Normals and extruded edges are computed 4 points at a time with SSE (x86) or NEON (AArch64), then the scalar loop handles
+//   the remaining points, including the segment closing the loop. The scalar loop alone is the fallback when SIMD is disabled.
+// - With SSE the SIMD path is bit-exact with the scalar one (same rsqrt approximation, same operations in the same order).
+//   With NEON, rsqrt is an estimate refined by one Newton-Raphson step while the scalar path uses 1/sqrtf(): results match within ~1e-5.
+#if defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)
+#define IM_POLYLINE_SIMD
+#if defined(IMGUI_ENABLE_SSE)
+typedef __m128 ImFloat4;
+static inline ImFloat4 ImFloat4Set1(float v)                    { return _mm_set1_ps(v); }
+static inline ImFloat4 ImFloat4Add(ImFloat4 a, ImFloat4 b)      { return _mm_add_ps(a, b); }
+static inline ImFloat4 ImFloat4Sub(ImFloat4 a, ImFloat4 b)      { return _mm_sub_ps(a, b); }
+static inline ImFloat4 ImFloat4Mul(ImFloat4 a, ImFloat4 b)      { return _mm_mul_ps(a, b); }
+static inline ImFloat4 ImFloat4Div(ImFloat4 a, ImFloat4 b)      { return _mm_div_ps(a, b); }
+static inline ImFloat4 ImFloat4Min(ImFloat4 a, ImFloat4 b)      { return _mm_min_ps(a, b); }
+static inline ImFloat4 ImFloat4Neg(ImFloat4 a)                  { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+static inline ImFloat4 ImFloat4Rsqrt(ImFloat4 a)                { return _mm_rsqrt_ps(a); }
+static inline ImFloat4 ImFloat4SelectGt(ImFloat4 a, ImFloat4 b, ImFloat4 if_gt, ImFloat4 if_not) { __m128 m = _mm_cmpgt_ps(a, b); return _mm_or_ps(_mm_and_ps(m, if_gt), _mm_andnot_ps(m, if_not)); }
+static inline void     ImFloat4LoadVec2(const ImVec2* p, ImFloat4* xs, ImFloat4* ys)
+{
+    __m128 a = _mm_loadu_ps(&p[0].x);   // x0 y0 x1 y1
+    __m128 b = _mm_loadu_ps(&p[2].x);   // x2 y2 x3 y3
+    *xs = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    *ys = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+static inline void     ImFloat4StoreVec2(ImVec2* p, int stride, ImFloat4 xs, ImFloat4 ys)
+{
+    __m128 lo = _mm_unpacklo_ps(xs, ys);
+    __m128 hi = _mm_unpackhi_ps(xs, ys);
+    _mm_storel_pi((__m64*)(void*)&p[0], lo);
+    _mm_storeh_pi((__m64*)(void*)&p[stride], lo);
+    _mm_storel_pi((__m64*)(void*)&p[stride * 2], hi);
+    _mm_storeh_pi((__m64*)(void*)&p[stride * 3], hi);
+}
+#else
+typedef float32x4_t ImFloat4;
+static inline ImFloat4 ImFloat4Set1(float v)                    { return vdupq_n_f32(v); }
+static inline ImFloat4 ImFloat4Add(ImFloat4 a, ImFloat4 b)      { return vaddq_f32(a, b); }
+static inline ImFloat4 ImFloat4Sub(ImFloat4 a, ImFloat4 b)      { return vsubq_f32(a, b); }
+static inline ImFloat4 ImFloat4Mul(ImFloat4 a, ImFloat4 b)      { return vmulq_f32(a, b); }
+static inline ImFloat4 ImFloat4Div(ImFloat4 a, ImFloat4 b)      { return vdivq_f32(a, b); }
+static inline ImFloat4 ImFloat4Min(ImFloat4 a, ImFloat4 b)      { return vminq_f32(a, b); }
+static inline ImFloat4 ImFloat4Neg(ImFloat4 a)                  { return vnegq_f32(a); }
+static inline ImFloat4 ImFloat4Rsqrt(ImFloat4 a)                { float32x4_t e = vrsqrteq_f32(a); return vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(a, e), e)); }
+static inline ImFloat4 ImFloat4SelectGt(ImFloat4 a, ImFloat4 b, ImFloat4 if_gt, ImFloat4 if_not) { return vbslq_f32(vcgtq_f32(a, b), if_gt, if_not); }
+static inline void     ImFloat4LoadVec2(const ImVec2* p, ImFloat4* xs, ImFloat4* ys)
+{
+    float32x4x2_t v = vld2q_f32(&p->x);
+    *xs = v.val[0];
+    *ys = v.val[1];
+}
+static inline void     ImFloat4StoreVec2(ImVec2* p, int stride, ImFloat4 xs, ImFloat4 ys)
+{
+    float32x4x2_t z = vzipq_f32(xs, ys);
+    vst1_f32(&p[0].x, vget_low_f32(z.val[0]));
+    vst1_f32(&p[stride].x, vget_high_f32(z.val[0]));
+    vst1_f32(&p[stride * 2].x, vget_low_f32(z.val[1]));
+    vst1_f32(&p[stride * 3].x, vget_high_f32(z.val[1]));
+}
+#endif
+#endif // #if defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)
+
+// Compute the normal of each of the 'count' segments. Segment i goes from points[i] to points[i + 1], wrapping to points[0] when closed.
+static void ImPolylineComputeNormals(const ImVec2* points, const int points_count, const int count, ImVec2* normals)
+{
+    int i1 = 0;
+#ifdef IM_POLYLINE_SIMD
+    // A batch of 4 segments reads 5 points. We stop before the wrapping segment, which is left to the scalar loop.
+    const ImFloat4 zero = ImFloat4Set1(0.0f);
+    const ImFloat4 one = ImFloat4Set1(1.0f);
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        ImFloat4 x1, y1, x2, y2;
+        ImFloat4LoadVec2(points + i1, &x1, &y1);
+        ImFloat4LoadVec2(points + i1 + 1, &x2, &y2);
+        ImFloat4 dx = ImFloat4Sub(x2, x1);
+        ImFloat4 dy = ImFloat4Sub(y2, y1);
+        ImFloat4 d2 = ImFloat4Add(ImFloat4Mul(dx, dx), ImFloat4Mul(dy, dy));
+        ImFloat4 inv_len = ImFloat4SelectGt(d2, zero, ImFloat4Rsqrt(d2), one);
+        dx = ImFloat4Mul(dx, inv_len);
+        dy = ImFloat4Mul(dy, inv_len);
+        ImFloat4StoreVec2(normals + i1, 1, dy, ImFloat4Neg(dx));
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        normals[i1].x = dy;
+        normals[i1].y = -dx;
+    }
+}
+
+// Compute the extruded vertices of the end point of each of the 'count' segments, along the average of the normals of its two adjacent segments.
+// - When 'thick' is false, writes 2 vertices per point: out[i * 2 + 0..1] = points[i] +/- dm * offset_outer
+// - When 'thick' is true, writes 4 vertices per point: out[i * 4 + 0..3] = points[i] + dm * offset_outer, + dm * offset_inner, - dm * offset_inner, - dm * offset_outer
+static void ImPolylineComputeEdges(const ImVec2* points, const int points_count, const int count, const ImVec2* normals, ImVec2* out, const bool thick, const float offset_outer, const float offset_inner)
+{
+    const int stride = thick ? 4 : 2;
+    int i1 = 0;
+#ifdef IM_POLYLINE_SIMD
+    // A batch of 4 segments reads normals [i1, i1 + 4] and writes points [i1 + 1, i1 + 4]. The wrapping segment is left to the scalar loop.
+    const ImFloat4 half = ImFloat4Set1(0.5f);
+    const ImFloat4 one = ImFloat4Set1(1.0f);
+    const ImFloat4 min_d2 = ImFloat4Set1(0.000001f);
+    const ImFloat4 max_inv_len2 = ImFloat4Set1(IM_FIXNORMAL2F_MAX_INVLEN2);
+    const ImFloat4 off_out = ImFloat4Set1(offset_outer);
+    const ImFloat4 off_in = ImFloat4Set1(offset_inner);
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        ImFloat4 n1x, n1y, n2x, n2y, px, py;
+        ImFloat4LoadVec2(normals + i1, &n1x, &n1y);
+        ImFloat4LoadVec2(normals + i1 + 1, &n2x, &n2y);
+        ImFloat4LoadVec2(points + i1 + 1, &px, &py);
+
+        // Average normals (same as IM_FIXNORMAL2F)
+        ImFloat4 dm_x = ImFloat4Mul(ImFloat4Add(n1x, n2x), half);
+        ImFloat4 dm_y = ImFloat4Mul(ImFloat4Add(n1y, n2y), half);
+        ImFloat4 d2 = ImFloat4Add(ImFloat4Mul(dm_x, dm_x), ImFloat4Mul(dm_y, dm_y));
+        ImFloat4 inv_len2 = ImFloat4SelectGt(d2, min_d2, ImFloat4Min(ImFloat4Div(one, d2), max_inv_len2), one);
+        dm_x = ImFloat4Mul(dm_x, inv_len2);
+        dm_y = ImFloat4Mul(dm_y, inv_len2);
+
+        ImVec2* out_vtx = &out[(i1 + 1) * stride];
+        ImFloat4 dm_out_x = ImFloat4Mul(dm_x, off_out);
+        ImFloat4 dm_out_y = ImFloat4Mul(dm_y, off_out);
+        ImFloat4StoreVec2(out_vtx + 0, stride, ImFloat4Add(px, dm_out_x), ImFloat4Add(py, dm_out_y));
+        ImFloat4StoreVec2(out_vtx + stride - 1, stride, ImFloat4Sub(px, dm_out_x), ImFloat4Sub(py, dm_out_y));
+        if (thick)
+        {
+            ImFloat4 dm_in_x = ImFloat4Mul(dm_x, off_in);
+            ImFloat4 dm_in_y = ImFloat4Mul(dm_y, off_in);
+            ImFloat4StoreVec2(out_vtx + 1, stride, ImFloat4Add(px, dm_in_x), ImFloat4Add(py, dm_in_y));
+            ImFloat4StoreVec2(out_vtx + 2, stride, ImFloat4Sub(px, dm_in_x), ImFloat4Sub(py, dm_in_y));
+        }
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+
+        // Average normals
+        float dm_x = (normals[i1].x + normals[i2].x) * 0.5f;
+        float dm_y = (normals[i1].y + normals[i2].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+
+        ImVec2* out_vtx = &out[i2 * stride];
+        const float dm_out_x = dm_x * offset_outer;
+        const float dm_out_y = dm_y * offset_outer;
+        out_vtx[0].x = points[i2].x + dm_out_x;
+        out_vtx[0].y = points[i2].y + dm_out_y;
+        out_vtx[stride - 1].x = points[i2].x - dm_out_x;
+        out_vtx[stride - 1].y = points[i2].y - dm_out_y;
+        if (thick)
+        {
+            const float dm_in_x = dm_x * offset_inner;
+            const float dm_in_y = dm_y * offset_inner;
+            out_vtx[1].x = points[i2].x + dm_in_x;
+            out_vtx[1].y = points[i2].y + dm_in_y;
+            out_vtx[2].x = points[i2].x - dm_in_x;
+            out_vtx[2].y = points[i2].y - dm_in_y;
+        }
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
 {
     if (points_count < 2)
         return;
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        const struct { float Thickness; ImU32 Col; ImDrawFlags Flags; } params = { thickness, col, flags };
+        ImDrawListFingerprint(this, &params, sizeof(params));
+        ImDrawListFingerprint(this, points, points_count * sizeof(ImVec2));
+        if (ImDrawListFingerprintSkip(this))
+            return;
+    }
 
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
@@ -757,15 +1440,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         ImVec2* temp_points = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        ImPolylineComputeNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
@@ -791,29 +1466,17 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Add temporary vertexes for the outer edges (half_draw_size is the offset to the outer edge of the AA area)
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            ImPolylineComputeEdges(points, points_count, count, temp_normals, temp_points, false, half_draw_size, 0.0f);
+
+            // Generate the indices to form a number of triangles for each line segment
+            // FIXME-OPT: Possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -887,35 +1550,17 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Add temporary vertices
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            ImPolylineComputeEdges(points, points_count, count, temp_normals, temp_points, true, half_inner_thickness + AA_SIZE, half_inner_thickness);
+
+            // Generate the indices to form a number of triangles for each line segment
+            // FIXME-OPT: Possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -959,10 +1604,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            _VtxWritePtr[0].pos = ImVec2(p1.x + dy, p1.y - dx); _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[1].pos = ImVec2(p2.x + dy, p2.y - dx); _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+            _VtxWritePtr[2].pos = ImVec2(p2.x - dy, p2.y + dx); _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+            _VtxWritePtr[3].pos = ImVec2(p1.x - dy, p1.y + dx); _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -973,34 +1618,41 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     }
 }
 
-// We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
-void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+// Index and vertex counts written by ImDrawListWriteConvexPolyFilled() for a polygon of 'points_count' points.
+static inline void ImDrawListCalcConvexPolyFilledCounts(const ImDrawList* draw_list, const int points_count, int* out_idx_count, int* out_vtx_count)
 {
-    if (points_count < 3)
-        return;
+    const bool anti_aliased = (draw_list->Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    *out_idx_count = anti_aliased ? (points_count - 2)*3 + points_count * 6 : (points_count - 2)*3;
+    *out_vtx_count = anti_aliased ? (points_count * 2) : points_count;
+}
 
-    const ImVec2 uv = _Data->TexUvWhitePixel;
+// Write a convex polygon into space previously reserved with PrimReserve(). Shared by AddConvexPolyFilled() and the batched primitives.
+// 'temp_normals' needs room for 'points_count' items (only used with anti-aliased fill).
+// We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
+static void ImDrawListWriteConvexPolyFilled(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col, ImVec2* temp_normals)
+{
+    const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    const unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
 
-    if (Flags & ImDrawListFlags_AntiAliasedFill)
+    if (draw_list->Flags & ImDrawListFlags_AntiAliasedFill)
     {
         // Anti-aliased Fill
-        const float AA_SIZE = _FringeScale;
+        const float AA_SIZE = draw_list->_FringeScale;
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-        const int idx_count = (points_count - 2)*3 + points_count * 6;
         const int vtx_count = (points_count * 2);
-        PrimReserve(idx_count, vtx_count);
 
         // Add indexes for fill
-        unsigned int vtx_inner_idx = _VtxCurrentIdx;
-        unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
+        unsigned int vtx_inner_idx = vtx_current_idx;
+        unsigned int vtx_outer_idx = vtx_current_idx + 1;
         for (int i = 2; i < points_count; i++)
         {
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + ((i - 1) << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx + (i << 1));
-            _IdxWritePtr += 3;
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + ((i - 1) << 1)); idx_write[2] = (ImDrawIdx)(vtx_inner_idx + (i << 1));
+            idx_write += 3;
         }
 
         // Compute normals
-        ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
             const ImVec2& p0 = points[i0];
@@ -1024,35 +1676,54 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
-            _VtxWritePtr += 2;
+            vtx_write[0].pos = ImVec2((points[i1].x - dm_x), (points[i1].y - dm_y)); vtx_write[0].uv = uv; vtx_write[0].col = col;        // Inner
+            vtx_write[1].pos = ImVec2((points[i1].x + dm_x), (points[i1].y + dm_y)); vtx_write[1].uv = uv; vtx_write[1].col = col_trans;  // Outer
+            vtx_write += 2;
 
             // Add indexes for fringes
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
-            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
-            _IdxWritePtr += 6;
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); idx_write[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+            idx_write[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); idx_write[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); idx_write[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+            idx_write += 6;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        draw_list->_VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
     else
     {
         // Non Anti-aliased Fill
-        const int idx_count = (points_count - 2)*3;
         const int vtx_count = points_count;
-        PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr++;
+            vtx_write[0].pos = points[i]; vtx_write[0].uv = uv; vtx_write[0].col = col;
+            vtx_write++;
         }
         for (int i = 2; i < points_count; i++)
         {
-            _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + i - 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + i);
-            _IdxWritePtr += 3;
+            idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx + i - 1); idx_write[2] = (ImDrawIdx)(vtx_current_idx + i);
+            idx_write += 3;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        draw_list->_VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+}
+
+void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+{
+    if (points_count < 3)
+        return;
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        ImDrawListFingerprint(this, points, points_count * sizeof(ImVec2));
+        ImDrawListFingerprint(this, &col, sizeof(col));
+        if (ImDrawListFingerprintSkip(this))
+            return;
     }
+
+    int idx_count, vtx_count;
+    ImDrawListCalcConvexPolyFilledCounts(this, points_count, &idx_count, &vtx_count);
+    PrimReserve(idx_count, vtx_count);
+    ImVec2* temp_normals = (Flags & ImDrawListFlags_AntiAliasedFill) ? (ImVec2*)alloca(points_count * sizeof(ImVec2)) : NULL; //-V630
+    ImDrawListWriteConvexPolyFilled(this, points, points_count, col, temp_normals);
 }
 
 void ImDrawList::_PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step)
@@ -1353,11 +2024,47 @@ static inline ImDrawFlags FixRectCornerFlags(ImDrawFlags flags)
     return flags;
 }
 
-void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+static inline float ClampRectRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
 {
-    flags = FixRectCornerFlags(flags);
     rounding = ImMin(rounding, ImFabs(b.x - a.x) * ( ((flags & ImDrawFlags_RoundCornersTop)  == ImDrawFlags_RoundCornersTop)  || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f ) - 1.0f);
     rounding = ImMin(rounding, ImFabs(b.y - a.y) * ( ((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight)  == ImDrawFlags_RoundCornersRight)  ? 0.5f : 1.0f ) - 1.0f);
+    return rounding;
+}
+
+// Filled rounded shapes may be output as a single quad evaluated as a signed distance field by the renderer (ImDrawListFlags_SdfShapes).
+// This relies on the renderer for anti-aliasing, so we keep tessellating when ImDrawListFlags_AntiAliasedFill is disabled.
+static inline bool ImDrawListUseSdfShapes(const ImDrawList* draw_list)
+{
+    const ImDrawListFlags required_flags = ImDrawListFlags_InstancedQuads | ImDrawListFlags_SdfShapes | ImDrawListFlags_AntiAliasedFill;
+    return (draw_list->Flags & required_flags) == required_flags;
+}
+
+// Output a filled rounded rectangle as a single rounded quad, return false when it needs to be tessellated by PathRect() instead.
+static bool ImDrawListTryAddSdfRect(ImDrawList* draw_list, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col, float rounding, ImDrawFlags flags)
+{
+    if (!ImDrawListUseSdfShapes(draw_list) || p_min.x > p_max.x || p_min.y > p_max.y)
+        return false;
+    flags = FixRectCornerFlags(flags);
+    rounding = ClampRectRounding(p_min, p_max, rounding, flags);
+    if (rounding <= 0.0f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
+        return false;
+    flags &= ImDrawFlags_RoundCornersMask_;
+
+    if (draw_list->Flags & ImDrawListFlags_Fingerprint)
+    {
+        const struct { ImVec2 Min, Max; ImU32 Col; float Rounding; ImDrawFlags Flags; } params = { p_min, p_max, col, rounding, flags };
+        ImDrawListFingerprint(draw_list, &params, sizeof(params));
+        if (ImDrawListFingerprintSkip(draw_list))
+            return true;
+    }
+    draw_list->PrimRectInstanced(p_min, p_max, uv_min, uv_max, col, rounding, flags);
+    return true;
+}
+
+void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+{
+    flags = FixRectCornerFlags(flags);
+    rounding = ClampRectRounding(a, b, rounding, flags);
 
     if (rounding <= 0.0f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
@@ -1407,10 +2114,22 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
         return;
     if (rounding <= 0.0f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
+        if (Flags & ImDrawListFlags_Fingerprint)
+        {
+            const struct { ImVec2 Min, Max; ImU32 Col; } params = { p_min, p_max, col };
+            ImDrawListFingerprint(this, &params, sizeof(params));
+            if (ImDrawListFingerprintSkip(this))
+                return;
+        }
+        if (Flags & ImDrawListFlags_InstancedQuads)
+        {
+            PrimRectInstanced(p_min, p_max, _Data->TexUvWhitePixel, _Data->TexUvWhitePixel, col);
+            return;
+        }
         PrimReserve(6, 4);
         PrimRect(p_min, p_max, col);
     }
-    else
+    else if (!ImDrawListTryAddSdfRect(this, p_min, p_max, _Data->TexUvWhitePixel, _Data->TexUvWhitePixel, col, rounding, flags))
     {
         PathRect(p_min, p_max, rounding, flags);
         PathFillConvex(col);
@@ -1422,6 +2141,15 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_ma
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        const ImVec2 points[] = { p_min, p_max };
+        const ImU32 cols[] = { col_upr_left, col_upr_right, col_bot_right, col_bot_left };
+        ImDrawListFingerprint(this, points, sizeof(points));
+        ImDrawListFingerprint(this, cols, sizeof(cols));
+        if (ImDrawListFingerprintSkip(this))
+            return;
+    }
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     PrimReserve(6, 4);
@@ -1508,6 +2236,20 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
     if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
         return;
 
+    if (num_segments <= 0 && ImDrawListUseSdfShapes(this))
+    {
+        // Single rounded quad (ImDrawListFlags_SdfShapes)
+        if (Flags & ImDrawListFlags_Fingerprint)
+        {
+            const struct { ImVec2 Center; float Radius; ImU32 Col; } params = { center, radius, col };
+            ImDrawListFingerprint(this, &params, sizeof(params));
+            if (ImDrawListFingerprintSkip(this))
+                return;
+        }
+        PrimRectInstanced(center - ImVec2(radius, radius), center + ImVec2(radius, radius), _Data->TexUvWhitePixel, _Data->TexUvWhitePixel, col, radius, ImDrawFlags_RoundCornersAll);
+        return;
+    }
+
     if (num_segments <= 0)
     {
         // Use arc with automatic segment count
@@ -1573,25 +2315,308 @@ void ImDrawList::AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const Im
     PathStroke(col, 0, thickness);
 }
 
-void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
+// Reserve index/vertex space for the next chunk of a batch, made of up to 'count' elements using at most 'idx_per_elem' indices and 'vtx_per_elem' vertices each.
+// Returns the number of elements in the chunk. Space left unused by skipped or smaller elements is released with ImDrawListBatchUnreserve().
+// - With 16-bit indices, a chunk is cut so that it fits in the current 64k vertex range, allowing PrimReserve() to move to a new VtxOffset between chunks.
+// - Chunks are also capped in size so that reserving for the worst case doesn't make buffers grow much larger than needed.
+static int ImDrawListBatchReserve(ImDrawList* draw_list, int count, int idx_per_elem, int vtx_per_elem)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
-        return;
-
-    if (text_end == NULL)
-        text_end = text_begin + strlen(text_begin);
-    if (text_begin == text_end)
-        return;
-
-    // Pull default font/size from the shared ImDrawListSharedData instance
-    if (font == NULL)
-        font = _Data->Font;
-    if (font_size == 0.0f)
-        font_size = _Data->FontSize;
+    const int BATCH_CHUNK_MAX = 4096;
+    int chunk_count = ImMin(count, BATCH_CHUNK_MAX);
+    if (sizeof(ImDrawIdx) == 2)
+    {
+        int avail_count = ((1 << 16) - 1 - (int)draw_list->_VtxCurrentIdx) / vtx_per_elem;
+        if (avail_count <= 0)
+            avail_count = ((1 << 16) - 1) / vtx_per_elem;
+        chunk_count = ImMin(chunk_count, avail_count);
+    }
+    draw_list->PrimReserve(chunk_count * idx_per_elem, chunk_count * vtx_per_elem);
+    return chunk_count;
+}
 
-    IM_ASSERT(font->ContainerAtlas->TexID == _CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+static void ImDrawListBatchUnreserve(ImDrawList* draw_list)
+{
+    const int idx_unused = (int)(draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - draw_list->_IdxWritePtr);
+    const int vtx_unused = (int)(draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size - draw_list->_VtxWritePtr);
+    if (idx_unused > 0 || vtx_unused > 0)
+        draw_list->PrimUnreserve(idx_unused, vtx_unused);
+}
 
-    ImVec4 clip_rect = _CmdHeader.ClipRect;
+// Same output as calling AddLine() for each element (a 2 points open AddPolyline() with the same paths), with the setup done once.
+void ImDrawList::AddLineBatch(const ImVec2* p1, const ImVec2* p2, const ImU32* cols, int count, float thickness)
+{
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        ImDrawListFingerprint(this, p1, count * sizeof(ImVec2));
+        ImDrawListFingerprint(this, p2, count * sizeof(ImVec2));
+        ImDrawListFingerprint(this, cols, count * sizeof(ImU32));
+        ImDrawListFingerprint(this, &thickness, sizeof(thickness));
+        if (ImDrawListFingerprintSkip(this))
+            return;
+    }
+    const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
+    const bool thick_line = (thickness > _FringeScale);
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const float AA_SIZE = _FringeScale;
+    if (anti_aliased)
+        thickness = ImMax(thickness, 1.0f);
+    const int integer_thickness = (int)thickness;
+    const float fractional_thickness = thickness - integer_thickness;
+    const bool use_texture = anti_aliased && (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+    const int idx_per_line = (!anti_aliased || use_texture) ? 6 : (thick_line ? 18 : 12);
+    const int vtx_per_line = (!anti_aliased || use_texture) ? 4 : (thick_line ? 8 : 6);
+
+    // Edge offsets, see AddPolyline()
+    const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
+    const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+    const float half_outer_thickness = half_inner_thickness + AA_SIZE;
+    const ImVec4 tex_uvs = use_texture ? _Data->TexUvLines[integer_thickness] : ImVec4();
+    const ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
+    const ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
+
+    for (int n = 0; n < count; )
+    {
+        const int chunk_end = n + ImDrawListBatchReserve(this, count - n, idx_per_line, vtx_per_line);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx1 = _VtxCurrentIdx;
+        for (; n < chunk_end; n++)
+        {
+            const ImU32 col = cols[n];
+            if ((col & IM_COL32_A_MASK) == 0)
+                continue;
+            const ImVec2 a = p1[n] + ImVec2(0.5f, 0.5f);
+            const ImVec2 b = p2[n] + ImVec2(0.5f, 0.5f);
+            float dx = b.x - a.x;
+            float dy = b.y - a.y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+
+            if (!anti_aliased)
+            {
+                // [PATH 4] Non texture-based, Non anti-aliased lines
+                dx *= (thickness * 0.5f);
+                dy *= (thickness * 0.5f);
+                vtx_write[0].pos = ImVec2(a.x + dy, a.y - dx); vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;
+                vtx_write[1].pos = ImVec2(b.x + dy, b.y - dx); vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+                vtx_write[2].pos = ImVec2(b.x - dy, b.y + dx); vtx_write[2].uv = opaque_uv; vtx_write[2].col = col;
+                vtx_write[3].pos = ImVec2(a.x - dy, a.y + dx); vtx_write[3].uv = opaque_uv; vtx_write[3].col = col;
+                idx_write[0] = (ImDrawIdx)(idx1); idx_write[1] = (ImDrawIdx)(idx1 + 1); idx_write[2] = (ImDrawIdx)(idx1 + 2);
+                idx_write[3] = (ImDrawIdx)(idx1); idx_write[4] = (ImDrawIdx)(idx1 + 2); idx_write[5] = (ImDrawIdx)(idx1 + 3);
+                vtx_write += 4;
+                idx_write += 6;
+                idx1 += 4;
+                continue;
+            }
+
+            // The normal is used as-is on the first point, and averaged with itself on the last point (see ImPolylineComputeEdges())
+            const float n_x = dy, n_y = -dx;
+            float dm_x = (n_x + n_x) * 0.5f;
+            float dm_y = (n_y + n_y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+            const unsigned int idx2 = idx1 + vtx_per_line / 2;
+            if (use_texture)
+            {
+                // [PATH 1] Texture-based lines
+                vtx_write[0].pos = ImVec2(a.x + n_x * half_draw_size, a.y + n_y * half_draw_size);  vtx_write[0].uv = tex_uv0; vtx_write[0].col = col;
+                vtx_write[1].pos = ImVec2(a.x - n_x * half_draw_size, a.y - n_y * half_draw_size);  vtx_write[1].uv = tex_uv1; vtx_write[1].col = col;
+                vtx_write[2].pos = ImVec2(b.x + dm_x * half_draw_size, b.y + dm_y * half_draw_size); vtx_write[2].uv = tex_uv0; vtx_write[2].col = col;
+                vtx_write[3].pos = ImVec2(b.x - dm_x * half_draw_size, b.y - dm_y * half_draw_size); vtx_write[3].uv = tex_uv1; vtx_write[3].col = col;
+                idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 1); // Right tri
+                idx_write[3] = (ImDrawIdx)(idx2 + 1); idx_write[4] = (ImDrawIdx)(idx1 + 1); idx_write[5] = (ImDrawIdx)(idx2 + 0); // Left tri
+            }
+            else if (!thick_line)
+            {
+                // [PATH 2] Non texture-based lines (non-thick)
+                vtx_write[0].pos = a;                                                                                             vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;
+                vtx_write[1].pos = ImVec2(a.x + n_x * half_draw_size, a.y + n_y * half_draw_size);  vtx_write[1].uv = opaque_uv; vtx_write[1].col = col_trans;
+                vtx_write[2].pos = ImVec2(a.x - n_x * half_draw_size, a.y - n_y * half_draw_size);  vtx_write[2].uv = opaque_uv; vtx_write[2].col = col_trans;
+                vtx_write[3].pos = b;                                                                                             vtx_write[3].uv = opaque_uv; vtx_write[3].col = col;
+                vtx_write[4].pos = ImVec2(b.x + dm_x * half_draw_size, b.y + dm_y * half_draw_size); vtx_write[4].uv = opaque_uv; vtx_write[4].col = col_trans;
+                vtx_write[5].pos = ImVec2(b.x - dm_x * half_draw_size, b.y - dm_y * half_draw_size); vtx_write[5].uv = opaque_uv; vtx_write[5].col = col_trans;
+                idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
+                idx_write[3] = (ImDrawIdx)(idx1 + 2); idx_write[4] = (ImDrawIdx)(idx2 + 2); idx_write[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
+                idx_write[6] = (ImDrawIdx)(idx2 + 1); idx_write[7] = (ImDrawIdx)(idx1 + 1); idx_write[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
+                idx_write[9] = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
+            }
+            else
+            {
+                // [PATH 2] Non texture-based lines (thick)
+                vtx_write[0].pos = ImVec2(a.x + n_x * half_outer_thickness, a.y + n_y * half_outer_thickness);  vtx_write[0].uv = opaque_uv; vtx_write[0].col = col_trans;
+                vtx_write[1].pos = ImVec2(a.x + n_x * half_inner_thickness, a.y + n_y * half_inner_thickness);  vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+                vtx_write[2].pos = ImVec2(a.x - n_x * half_inner_thickness, a.y - n_y * half_inner_thickness);  vtx_write[2].uv = opaque_uv; vtx_write[2].col = col;
+                vtx_write[3].pos = ImVec2(a.x - n_x * half_outer_thickness, a.y - n_y * half_outer_thickness);  vtx_write[3].uv = opaque_uv; vtx_write[3].col = col_trans;
+                vtx_write[4].pos = ImVec2(b.x + dm_x * half_outer_thickness, b.y + dm_y * half_outer_thickness); vtx_write[4].uv = opaque_uv; vtx_write[4].col = col_trans;
+                vtx_write[5].pos = ImVec2(b.x + dm_x * half_inner_thickness, b.y + dm_y * half_inner_thickness); vtx_write[5].uv = opaque_uv; vtx_write[5].col = col;
+                vtx_write[6].pos = ImVec2(b.x - dm_x * half_inner_thickness, b.y - dm_y * half_inner_thickness); vtx_write[6].uv = opaque_uv; vtx_write[6].col = col;
+                vtx_write[7].pos = ImVec2(b.x - dm_x * half_outer_thickness, b.y - dm_y * half_outer_thickness); vtx_write[7].uv = opaque_uv; vtx_write[7].col = col_trans;
+                idx_write[0]  = (ImDrawIdx)(idx2 + 1); idx_write[1]  = (ImDrawIdx)(idx1 + 1); idx_write[2]  = (ImDrawIdx)(idx1 + 2);
+                idx_write[3]  = (ImDrawIdx)(idx1 + 2); idx_write[4]  = (ImDrawIdx)(idx2 + 2); idx_write[5]  = (ImDrawIdx)(idx2 + 1);
+                idx_write[6]  = (ImDrawIdx)(idx2 + 1); idx_write[7]  = (ImDrawIdx)(idx1 + 1); idx_write[8]  = (ImDrawIdx)(idx1 + 0);
+                idx_write[9]  = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+                idx_write[12] = (ImDrawIdx)(idx2 + 2); idx_write[13] = (ImDrawIdx)(idx1 + 2); idx_write[14] = (ImDrawIdx)(idx1 + 3);
+                idx_write[15] = (ImDrawIdx)(idx1 + 3); idx_write[16] = (ImDrawIdx)(idx2 + 3); idx_write[17] = (ImDrawIdx)(idx2 + 2);
+            }
+            vtx_write += vtx_per_line;
+            idx_write += idx_per_line;
+            idx1 += vtx_per_line;
+        }
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx1;
+        ImDrawListBatchUnreserve(this);
+    }
+}
+
+// Same output as calling AddRectFilled() with no rounding for each element.
+void ImDrawList::AddRectFilledBatch(const ImVec2* p_min, const ImVec2* p_max, const ImU32* cols, int count)
+{
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        ImDrawListFingerprint(this, p_min, count * sizeof(ImVec2));
+        ImDrawListFingerprint(this, p_max, count * sizeof(ImVec2));
+        ImDrawListFingerprint(this, cols, count * sizeof(ImU32));
+        if (ImDrawListFingerprintSkip(this))
+            return;
+    }
+    if (Flags & ImDrawListFlags_InstancedQuads)
+    {
+        const ImVec2 uv = _Data->TexUvWhitePixel;
+        ImDrawQuad* quad_write = PrimReserveQuads(count);
+        ImDrawQuad* quad_write_end = quad_write + count;
+        for (int n = 0; n < count; n++)
+            if ((cols[n] & IM_COL32_A_MASK) != 0)
+            {
+                quad_write->Min = p_min[n]; quad_write->Max = p_max[n]; quad_write->UvMin = uv; quad_write->UvMax = uv; quad_write->Col = cols[n]; quad_write->Rounding = 0.0f; quad_write->Flags = 0;
+                quad_write++;
+            }
+        PrimUnreserveQuads((int)(quad_write_end - quad_write));
+        return;
+    }
+    for (int n = 0; n < count; )
+    {
+        const int chunk_end = n + ImDrawListBatchReserve(this, count - n, 6, 4);
+        for (; n < chunk_end; n++)
+            if ((cols[n] & IM_COL32_A_MASK) != 0)
+                PrimRect(p_min[n], p_max[n], cols[n]);
+        ImDrawListBatchUnreserve(this);
+    }
+}
+
+// Same output as calling AddQuadFilled() for each element. 'points' holds 4 consecutive points per quad.
+void ImDrawList::AddQuadFilledBatch(const ImVec2* points, const ImU32* cols, int count)
+{
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        ImDrawListFingerprint(this, points, count * 4 * sizeof(ImVec2));
+        ImDrawListFingerprint(this, cols, count * sizeof(ImU32));
+        if (ImDrawListFingerprintSkip(this))
+            return;
+    }
+    int idx_per_quad, vtx_per_quad;
+    ImDrawListCalcConvexPolyFilledCounts(this, 4, &idx_per_quad, &vtx_per_quad);
+    ImVec2 temp_normals[4];
+    for (int n = 0; n < count; )
+    {
+        const int chunk_end = n + ImDrawListBatchReserve(this, count - n, idx_per_quad, vtx_per_quad);
+        for (; n < chunk_end; n++)
+            if ((cols[n] & IM_COL32_A_MASK) != 0)
+                ImDrawListWriteConvexPolyFilled(this, points + n * 4, 4, cols[n], temp_normals);
+        ImDrawListBatchUnreserve(this);
+    }
+}
+
+// Same output as calling AddCircleFilled() for each element.
+// The tessellation of each circle depends on its radius (unless 'num_segments' is specified), so each chunk reserves for the largest one and releases the rest.
+void ImDrawList::AddCircleFilledBatch(const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments)
+{
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        ImDrawListFingerprint(this, centers, count * sizeof(ImVec2));
+        ImDrawListFingerprint(this, radii, count * sizeof(float));
+        ImDrawListFingerprint(this, cols, count * sizeof(ImU32));
+        ImDrawListFingerprint(this, &num_segments, sizeof(num_segments));
+        if (ImDrawListFingerprintSkip(this))
+            return;
+    }
+    if (num_segments <= 0 && ImDrawListUseSdfShapes(this))
+    {
+        // Single rounded quad per circle (ImDrawListFlags_SdfShapes)
+        const ImVec2 uv = _Data->TexUvWhitePixel;
+        ImDrawQuad* quad_write = PrimReserveQuads(count);
+        ImDrawQuad* quad_write_end = quad_write + count;
+        for (int n = 0; n < count; n++)
+            if ((cols[n] & IM_COL32_A_MASK) != 0 && radii[n] > 0.0f)
+            {
+                const ImVec2 half_size(radii[n], radii[n]);
+                quad_write->Min = centers[n] - half_size; quad_write->Max = centers[n] + half_size; quad_write->UvMin = uv; quad_write->UvMax = uv; quad_write->Col = cols[n]; quad_write->Rounding = radii[n]; quad_write->Flags = ImDrawFlags_RoundCornersAll;
+                quad_write++;
+            }
+        PrimUnreserveQuads((int)(quad_write_end - quad_write));
+        return;
+    }
+    if (num_segments > 0)
+        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+    const int max_points = (num_segments > 0) ? num_segments : IM_DRAWLIST_ARCFAST_SAMPLE_MAX;
+    int idx_per_circle, vtx_per_circle;
+    ImDrawListCalcConvexPolyFilledCounts(this, max_points, &idx_per_circle, &vtx_per_circle);
+    ImVec2* temp_normals = (ImVec2*)alloca(max_points * sizeof(ImVec2)); //-V630
+    const float a_max = (num_segments > 0) ? (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments : 0.0f;
+
+    for (int n = 0; n < count; )
+    {
+        const int chunk_end = n + ImDrawListBatchReserve(this, count - n, idx_per_circle, vtx_per_circle);
+        for (; n < chunk_end; n++)
+        {
+            if ((cols[n] & IM_COL32_A_MASK) == 0 || radii[n] <= 0.0f)
+                continue;
+            _Path.Size = 0;
+            if (num_segments <= 0)
+            {
+                _PathArcToFastEx(centers[n], radii[n], 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
+                _Path.Size--;
+            }
+            else
+            {
+                PathArcTo(centers[n], radii[n], 0.0f, a_max, num_segments - 1);
+            }
+            ImDrawListWriteConvexPolyFilled(this, _Path.Data, _Path.Size, cols[n], temp_normals);
+        }
+        ImDrawListBatchUnreserve(this);
+    }
+    _Path.Size = 0;
+}
+
+void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
+{
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+
+    if (text_end == NULL)
+        text_end = text_begin + strlen(text_begin);
+    if (text_begin == text_end)
+        return;
+
+    // Pull default font/size from the shared ImDrawListSharedData instance
+    if (font == NULL)
+        font = _Data->Font;
+    if (font_size == 0.0f)
+        font_size = _Data->FontSize;
+
+    IM_ASSERT(font->ContainerAtlas->TexID == _CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        const struct { ImVec2 Pos; float FontSize, WrapWidth; ImU32 Col; } params = { pos, font_size, wrap_width, col };
+        ImDrawListFingerprint(this, &font, sizeof(font));
+        ImDrawListFingerprint(this, &params, sizeof(params));
+        if (cpu_fine_clip_rect)
+            ImDrawListFingerprint(this, cpu_fine_clip_rect, sizeof(*cpu_fine_clip_rect));
+        ImDrawListFingerprint(this, text_begin, (size_t)(text_end - text_begin));
+        if (ImDrawListFingerprintSkip(this))
+            return;
+    }
+
+    ImVec4 clip_rect = _CmdHeader.ClipRect;
     if (cpu_fine_clip_rect)
     {
         clip_rect.x = ImMax(clip_rect.x, cpu_fine_clip_rect->x);
@@ -1616,8 +2641,26 @@ void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, cons
     if (push_texture_id)
         PushTextureID(user_texture_id);
 
-    PrimReserve(6, 4);
-    PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+    // Texture changes are fingerprinted by _OnChangedTextureID(), so we keep pushing/popping it when only fingerprinting
+    bool skip_output = false;
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        const struct { ImVec2 Min, Max, UvMin, UvMax; ImU32 Col; } params = { p_min, p_max, uv_min, uv_max, col };
+        ImDrawListFingerprint(this, &params, sizeof(params));
+        skip_output = ImDrawListFingerprintSkip(this);
+    }
+    if (!skip_output)
+    {
+        if (Flags & ImDrawListFlags_InstancedQuads)
+        {
+            PrimRectInstanced(p_min, p_max, uv_min, uv_max, col);
+        }
+        else
+        {
+            PrimReserve(6, 4);
+            PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+        }
+    }
 
     if (push_texture_id)
         PopTextureID();
@@ -1632,8 +2675,19 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, con
     if (push_texture_id)
         PushTextureID(user_texture_id);
 
-    PrimReserve(6, 4);
-    PrimQuadUV(p1, p2, p3, p4, uv1, uv2, uv3, uv4, col);
+    // Texture changes are fingerprinted by _OnChangedTextureID(), so we keep pushing/popping it when only fingerprinting
+    bool skip_output = false;
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        const struct { ImVec2 P[4], Uv[4]; ImU32 Col; } params = { { p1, p2, p3, p4 }, { uv1, uv2, uv3, uv4 }, col };
+        ImDrawListFingerprint(this, &params, sizeof(params));
+        skip_output = ImDrawListFingerprintSkip(this);
+    }
+    if (!skip_output)
+    {
+        PrimReserve(6, 4);
+        PrimQuadUV(p1, p2, p3, p4, uv1, uv2, uv3, uv4, col);
+    }
 
     if (push_texture_id)
         PopTextureID();
@@ -1655,6 +2709,19 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
     if (push_texture_id)
         PushTextureID(user_texture_id);
 
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        const ImVec2 uvs[] = { uv_min, uv_max };
+        ImDrawListFingerprint(this, uvs, sizeof(uvs));
+    }
+
+    if (ImDrawListTryAddSdfRect(this, p_min, p_max, uv_min, uv_max, col, rounding, flags))
+    {
+        if (push_texture_id)
+            PopTextureID();
+        return;
+    }
+
     int vert_start_idx = VtxBuffer.Size;
     PathRect(p_min, p_max, rounding, flags);
     PathFillConvex(col);
@@ -1688,8 +2755,9 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
-    IM_UNUSED(draw_list);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
+    if (draw_list->Flags & ImDrawListFlags_Fingerprint)
+        ImDrawListFingerprintStop(draw_list);
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
     {
@@ -1733,18 +2801,20 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().QuadCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
             ch._CmdBuffer.pop_back();
 
         if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
         {
             // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
             // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+            // Quads are not moved (all channels share QuadBuffer), so those need to be sequential.
             ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
+            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && ImDrawCmd_AreSequentialQuadOffset(last_cmd, next_cmd) && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
             {
                 // Merge previous channel last draw command with current channel first draw command if matching.
                 last_cmd->ElemCount += next_cmd->ElemCount;
+                last_cmd->QuadCount += next_cmd->QuadCount;
                 idx_offset += next_cmd->ElemCount;
                 ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
             }
@@ -1779,7 +2849,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount == 0)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0)
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
@@ -1792,6 +2862,8 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     IM_ASSERT(idx >= 0 && idx < _Count);
     if (_Current == idx)
         return;
+    if (draw_list->Flags & ImDrawListFlags_Fingerprint)
+        ImDrawListFingerprint(draw_list, &idx, sizeof(idx));
 
     // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
@@ -1805,12 +2877,201 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     ImDrawCmd* curr_cmd = (draw_list->CmdBuffer.Size == 0) ? NULL : &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd == NULL)
         draw_list->AddDrawCmd();
-    else if (curr_cmd->ElemCount == 0)
+    else if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0)
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawListCache
+//-----------------------------------------------------------------------------
+
+void ImDrawListCache::BeginRecord(ImDrawList* draw_list)
+{
+    IM_ASSERT(_RecordDrawList == NULL && "Mismatched BeginRecord()/EndRecord() calls!");
+    IM_ASSERT(draw_list->_Splitter._Count <= 1 && "Cannot record while using channels!");
+    _RecordDrawList = draw_list;
+    _RecordVtxStart = draw_list->VtxBuffer.Size;
+    _RecordIdxStart = draw_list->IdxBuffer.Size;
+    _RecordTextureId = draw_list->_CmdHeader.TextureId;
+    _RecordDrawListFlags = draw_list->Flags;
+    draw_list->Flags &= ~ImDrawListFlags_InstancedQuads;
+}
+
+// Copy the geometry added since BeginRecord(). Draw commands may have been split or merged in the meanwhile, so we walk all
+// commands overlapping the recorded index range and gather consecutive ones using the same texture into segments.
+void ImDrawListCache::EndRecord()
+{
+    ImDrawList* draw_list = _RecordDrawList;
+    IM_ASSERT(draw_list != NULL && "Mismatched BeginRecord()/EndRecord() calls!");
+    IM_ASSERT(draw_list->_Splitter._Count <= 1 && "Cannot record while using channels!");
+    _RecordDrawList = NULL;
+    draw_list->Flags |= (_RecordDrawListFlags & ImDrawListFlags_InstancedQuads);
+    Clear();
+    if (draw_list->IdxBuffer.Size == _RecordIdxStart)
+        return;
+    if (draw_list->_Data->Font != NULL)
+    {
+        FontAtlas = draw_list->_Data->Font->ContainerAtlas;
+        FontAtlasTexGeneration = FontAtlas->TexGeneration;
+    }
+
+    VtxBuffer.reserve(draw_list->VtxBuffer.Size - _RecordVtxStart);
+    IdxBuffer.reserve(draw_list->IdxBuffer.Size - _RecordIdxStart);
+    BoundsMin = ImVec2(FLT_MAX, FLT_MAX);
+    BoundsMax = ImVec2(-FLT_MAX, -FLT_MAX);
+    unsigned int seg_src_vtx = 0; // Index in draw_list->VtxBuffer[] of the first vertex of the current segment
+    for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* cmd = &draw_list->CmdBuffer.Data[cmd_n];
+        const int idx_begin = ImMax((int)cmd->IdxOffset, _RecordIdxStart);
+        const int idx_end = (int)(cmd->IdxOffset + cmd->ElemCount);
+        if (cmd->UserCallback != NULL || idx_end <= idx_begin)
+            continue;
+
+        // Vertex range used by this command
+        const ImDrawIdx* src_idx = draw_list->IdxBuffer.Data;
+        unsigned int vtx_min = (unsigned int)-1, vtx_max = 0;
+        for (int idx_n = idx_begin; idx_n < idx_end; idx_n++)
+        {
+            const unsigned int vtx_n = cmd->VtxOffset + src_idx[idx_n];
+            vtx_min = ImMin(vtx_min, vtx_n);
+            vtx_max = ImMax(vtx_max, vtx_n);
+        }
+        IM_ASSERT(vtx_min >= (unsigned int)_RecordVtxStart);
+
+        // Append to current segment, or start a new one
+        const bool use_current_texture = (cmd->TextureId == _RecordTextureId);
+        ImDrawListCacheSegment* seg = Segments.Size > 0 ? &Segments.back() : NULL;
+        if (seg == NULL || seg->TextureId != cmd->TextureId || vtx_min < seg_src_vtx || (sizeof(ImDrawIdx) == 2 && vtx_max - seg_src_vtx >= (1 << 16)))
+        {
+            ImDrawListCacheSegment new_seg;
+            new_seg.TextureId = cmd->TextureId;
+            new_seg.UseCurrentTexture = use_current_texture;
+            new_seg.VtxOffset = VtxBuffer.Size;
+            new_seg.VtxCount = 0;
+            new_seg.IdxOffset = IdxBuffer.Size;
+            new_seg.IdxCount = 0;
+            Segments.push_back(new_seg);
+            seg = &Segments.back();
+            seg_src_vtx = vtx_min;
+        }
+
+        // Copy vertices not already in the segment
+        const unsigned int seg_src_vtx_end = seg_src_vtx + (unsigned int)seg->VtxCount;
+        if (vtx_max >= seg_src_vtx_end)
+        {
+            const int copy_count = (int)(vtx_max + 1 - seg_src_vtx_end);
+            VtxBuffer.resize(VtxBuffer.Size + copy_count);
+            ImDrawVert* dst_vtx = VtxBuffer.Data + VtxBuffer.Size - copy_count;
+            memcpy(dst_vtx, draw_list->VtxBuffer.Data + seg_src_vtx_end, (size_t)copy_count * sizeof(ImDrawVert));
+            for (int vtx_n = 0; vtx_n < copy_count; vtx_n++)
+            {
+                BoundsMin = ImMin(BoundsMin, dst_vtx[vtx_n].pos);
+                BoundsMax = ImMax(BoundsMax, dst_vtx[vtx_n].pos);
+            }
+            seg->VtxCount += copy_count;
+        }
+
+        // Copy indices, relative to the segment
+        IdxBuffer.resize(IdxBuffer.Size + (idx_end - idx_begin));
+        ImDrawIdx* dst_idx = IdxBuffer.Data + IdxBuffer.Size - (idx_end - idx_begin);
+        const unsigned int idx_rebase = cmd->VtxOffset - seg_src_vtx;
+        for (int idx_n = idx_begin; idx_n < idx_end; idx_n++)
+            *dst_idx++ = (ImDrawIdx)(src_idx[idx_n] + idx_rebase);
+        seg->IdxCount += idx_end - idx_begin;
+    }
+}
+
+bool ImDrawListCache::IsStale() const
+{
+    return FontAtlas != NULL && FontAtlas->TexGeneration != FontAtlasTexGeneration;
+}
+
+// Multiply each channel of two colors
+static inline ImU32 ImDrawListCacheTint(ImU32 col, ImU32 tint_col)
+{
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        const ImU32 c = ((col >> shift) & 0xFF) * ((tint_col >> shift) & 0xFF) + 128;
+        out |= (((c + (c >> 8)) >> 8) & 0xFF) << shift; // c / 255 rounded, exact for all inputs
+    }
+    return out;
+}
+
+void ImDrawList::AddDrawListCache(const ImDrawListCache& cache, const ImVec2& offset, float scale, ImU32 tint_col)
+{
+    IM_ASSERT(cache._RecordDrawList == NULL && "Cannot replay while recording!");
+    IM_ASSERT(!cache.IsStale() && "Recorded glyphs moved in the font atlas: record again when IsStale() returns true!");
+    if (cache.IdxBuffer.Size == 0 || (tint_col & IM_COL32_A_MASK) == 0)
+        return;
+
+    // Coarse clipping
+    const ImVec4& clip_rect = _CmdHeader.ClipRect;
+    const ImVec2 bounds_min(cache.BoundsMin.x * scale + offset.x, cache.BoundsMin.y * scale + offset.y);
+    const ImVec2 bounds_max(cache.BoundsMax.x * scale + offset.x, cache.BoundsMax.y * scale + offset.y);
+    if (ImMax(bounds_min.x, bounds_max.x) < clip_rect.x || ImMin(bounds_min.x, bounds_max.x) > clip_rect.z || ImMax(bounds_min.y, bounds_max.y) < clip_rect.y || ImMin(bounds_min.y, bounds_max.y) > clip_rect.w)
+        return;
+    bool skip_output = false;
+    if (Flags & ImDrawListFlags_Fingerprint)
+    {
+        const float params[] = { offset.x, offset.y, scale };
+        ImDrawListFingerprint(this, cache.VtxBuffer.Data, cache.VtxBuffer.size_in_bytes());
+        ImDrawListFingerprint(this, cache.IdxBuffer.Data, cache.IdxBuffer.size_in_bytes());
+        ImDrawListFingerprint(this, params, sizeof(params));
+        ImDrawListFingerprint(this, &tint_col, sizeof(tint_col));
+        skip_output = ImDrawListFingerprintSkip(this);
+    }
+
+    const bool transform = (scale != 1.0f || offset.x != 0.0f || offset.y != 0.0f);
+    const bool tint = (tint_col != IM_COL32_WHITE);
+    for (int seg_n = 0; seg_n < cache.Segments.Size; seg_n++)
+    {
+        const ImDrawListCacheSegment& seg = cache.Segments.Data[seg_n];
+        const bool push_texture = !seg.UseCurrentTexture && seg.TextureId != _CmdHeader.TextureId;
+        if (push_texture)
+            PushTextureID(seg.TextureId);
+        if (skip_output)
+        {
+            // Keep texture changes, which are fingerprinted by _OnChangedTextureID()
+            if (push_texture)
+                PopTextureID();
+            continue;
+        }
+
+        PrimReserve(seg.IdxCount, seg.VtxCount);
+        const ImDrawVert* src_vtx = cache.VtxBuffer.Data + seg.VtxOffset;
+        if (!transform && !tint)
+        {
+            memcpy(_VtxWritePtr, src_vtx, (size_t)seg.VtxCount * sizeof(ImDrawVert));
+        }
+        else
+        {
+            for (int vtx_n = 0; vtx_n < seg.VtxCount; vtx_n++)
+            {
+                ImDrawVert* dst = &_VtxWritePtr[vtx_n];
+                *dst = src_vtx[vtx_n];
+                const ImVec2 src_pos = src_vtx[vtx_n].pos;
+                dst->pos = ImVec2(src_pos.x * scale + offset.x, src_pos.y * scale + offset.y);
+                if (tint)
+                    dst->col = ImDrawListCacheTint(src_vtx[vtx_n].col, tint_col);
+            }
+        }
+        const ImDrawIdx* src_idx = cache.IdxBuffer.Data + seg.IdxOffset;
+        const unsigned int idx_rebase = _VtxCurrentIdx;
+        for (int idx_n = 0; idx_n < seg.IdxCount; idx_n++)
+            _IdxWritePtr[idx_n] = (ImDrawIdx)(src_idx[idx_n] + idx_rebase);
+        _VtxWritePtr += seg.VtxCount;
+        _IdxWritePtr += seg.IdxCount;
+        _VtxCurrentIdx += seg.VtxCount;
+
+        if (push_texture)
+            PopTextureID();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawData
 //-----------------------------------------------------------------------------
@@ -1819,10 +3080,11 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 void ImDrawData::DeIndexAllBuffers()
 {
     ImVector<ImDrawVert> new_vtx_buffer;
-    TotalVtxCount = TotalIdxCount = 0;
+    TotalVtxCount = TotalIdxCount = TotalQuadCount = 0;
     for (int i = 0; i < CmdListsCount; i++)
     {
         ImDrawList* cmd_list = CmdLists[i];
+        cmd_list->ExpandInstancedQuads();
         if (cmd_list->IdxBuffer.empty())
             continue;
         new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
@@ -1850,6 +3112,405 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
     }
 }
 
+// Copy vertices and indices of CmdLists[cmd_lists_begin] to CmdLists[cmd_lists_end - 1] into contiguous buffers, e.g. mapped upload buffers.
+// - Each draw list is written at the same position as when copying all of them in order: after the vertices/indices of previous draw lists.
+//   'vtx_dst'/'idx_dst' always point to the start of the whole buffers, so that separate ranges of draw lists can be copied by different threads.
+// - Draw each command from index (number of indices of previous draw lists + ImDrawCmd::IdxOffset), with a base vertex depending on 'fmt'.
+// - Indices not used by any command (e.g. after Optimize() dropped commands) are left undefined with ImDrawIdxFormat_U32. QuadBuffer is not copied.
+void ImDrawData::CopyToBuffers(void* vtx_dst, void* idx_dst, ImDrawIdxFormat fmt, int cmd_lists_begin, int cmd_lists_end) const
+{
+    if (cmd_lists_end < 0)
+        cmd_lists_end = CmdListsCount;
+    IM_ASSERT(cmd_lists_begin >= 0 && cmd_lists_begin <= cmd_lists_end && cmd_lists_end <= CmdListsCount);
+    IM_ASSERT(fmt == ImDrawIdxFormat_Native || fmt == ImDrawIdxFormat_U32);
+
+    unsigned int global_vtx_offset = 0;
+    unsigned int global_idx_offset = 0;
+    for (int n = 0; n < cmd_lists_begin; n++)
+    {
+        global_vtx_offset += (unsigned int)CmdLists[n]->VtxBuffer.Size;
+        global_idx_offset += (unsigned int)CmdLists[n]->IdxBuffer.Size;
+    }
+    for (int n = cmd_lists_begin; n < cmd_lists_end; n++)
+    {
+        const ImDrawList* cmd_list = CmdLists[n];
+        if (vtx_dst != NULL && cmd_list->VtxBuffer.Size > 0)
+            memcpy((ImDrawVert*)vtx_dst + global_vtx_offset, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.size_in_bytes());
+        if (idx_dst != NULL && cmd_list->IdxBuffer.Size > 0)
+        {
+            if (fmt == ImDrawIdxFormat_Native)
+            {
+                memcpy((ImDrawIdx*)idx_dst + global_idx_offset, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.size_in_bytes());
+            }
+            else
+            {
+                // Indices are relative to ImDrawCmd::VtxOffset, which may differ between commands
+                ImU32* idx_write = (ImU32*)idx_dst + global_idx_offset;
+                for (const ImDrawCmd* cmd = cmd_list->CmdBuffer.begin(); cmd != cmd_list->CmdBuffer.end(); cmd++)
+                {
+                    if (cmd->UserCallback != NULL)
+                        continue;
+                    const ImU32 base_vtx = global_vtx_offset + cmd->VtxOffset;
+                    const ImDrawIdx* idx_read = cmd_list->IdxBuffer.Data + cmd->IdxOffset;
+                    for (unsigned int idx_n = 0; idx_n < cmd->ElemCount; idx_n++)
+                        idx_write[cmd->IdxOffset + idx_n] = base_vtx + idx_read[idx_n];
+                }
+            }
+        }
+        global_vtx_offset += (unsigned int)cmd_list->VtxBuffer.Size;
+        global_idx_offset += (unsigned int)cmd_list->IdxBuffer.Size;
+    }
+}
+
+// Bounding box of the vertices (or instanced quads) referenced by a command
+static ImRect ImDrawCmdCalcBounds(const ImDrawList* draw_list, const ImDrawCmd* cmd)
+{
+    ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    const ImDrawQuad* quad = draw_list->QuadBuffer.Data + cmd->QuadOffset;
+    for (unsigned int quad_n = 0; quad_n < cmd->QuadCount; quad_n++, quad++)
+    {
+        bounds.Add(quad->Min);
+        bounds.Add(quad->Max);
+    }
+    const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd->IdxOffset;
+    const ImDrawVert* vtx = draw_list->VtxBuffer.Data + cmd->VtxOffset;
+    for (unsigned int idx_n = 0; idx_n < cmd->ElemCount; idx_n++)
+        bounds.Add(vtx[idx[idx_n]].pos);
+    return bounds;
+}
+
+// Return true if nothing would be rendered: the geometry is entirely outside of the clipping rectangle or display area.
+// Scissor rectangles are generally truncated to integers by backends, so the left/top edges are tested against their rounded down values.
+static bool ImDrawCmdIsClippedOut(const ImVec4& clip_rect, const ImRect& bounds, const ImVec4& display_rect)
+{
+    if (clip_rect.z <= clip_rect.x || clip_rect.w <= clip_rect.y)
+        return true;
+    if (bounds.Max.x <= ImFloor(clip_rect.x) || bounds.Max.y <= ImFloor(clip_rect.y) || bounds.Min.x >= clip_rect.z || bounds.Min.y >= clip_rect.w)
+        return true;
+    return bounds.Max.x <= display_rect.x || bounds.Max.y <= display_rect.y || bounds.Min.x >= display_rect.z || bounds.Min.y >= display_rect.w;
+}
+
+// Return true if geometry within 'bounds' renders the same when clipped by 'clip_rect_merged' instead of 'clip_rect' (which it contains).
+// Each edge of the merged rectangle needs to be either unchanged, or not to cut into the geometry.
+static bool ImDrawCmdIsClipRectReplaceable(const ImVec4& clip_rect, const ImRect& bounds, const ImVec4& clip_rect_merged)
+{
+    if (clip_rect_merged.x != clip_rect.x && bounds.Min.x < clip_rect.x) return false;
+    if (clip_rect_merged.y != clip_rect.y && bounds.Min.y < clip_rect.y) return false;
+    if (clip_rect_merged.z != clip_rect.z && bounds.Max.x > ImFloor(clip_rect.z)) return false;
+    if (clip_rect_merged.w != clip_rect.w && bounds.Max.y > ImFloor(clip_rect.w)) return false;
+    return true;
+}
+
+// Try to find a clipping rectangle under which two commands can be drawn together, without changing what is visible.
+static bool ImDrawCmdTryMergeClipRect(const ImVec4& clip_rect_0, const ImRect& bounds_0, const ImVec4& clip_rect_1, const ImRect& bounds_1, ImVec4* out_clip_rect)
+{
+    if (memcmp(&clip_rect_0, &clip_rect_1, sizeof(ImVec4)) == 0)
+    {
+        *out_clip_rect = clip_rect_0;
+        return true;
+    }
+    const ImVec4 clip_rect_merged(ImMin(clip_rect_0.x, clip_rect_1.x), ImMin(clip_rect_0.y, clip_rect_1.y), ImMax(clip_rect_0.z, clip_rect_1.z), ImMax(clip_rect_0.w, clip_rect_1.w));
+    if (!ImDrawCmdIsClipRectReplaceable(clip_rect_0, bounds_0, clip_rect_merged) || !ImDrawCmdIsClipRectReplaceable(clip_rect_1, bounds_1, clip_rect_merged))
+        return false;
+    *out_clip_rect = clip_rect_merged;
+    return true;
+}
+
+// Drop commands which render nothing and merge consecutive commands which can be drawn as one. Output bounds of the last command.
+static void ImDrawDataOptimizeCmds(ImDrawList* draw_list, const ImVec4& display_rect, ImRect* out_last_bounds)
+{
+    ImDrawCmd* cmds = draw_list->CmdBuffer.Data;
+    ImRect prev_bounds;
+    int dst_n = 0;
+    for (int src_n = 0; src_n < draw_list->CmdBuffer.Size; src_n++)
+    {
+        ImDrawCmd* src_cmd = &cmds[src_n];
+        ImRect bounds;
+        if (src_cmd->UserCallback == NULL)
+        {
+            if (src_cmd->ElemCount == 0 && src_cmd->QuadCount == 0)
+                continue;
+            bounds = ImDrawCmdCalcBounds(draw_list, src_cmd);
+            if (ImDrawCmdIsClippedOut(src_cmd->ClipRect, bounds, display_rect))
+                continue;
+            ImDrawCmd* prev_cmd = (dst_n > 0) ? &cmds[dst_n - 1] : NULL;
+            ImVec4 clip_rect;
+            if (prev_cmd && prev_cmd->UserCallback == NULL && prev_cmd->TextureId == src_cmd->TextureId && prev_cmd->VtxOffset == src_cmd->VtxOffset && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, src_cmd) && ImDrawCmd_AreSequentialQuadOffset(prev_cmd, src_cmd))
+                if (ImDrawCmdTryMergeClipRect(prev_cmd->ClipRect, prev_bounds, src_cmd->ClipRect, bounds, &clip_rect))
+                {
+                    prev_cmd->ClipRect = clip_rect;
+                    prev_cmd->ElemCount += src_cmd->ElemCount;
+                    prev_cmd->QuadCount += src_cmd->QuadCount;
+                    prev_bounds.Add(bounds);
+                    continue;
+                }
+        }
+        if (dst_n != src_n)
+            cmds[dst_n] = *src_cmd;
+        prev_bounds = bounds;
+        dst_n++;
+    }
+    draw_list->CmdBuffer.resize(dst_n);
+    *out_last_bounds = prev_bounds;
+}
+
+// Append 'src_list' into 'dst_list' if the first command of 'src_list' can be merged with the last command of 'dst_list'.
+// Indices of 'src_list' are rebased so that they share the VtxOffset of the last command of 'dst_list'. Instanced quads are appended as well.
+static bool ImDrawDataTryAppendList(ImDrawList* dst_list, ImRect* dst_last_bounds, const ImDrawList* src_list, const ImRect& src_last_bounds)
+{
+    ImDrawCmd* dst_cmd = &dst_list->CmdBuffer.back();
+    const ImDrawCmd* src_cmd = &src_list->CmdBuffer.Data[0];
+    if (dst_cmd->UserCallback != NULL || src_cmd->UserCallback != NULL || dst_cmd->TextureId != src_cmd->TextureId)
+        return false;
+    if (dst_cmd->QuadCount != 0)
+    {
+        if (src_cmd->QuadCount == 0 || dst_cmd->QuadOffset + dst_cmd->QuadCount != (unsigned int)dst_list->QuadBuffer.Size || src_cmd->QuadOffset != 0)
+            return false;
+    }
+    else if (src_cmd->QuadCount != 0 || dst_cmd->IdxOffset + dst_cmd->ElemCount != (unsigned int)dst_list->IdxBuffer.Size || src_cmd->IdxOffset != 0) // Commands dropped at the start of 'src_list' would leave unused indices in between
+    {
+        return false;
+    }
+    for (int cmd_n = 0; cmd_n < src_list->CmdBuffer.Size; cmd_n++)
+        if (src_list->CmdBuffer.Data[cmd_n].VtxOffset != 0)
+            return false;
+    const unsigned int vtx_rebase = (unsigned int)dst_list->VtxBuffer.Size - dst_cmd->VtxOffset;
+    if (sizeof(ImDrawIdx) == 2 && vtx_rebase + (unsigned int)src_list->VtxBuffer.Size > (1 << 16))
+        return false;
+    const ImRect src_bounds = (src_list->CmdBuffer.Size == 1) ? src_last_bounds : ImDrawCmdCalcBounds(src_list, src_cmd);
+    ImVec4 clip_rect;
+    if (!ImDrawCmdTryMergeClipRect(dst_cmd->ClipRect, *dst_last_bounds, src_cmd->ClipRect, src_bounds, &clip_rect))
+        return false;
+
+    const int vtx_base = dst_list->VtxBuffer.Size;
+    const int idx_base = dst_list->IdxBuffer.Size;
+    dst_list->VtxBuffer.resize(vtx_base + src_list->VtxBuffer.Size);
+    memcpy(dst_list->VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.size_in_bytes());
+    dst_list->IdxBuffer.resize(idx_base + src_list->IdxBuffer.Size);
+    ImDrawIdx* dst_idx = dst_list->IdxBuffer.Data + idx_base;
+    for (int idx_n = 0; idx_n < src_list->IdxBuffer.Size; idx_n++)
+        dst_idx[idx_n] = (ImDrawIdx)(src_list->IdxBuffer.Data[idx_n] + vtx_rebase);
+    const int quad_base = dst_list->QuadBuffer.Size;
+    dst_list->QuadBuffer.resize(quad_base + src_list->QuadBuffer.Size);
+    if (src_list->QuadBuffer.Size > 0)
+        memcpy(dst_list->QuadBuffer.Data + quad_base, src_list->QuadBuffer.Data, (size_t)src_list->QuadBuffer.size_in_bytes());
+
+    dst_cmd->ClipRect = clip_rect;
+    dst_cmd->ElemCount += src_cmd->ElemCount;
+    dst_cmd->QuadCount += src_cmd->QuadCount;
+    dst_last_bounds->Add(src_bounds);
+    for (int cmd_n = 1; cmd_n < src_list->CmdBuffer.Size; cmd_n++)
+    {
+        ImDrawCmd cmd = src_list->CmdBuffer.Data[cmd_n];
+        cmd.VtxOffset = dst_cmd->VtxOffset;
+        cmd.IdxOffset += idx_base;
+        cmd.QuadOffset += quad_base;
+        dst_list->CmdBuffer.push_back(cmd);
+        dst_cmd = &dst_list->CmdBuffer.back(); // push_back() may reallocate
+    }
+    if (src_list->CmdBuffer.Size > 1)
+        *dst_last_bounds = src_last_bounds;
+    return true;
+}
+
+// Reduce the number of draw calls issued by the backend. Call after ImGui::Render() and before rendering.
+// - Drop commands with no elements, or whose geometry is entirely outside of their clipping rectangle or of the display area.
+// - Merge consecutive commands sharing the same texture, when their clipping rectangles are equal or when the bounding rectangle of both
+//   wouldn't cut differently into their geometry. This allows e.g. the contents of neighboring windows to be merged.
+// - Merging applies across draw lists: when the first command of a list can be merged with the last command of the previous list, the list
+//   is appended into the previous list and removed from CmdLists[].
+//   TotalVtxCount/TotalIdxCount/TotalQuadCount are unchanged, except for lists left without any command, which are removed.
+// - Draw lists are modified in place, there is no copy. For draw data output by Render(), these are the draw lists of the context: until the
+//   next NewFrame()/Begin() resets them, a window draw list may hold commands of windows drawn after it, and the Metrics/Debugger window or
+//   code inspecting them sees the optimized output. Call Optimize() on your own copy of the draw data and draw lists if this matters.
+// - Commands with a user callback are never merged or dropped.
+// - Assume that scissor rectangles are rounded down to integers by the backend (which is the case for all standard backends).
+int ImDrawData::Optimize()
+{
+    IM_ASSERT(Valid);
+    const ImVec4 display_rect(DisplayPos.x, DisplayPos.y, DisplayPos.x + DisplaySize.x, DisplayPos.y + DisplaySize.y);
+    int cmd_count_before = 0;
+    int cmd_count_after = 0;
+    int dst_list_n = 0;
+    ImRect dst_last_bounds;
+    for (int src_list_n = 0; src_list_n < CmdListsCount; src_list_n++)
+    {
+        ImDrawList* src_list = CmdLists[src_list_n];
+        cmd_count_before += src_list->CmdBuffer.Size;
+        ImRect src_last_bounds;
+        ImDrawDataOptimizeCmds(src_list, display_rect, &src_last_bounds);
+        if (src_list->CmdBuffer.Size == 0)
+        {
+            TotalVtxCount -= src_list->VtxBuffer.Size;
+            TotalIdxCount -= src_list->IdxBuffer.Size;
+            TotalQuadCount -= src_list->QuadBuffer.Size;
+            continue;
+        }
+        if (dst_list_n > 0 && ImDrawDataTryAppendList(CmdLists[dst_list_n - 1], &dst_last_bounds, src_list, src_last_bounds))
+            continue;
+        CmdLists[dst_list_n++] = src_list;
+        dst_last_bounds = src_last_bounds;
+    }
+    CmdListsCount = dst_list_n;
+    for (int list_n = 0; list_n < CmdListsCount; list_n++)
+        cmd_count_after += CmdLists[list_n]->CmdBuffer.Size;
+    return cmd_count_before - cmd_count_after;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawDataDamageTracker
+//-----------------------------------------------------------------------------
+
+// Cheap order-dependent combination of hashes, for tiles which may accumulate many elements
+static inline ImU32 ImDrawDataDamageHashCombine(ImU32 hash, ImU32 value)
+{
+    hash = (hash ^ value) * 0x9E3779B1u;
+    return hash ^ (hash >> 15);
+}
+
+template<typename T>
+static inline ImU32 ImDrawDataDamageHashElem(ImU32 hash, const T* elem)
+{
+    ImU32 words[(sizeof(T) + 3) / 4] = {};
+    memcpy(words, elem, sizeof(T));
+    for (int n = 0; n < IM_ARRAYSIZE(words); n++)
+        hash = ImDrawDataDamageHashCombine(hash, words[n]);
+    return hash;
+}
+
+// Hash all triangles (and instanced quads) into the tiles they may touch, then output rectangles covering all tiles which changed since last call.
+// - A triangle touches the pixels whose center it covers, so its bounding box is extended by half a pixel on its left/top side.
+// - When a triangle is cut by its clipping rectangle, the clipping rectangle (restricted to the tile) is part of the hash.
+// - Areas rendered by user callbacks are always damaged, as we can't know what they render (except for ImDrawCallback_ResetRenderState).
+// - Changes of display position, size or framebuffer scale damage the whole display.
+void ImDrawDataDamageTracker::Update(ImDrawData* draw_data)
+{
+    const float tile_size = (float)IM_DRAWDATA_DAMAGE_TILE_SIZE;
+    const ImVec2 display_pos = draw_data->DisplayPos;
+    const ImVec2 display_max(display_pos.x + draw_data->DisplaySize.x, display_pos.y + draw_data->DisplaySize.y);
+    const int tiles_x = ImMax((int)ImCeil(draw_data->DisplaySize.x / tile_size), 0);
+    const int tiles_y = ImMax((int)ImCeil(draw_data->DisplaySize.y / tile_size), 0);
+    const bool full_damage = (tiles_x != TilesX || tiles_y != TilesY || TileHashesPrev.Size != tiles_x * tiles_y || memcmp(&display_pos, &DisplayPos, sizeof(ImVec2)) != 0
+        || memcmp(&draw_data->DisplaySize, &DisplaySize, sizeof(ImVec2)) != 0 || memcmp(&draw_data->FramebufferScale, &FramebufferScale, sizeof(ImVec2)) != 0);
+    TilesX = tiles_x;
+    TilesY = tiles_y;
+    DisplayPos = display_pos;
+    DisplaySize = draw_data->DisplaySize;
+    FramebufferScale = draw_data->FramebufferScale;
+    FrameCount++;
+
+    TileHashes.resize(tiles_x * tiles_y);
+    memset(TileHashes.Data, 0, (size_t)TileHashes.size_in_bytes());
+    for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd* cmd = &draw_list->CmdBuffer.Data[cmd_n];
+            const ImRect clip_rect(ImMax(cmd->ClipRect.x, display_pos.x), ImMax(cmd->ClipRect.y, display_pos.y), ImMin(cmd->ClipRect.z, display_max.x), ImMin(cmd->ClipRect.w, display_max.y));
+            if (clip_rect.Min.x >= clip_rect.Max.x || clip_rect.Min.y >= clip_rect.Max.y)
+                continue;
+            const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd->IdxOffset;
+            const ImDrawVert* vtx = draw_list->VtxBuffer.Data + cmd->VtxOffset;
+            const ImDrawQuad* quads = draw_list->QuadBuffer.Data + cmd->QuadOffset;
+            const bool is_callback = (cmd->UserCallback != NULL);
+            if (is_callback && cmd->UserCallback == ImDrawCallback_ResetRenderState)
+                continue;
+            const ImU32 cmd_seed = ImHashData(&cmd->TextureId, sizeof(cmd->TextureId), is_callback ? (ImU32)FrameCount : 0);
+            const unsigned int elem_count = is_callback ? 1 : (cmd->QuadCount != 0) ? cmd->QuadCount : cmd->ElemCount / 3; // Callbacks are processed as a single element covering their clipping rectangle
+            for (unsigned int elem_n = 0; elem_n < elem_count; elem_n++)
+            {
+                // Bounding box of the triangle or quad (or of the clipping rectangle for callbacks)
+                ImRect bb;
+                ImU32 elem_hash = cmd_seed;
+                if (is_callback)
+                {
+                    bb = clip_rect;
+                }
+                else if (cmd->QuadCount != 0)
+                {
+                    const ImDrawQuad* quad = &quads[elem_n];
+                    const float fringe = (quad->Rounding > 0.0f) ? 0.5f : 0.0f; // Rounded quads are drawn expanded by half a pixel
+                    bb.Min = ImVec2(ImMin(quad->Min.x, quad->Max.x) - 0.5f - fringe, ImMin(quad->Min.y, quad->Max.y) - 0.5f - fringe);
+                    bb.Max = ImVec2(ImMax(quad->Min.x, quad->Max.x) + fringe, ImMax(quad->Min.y, quad->Max.y) + fringe);
+                    elem_hash = ImDrawDataDamageHashElem(elem_hash, quad);
+                }
+                else
+                {
+                    const ImDrawVert* v0 = &vtx[idx[elem_n * 3]];
+                    const ImDrawVert* v1 = &vtx[idx[elem_n * 3 + 1]];
+                    const ImDrawVert* v2 = &vtx[idx[elem_n * 3 + 2]];
+                    const ImVec2 p0 = v0->pos, p1 = v1->pos, p2 = v2->pos;
+                    bb.Min = ImVec2(ImMin(p0.x, ImMin(p1.x, p2.x)) - 0.5f, ImMin(p0.y, ImMin(p1.y, p2.y)) - 0.5f);
+                    bb.Max = ImVec2(ImMax(p0.x, ImMax(p1.x, p2.x)), ImMax(p0.y, ImMax(p1.y, p2.y)));
+                    elem_hash = ImDrawDataDamageHashElem(elem_hash, v0);
+                    elem_hash = ImDrawDataDamageHashElem(elem_hash, v1);
+                    elem_hash = ImDrawDataDamageHashElem(elem_hash, v2);
+                }
+                if (!clip_rect.Overlaps(bb))
+                    continue;
+                const bool is_clipped = !clip_rect.Contains(bb);
+                bb.ClipWithFull(clip_rect);
+
+                const int tile_x0 = ImClamp((int)ImFloor((bb.Min.x - display_pos.x) / tile_size), 0, tiles_x - 1);
+                const int tile_y0 = ImClamp((int)ImFloor((bb.Min.y - display_pos.y) / tile_size), 0, tiles_y - 1);
+                const int tile_x1 = ImClamp((int)ImFloor((bb.Max.x - display_pos.x) / tile_size), 0, tiles_x - 1);
+                const int tile_y1 = ImClamp((int)ImFloor((bb.Max.y - display_pos.y) / tile_size), 0, tiles_y - 1);
+                for (int tile_y = tile_y0; tile_y <= tile_y1; tile_y++)
+                    for (int tile_x = tile_x0; tile_x <= tile_x1; tile_x++)
+                    {
+                        ImU32* tile_hash = &TileHashes.Data[tile_y * tiles_x + tile_x];
+                        *tile_hash = ImDrawDataDamageHashCombine(*tile_hash, elem_hash);
+                        if (is_clipped)
+                        {
+                            ImRect tile_clip_rect(display_pos.x + tile_x * tile_size, display_pos.y + tile_y * tile_size, display_pos.x + (tile_x + 1) * tile_size, display_pos.y + (tile_y + 1) * tile_size);
+                            tile_clip_rect.ClipWithFull(clip_rect);
+                            *tile_hash = ImDrawDataDamageHashCombine(*tile_hash, ImHashData(&tile_clip_rect, sizeof(tile_clip_rect)));
+                        }
+                    }
+            }
+        }
+    }
+
+    // Merge damaged tiles into rectangles: horizontal runs of tiles, extended downward while the run below has the same extent.
+    Rects.resize(0);
+    if (full_damage)
+    {
+        if (tiles_x > 0 && tiles_y > 0)
+            Rects.push_back(ImVec4(display_pos.x, display_pos.y, display_max.x, display_max.y));
+    }
+    else
+    {
+        for (int tile_y = 0; tile_y < tiles_y; tile_y++)
+        {
+            const float y0 = display_pos.y + tile_y * tile_size;
+            const float y1 = ImMin(y0 + tile_size, display_max.y);
+            const ImU32* row_hashes = &TileHashes.Data[tile_y * tiles_x];
+            const ImU32* row_hashes_prev = &TileHashesPrev.Data[tile_y * tiles_x];
+            for (int tile_x = 0; tile_x < tiles_x; tile_x++)
+            {
+                if (row_hashes[tile_x] == row_hashes_prev[tile_x])
+                    continue;
+                int tile_x_end = tile_x + 1;
+                while (tile_x_end < tiles_x && row_hashes[tile_x_end] != row_hashes_prev[tile_x_end])
+                    tile_x_end++;
+                const float x0 = display_pos.x + tile_x * tile_size;
+                const float x1 = ImMin(display_pos.x + tile_x_end * tile_size, display_max.x);
+                ImVec4* rect_to_extend = NULL;
+                for (int rect_n = 0; rect_n < Rects.Size && rect_to_extend == NULL; rect_n++)
+                    if (Rects.Data[rect_n].w == y0 && Rects.Data[rect_n].x == x0 && Rects.Data[rect_n].z == x1)
+                        rect_to_extend = &Rects.Data[rect_n];
+                if (rect_to_extend)
+                    rect_to_extend->w = y1;
+                else
+                    Rects.push_back(ImVec4(x0, y0, x1, y1));
+                tile_x = tile_x_end;
+            }
+        }
+    }
+    TileHashes.swap(TileHashesPrev);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -1894,12 +3555,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos) - a, scale), min, max);
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos) - a, scale);
     }
 }
 
@@ -1972,10 +3633,14 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(109,0),ImVec2(13,15), ImVec2( 6, 7) }, // ImGuiMouseCursor_NotAllowed
 };
 
+static void ImFontAtlasDestroyDynamicGlyphs(ImFontAtlas* atlas);
+
 ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
     TexGlyphPadding = 1;
+    TexSdfSpread = 4;
+    TexUvSdfMinV = FLT_MAX;
     PackIdMouseCursors = PackIdLines = -1;
 }
 
@@ -1988,6 +3653,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(DynamicGlyphs == NULL && "Cannot clear input data used to rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs)!");
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -2011,6 +3677,7 @@ void    ImFontAtlas::ClearInputData()
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(DynamicGlyphs == NULL && "Cannot clear texture data updated when rasterizing glyphs on demand (ImFontAtlasFlags_DynamicGlyphs)!");
     if (TexPixelsAlpha8)
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
@@ -2024,12 +3691,14 @@ void    ImFontAtlas::ClearTexData()
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDestroyDynamicGlyphs(this);
     Fonts.clear_delete();
     TexReady = false;
 }
 
 void    ImFontAtlas::Clear()
 {
+    ImFontAtlasDestroyDynamicGlyphs(this);
     ClearInputData();
     ClearTexData();
     ClearFonts();
@@ -2281,8 +3950,22 @@ bool    ImFontAtlas::Build()
         IM_ASSERT(0); // Invalid Build function
 #endif
     }
+    bool signed_distance_field = false;
+    for (int src_n = 0; src_n < ConfigData.Size; src_n++)
+        signed_distance_field |= ConfigData[src_n].SignedDistanceField;
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    IM_ASSERT((!(Flags & ImFontAtlasFlags_DynamicGlyphs) || builder_io->FontBuilder_Build == ImFontAtlasGetBuilderForStbTruetype()->FontBuilder_Build) && "ImFontAtlasFlags_DynamicGlyphs requires the stb_truetype builder!");
+    IM_ASSERT((!signed_distance_field || builder_io->FontBuilder_Build == ImFontAtlasGetBuilderForStbTruetype()->FontBuilder_Build) && "ImFontConfig::SignedDistanceField requires the stb_truetype builder!");
+#else
+    IM_ASSERT(!(Flags & ImFontAtlasFlags_DynamicGlyphs) && "ImFontAtlasFlags_DynamicGlyphs requires the stb_truetype builder!");
+    IM_ASSERT(!signed_distance_field && "ImFontConfig::SignedDistanceField requires the stb_truetype builder!");
+#endif
+    IM_ASSERT((!signed_distance_field || !(Flags & ImFontAtlasFlags_DynamicGlyphs)) && "ImFontConfig::SignedDistanceField is not supported with ImFontAtlasFlags_DynamicGlyphs!");
+    IM_UNUSED(signed_distance_field);
 
     // Build
+    TexUvSdfMinV = FLT_MAX;
+    TexGeneration++;
     return builder_io->FontBuilder_Build(this);
 }
 
@@ -2303,6 +3986,16 @@ void    ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsig
             data[i] = table[data[i]];
 }
 
+// CPU reference of the coverage renderer backends supporting ImGuiBackendFlags_RendererHasSdfText are expected to compute for a pixel at V >= ImFontAtlas::TexUvSdfMinV.
+// - 'sdf_value' is the alpha sampled from the texture with bilinear filtering (0.0f..1.0f), 'sdf_spread' is ImFontAtlas::TexSdfSpread.
+// - 'texels_per_pixel' is the size of the pixel footprint in texels (larger when the glyph is rendered smaller than it was baked).
+// - The final color is Col * coverage, the RGB channels of the texture being white.
+float ImFontSdfCalcCoverage(float sdf_value, float sdf_spread, float texels_per_pixel)
+{
+    const float dist = (sdf_value * 255.0f - 128.0f) * (sdf_spread / 128.0f); // Distance to the glyph outline in texels, positive inside
+    return ImSaturate(dist / ImMax(texels_per_pixel, 1e-6f) + 0.5f);
+}
+
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 // Temporary data for one source font (multiple source fonts can be merged into one destination ImFont)
 // (C++03 doesn't allow instancing ImVector<> with function-local types so we declare the type here.)
@@ -2318,6 +4011,8 @@ struct ImFontBuildSrcData
     int                 GlyphsCount;        // Glyph count (excluding missing glyphs and glyphs already set by an earlier source font)
     ImBitVector         GlyphsSet;          // Glyph bit map (random access, 1-bit per codepoint. This will be a maximum of 8KB)
     ImVector<int>       GlyphsList;         // Glyph codepoints list (flattened version of GlyphsMap)
+    int                 GlyphsMaxWidth;     // Largest glyph rectangle, including padding (ImFontAtlasFlags_DynamicGlyphs)
+    int                 GlyphsMaxHeight;
 };
 
 // Temporary data for one destination ImFont* (multiple source fonts can be merged into one destination ImFont)
@@ -2329,6 +4024,22 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Rasterization job: a few consecutive glyphs of a source font. Jobs may run in parallel, see ImFontAtlas::BuildParallelFor.
+struct ImFontBuildRenderJob
+{
+    int                 SrcIndex;
+    int                 GlyphStart;
+    int                 GlyphCount;
+};
+
+struct ImFontBuildRenderJobsData
+{
+    ImFontAtlas*                    Atlas;
+    const stbtt_pack_context*       PackContext;
+    ImFontBuildSrcData*             SrcTmpArray;
+    const ImFontBuildRenderJob*     Jobs;
+};
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2341,6 +4052,445 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+//-------------------------------------------------------------------------
+// Glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+//-------------------------------------------------------------------------
+// - Build() computes metrics of all requested glyphs without rasterizing them. ImFont::FindGlyph() rasterizes them on first use.
+// - The texture region below the regular atlas contents is split into shelves (horizontal strips) added on demand. The cells of a shelf
+//   are large enough for any glyph of the source font owning the shelf. Once the region is full, cells are recycled by NewFrame(),
+//   least recently used first, and shelves not used during the last frame may be handed over to another source font.
+// - FindGlyph() may be called from worker threads building draw lists: rasterization is serialized with a spin lock,
+//   cache hits only use atomic loads and stores. Eviction only happens in NewFrame(), when no draw list is being built.
+//-------------------------------------------------------------------------
+
+struct ImFontDynamicGlyphSrc
+{
+    stbtt_fontinfo      FontInfo;
+    float               Scale;
+    int                 CellWidth;          // Largest glyph of this source, including padding. 0 if the source has no glyph.
+    int                 CellHeight;
+    int                 MissedCount;        // Number of glyphs which couldn't be given a cell since the last NewFrame()
+    ImVector<int>       FreeCells;          // Indices into ImFontAtlasDynamicGlyphs::Cells[]
+};
+
+struct ImFontDynamicGlyphShelf
+{
+    int                 Y;
+    int                 Height;             // Including padding
+    int                 SrcIndex;           // Source font owning the cells of this shelf
+    int                 CellWidth;
+    int                 CellsCount;         // Cells of shelf N are stored at Cells[N * CellsPerShelfMax]
+};
+
+struct ImFontDynamicGlyph
+{
+    int                 SrcIndex;           // Index into atlas->ConfigData[]. -1 for glyphs which are always resident (e.g. custom rectangle glyphs).
+    int                 GlyphIndex;         // stb_truetype glyph index
+    int                 CellIndex;          // Index into ImFontAtlasDynamicGlyphs::Cells[], -1 when not resident
+    int                 LastUsedFrame;      // Atomic
+    int                 Resident;           // Atomic. Set when texture coordinates of the ImFontGlyph are valid.
+    bool                Pinned;             // Never evicted
+};
+
+// Temporary data used by Build() to register glyphs rasterized on demand
+struct ImFontBuildDynamicGlyph
+{
+    ImFont*             Font;
+    int                 GlyphN;             // Index into Font->Glyphs[]
+    int                 SrcIndex;
+    int                 GlyphIndex;
+};
+
+struct ImFontAtlasDynamicGlyphs
+{
+    int                                 Lock;               // Atomic. Held while rasterizing.
+    int                                 FrameCount;         // Incremented by NewFrame()
+    int                                 ShelvesY;           // First texture line not used by a shelf
+    int                                 CellsPerShelfMax;
+    ImVector<ImFontDynamicGlyphSrc>     Sources;            // Same indices as atlas->ConfigData[]
+    ImVector<ImFontDynamicGlyphShelf>   Shelves;
+    ImVector<int>                       Cells;              // Index into Glyphs[] of the glyph stored in each cell, -1 when free
+    ImVector<ImFontDynamicGlyph>        Glyphs;             // For all glyphs of all fonts. See ImFont::DynamicGlyphsOffset.
+    ImVector<ImU64>                     EvictCandidates;    // Temporary storage: (LastUsedFrame << 32) | cell index
+
+    ImFontAtlasDynamicGlyphs()          { Lock = FrameCount = ShelvesY = CellsPerShelfMax = 0; }
+    ~ImFontAtlasDynamicGlyphs()         { Sources.clear_destruct(); }
+};
+
+static void ImFontAtlasDestroyDynamicGlyphs(ImFontAtlas* atlas)
+{
+    if (atlas->DynamicGlyphs == NULL)
+        return;
+    for (int i = 0; i < atlas->Fonts.Size; i++)
+        atlas->Fonts[i]->DynamicGlyphsOffset = -1;
+    IM_DELETE(atlas->DynamicGlyphs);
+    atlas->DynamicGlyphs = NULL;
+}
+
+// Split a shelf into cells for a given source font
+static void ImFontAtlasDynamicGlyphsSetupShelf(ImFontAtlas* atlas, int shelf_n, int src_n)
+{
+    ImFontAtlasDynamicGlyphs* cache = atlas->DynamicGlyphs;
+    ImFontDynamicGlyphSrc& src = cache->Sources[src_n];
+    ImFontDynamicGlyphShelf& shelf = cache->Shelves[shelf_n];
+    IM_ASSERT(shelf.Height >= src.CellHeight);
+    shelf.SrcIndex = src_n;
+    shelf.CellWidth = src.CellWidth;
+    shelf.CellsCount = atlas->TexWidth / src.CellWidth;
+    IM_ASSERT(shelf.CellsCount <= cache->CellsPerShelfMax);
+    for (int n = shelf.CellsCount - 1; n >= 0; n--) // Cells are used from left to right so consecutive dirty rectangles can be merged
+    {
+        IM_ASSERT(cache->Cells[shelf_n * cache->CellsPerShelfMax + n] == -1);
+        src.FreeCells.push_back(shelf_n * cache->CellsPerShelfMax + n);
+    }
+}
+
+static bool ImFontAtlasDynamicGlyphsAddShelf(ImFontAtlas* atlas, int src_n)
+{
+    ImFontAtlasDynamicGlyphs* cache = atlas->DynamicGlyphs;
+    const ImFontDynamicGlyphSrc& src = cache->Sources[src_n];
+    if (cache->ShelvesY + src.CellHeight > atlas->TexHeight)
+        return false;
+    ImFontDynamicGlyphShelf shelf;
+    shelf.Y = cache->ShelvesY;
+    shelf.Height = src.CellHeight;
+    shelf.SrcIndex = src_n;
+    shelf.CellWidth = shelf.CellsCount = 0;
+    cache->ShelvesY += src.CellHeight;
+    cache->Shelves.push_back(shelf);
+    cache->Cells.resize(cache->Shelves.Size * cache->CellsPerShelfMax, -1);
+    ImFontAtlasDynamicGlyphsSetupShelf(atlas, cache->Shelves.Size - 1, src_n);
+    return true;
+}
+
+static void ImFontAtlasDynamicGlyphsEvict(ImFontAtlasDynamicGlyphs* cache, int cell_n)
+{
+    ImFontDynamicGlyph* dyn_glyph = &cache->Glyphs[cache->Cells[cell_n]];
+    IM_ASSERT(dyn_glyph->CellIndex == cell_n && !dyn_glyph->Pinned);
+    IM_ATOMIC_STORE(&dyn_glyph->Resident, 0);
+    dyn_glyph->CellIndex = -1;
+    cache->Cells[cell_n] = -1;
+}
+
+// Rasterize a glyph into a free cell. Called with the lock held.
+static bool ImFontAtlasDynamicGlyphsRasterize(ImFontAtlas* atlas, ImFontGlyph* glyph, int dyn_glyph_n)
+{
+    ImFontAtlasDynamicGlyphs* cache = atlas->DynamicGlyphs;
+    ImFontDynamicGlyph* dyn_glyph = &cache->Glyphs[dyn_glyph_n];
+    ImFontDynamicGlyphSrc& src = cache->Sources[dyn_glyph->SrcIndex];
+    if (src.FreeCells.Size == 0 && !ImFontAtlasDynamicGlyphsAddShelf(atlas, dyn_glyph->SrcIndex))
+    {
+        src.MissedCount++;
+        return false;
+    }
+    const int cell_n = src.FreeCells.back();
+    src.FreeCells.pop_back();
+    cache->Cells[cell_n] = dyn_glyph_n;
+    dyn_glyph->CellIndex = cell_n;
+
+    // Clear the cell then render the glyph, the same way stbtt_PackFontRangesRenderIntoRects() does (padding is on the left and top)
+    const ImFontConfig& cfg = atlas->ConfigData[dyn_glyph->SrcIndex];
+    const ImFontDynamicGlyphShelf& shelf = cache->Shelves[cell_n / cache->CellsPerShelfMax];
+    const int pad = atlas->TexGlyphPadding;
+    const int x = (cell_n % cache->CellsPerShelfMax) * shelf.CellWidth + pad;
+    const int y = shelf.Y + pad;
+    const int w = shelf.CellWidth - pad;
+    const int h = shelf.Height - pad;
+    unsigned char* pixels = atlas->TexPixelsAlpha8 + x + y * atlas->TexWidth;
+    for (int n = 0; n < h; n++)
+        memset(pixels + n * atlas->TexWidth, 0, (size_t)w);
+
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBox(&src.FontInfo, dyn_glyph->GlyphIndex, src.Scale * cfg.OversampleH, src.Scale * cfg.OversampleV, &x0, &y0, &x1, &y1);
+    const int glyph_w = x1 - x0 + cfg.OversampleH - 1;
+    const int glyph_h = y1 - y0 + cfg.OversampleV - 1;
+    IM_ASSERT(glyph_w <= w && glyph_h <= h);
+    float sub_x, sub_y;
+    stbtt_MakeGlyphBitmapSubpixelPrefilter(&src.FontInfo, pixels, glyph_w, glyph_h, atlas->TexWidth, src.Scale * cfg.OversampleH, src.Scale * cfg.OversampleV, 0.0f, 0.0f, cfg.OversampleH, cfg.OversampleV, &sub_x, &sub_y, dyn_glyph->GlyphIndex);
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, x, y, glyph_w, glyph_h, atlas->TexWidth);
+    }
+    if (atlas->TexPixelsRGBA32 != NULL)
+        for (int n = 0; n < h; n++)
+        {
+            const unsigned char* src_pixels = pixels + n * atlas->TexWidth;
+            unsigned int* dst_pixels = atlas->TexPixelsRGBA32 + x + (y + n) * atlas->TexWidth;
+            for (int i = 0; i < w; i++)
+                dst_pixels[i] = IM_COL32(255, 255, 255, (unsigned int)src_pixels[i]);
+        }
+    glyph->U0 = x * atlas->TexUvScale.x;
+    glyph->V0 = y * atlas->TexUvScale.y;
+    glyph->U1 = (x + glyph_w) * atlas->TexUvScale.x;
+    glyph->V1 = (y + glyph_h) * atlas->TexUvScale.y;
+
+    // Report the cell to the backend, merging it with the previous one when they are side by side
+    if (atlas->TexDirtyRects.Size > 0)
+    {
+        ImFontAtlasDirtyRect& prev = atlas->TexDirtyRects.back();
+        if (prev.Y == y && prev.Height == h && x >= prev.X + prev.Width && x <= prev.X + prev.Width + pad)
+        {
+            prev.Width = (unsigned short)(x + w - prev.X);
+            return true;
+        }
+    }
+    ImFontAtlasDirtyRect rect = { (unsigned short)x, (unsigned short)y, (unsigned short)w, (unsigned short)h };
+    atlas->TexDirtyRects.push_back(rect);
+    return true;
+}
+
+// Called by ImFont::FindGlyph()
+static const ImFontGlyph* ImFontAtlasDynamicGlyphsFind(const ImFont* font, int glyph_n)
+{
+    ImFontGlyph* glyph = (ImFontGlyph*)(void*)&font->Glyphs.Data[glyph_n];
+    if (!glyph->Visible)
+        return glyph;
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    ImFontAtlasDynamicGlyphs* cache = atlas->DynamicGlyphs;
+    const int dyn_glyph_n = font->DynamicGlyphsOffset + glyph_n;
+    ImFontDynamicGlyph* dyn_glyph = &cache->Glyphs.Data[dyn_glyph_n];
+    if (IM_ATOMIC_LOAD(&dyn_glyph->LastUsedFrame) != cache->FrameCount)
+        IM_ATOMIC_STORE(&dyn_glyph->LastUsedFrame, cache->FrameCount);
+    if (IM_ATOMIC_LOAD(&dyn_glyph->Resident))
+        return glyph;
+
+    // Rasterize (unless another thread did it while we were waiting for the lock)
+    while (IM_ATOMIC_EXCHANGE(&cache->Lock, 1) != 0)
+        ;
+    bool resident = dyn_glyph->Resident != 0;
+    if (!resident && ImFontAtlasDynamicGlyphsRasterize(atlas, glyph, dyn_glyph_n))
+    {
+        IM_ATOMIC_STORE(&dyn_glyph->Resident, 1);
+        resident = true;
+    }
+    IM_ATOMIC_STORE(&cache->Lock, 0);
+    return resident ? glyph : font->FallbackGlyph;
+}
+
+static int IMGUI_CDECL ImFontAtlasDynamicGlyphsCompareEvictCandidates(const void* lhs, const void* rhs)
+{
+    const ImU64 a = *(const ImU64*)lhs, b = *(const ImU64*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Hand over a shelf which wasn't used during the last frame to a source font which ran out of cells
+static bool ImFontAtlasDynamicGlyphsReassignShelf(ImFontAtlas* atlas, int src_n, int evict_frame)
+{
+    ImFontAtlasDynamicGlyphs* cache = atlas->DynamicGlyphs;
+    const ImFontDynamicGlyphSrc& src = cache->Sources[src_n];
+    int best_shelf_n = -1;
+    int best_shelf_frame = evict_frame;
+    for (int shelf_n = 0; shelf_n < cache->Shelves.Size; shelf_n++)
+    {
+        const ImFontDynamicGlyphShelf& shelf = cache->Shelves[shelf_n];
+        if (shelf.SrcIndex == src_n || shelf.Height < src.CellHeight)
+            continue;
+        int shelf_frame = -1; // Most recent use of a glyph of this shelf
+        for (int n = 0; n < shelf.CellsCount && shelf_frame < best_shelf_frame; n++)
+            if (cache->Cells[shelf_n * cache->CellsPerShelfMax + n] != -1)
+            {
+                const ImFontDynamicGlyph* dyn_glyph = &cache->Glyphs[cache->Cells[shelf_n * cache->CellsPerShelfMax + n]];
+                shelf_frame = dyn_glyph->Pinned ? INT_MAX : ImMax(shelf_frame, dyn_glyph->LastUsedFrame);
+            }
+        if (shelf_frame < best_shelf_frame)
+        {
+            best_shelf_n = shelf_n;
+            best_shelf_frame = shelf_frame;
+        }
+    }
+    if (best_shelf_n == -1)
+        return false;
+
+    // Evict all glyphs of the shelf and remove its cells from the free list of their previous owner
+    ImFontDynamicGlyphShelf& shelf = cache->Shelves[best_shelf_n];
+    for (int n = 0; n < shelf.CellsCount; n++)
+        if (cache->Cells[best_shelf_n * cache->CellsPerShelfMax + n] != -1)
+            ImFontAtlasDynamicGlyphsEvict(cache, best_shelf_n * cache->CellsPerShelfMax + n);
+    ImVector<int>& prev_free_cells = cache->Sources[shelf.SrcIndex].FreeCells;
+    int free_cells_count = 0;
+    for (int i = 0; i < prev_free_cells.Size; i++)
+        if (prev_free_cells[i] / cache->CellsPerShelfMax != best_shelf_n)
+            prev_free_cells[free_cells_count++] = prev_free_cells[i];
+    prev_free_cells.resize(free_cells_count);
+    ImFontAtlasDynamicGlyphsSetupShelf(atlas, best_shelf_n, src_n);
+    return true;
+}
+
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicGlyphs* cache = atlas->DynamicGlyphs;
+    if (cache == NULL)
+        return;
+    cache->FrameCount++;
+    const int evict_frame = cache->FrameCount - 1; // Glyphs used during the last frame are likely to be used again: never evict them
+    bool tex_changed = false;
+    for (int src_n = 0; src_n < cache->Sources.Size; src_n++)
+    {
+        ImFontDynamicGlyphSrc& src = cache->Sources[src_n];
+        const int missed_count = src.MissedCount;
+        src.MissedCount = 0;
+        if (missed_count > 0)
+            tex_changed = true; // Text output with the fallback glyph instead of missed glyphs is outdated once they are rasterized
+        if (src.CellWidth == 0 || cache->ShelvesY + src.CellHeight <= atlas->TexHeight)
+            continue; // New shelves can still be added on demand
+
+        // Keep some cells free so new glyphs can be rasterized during the frame, evicting least recently used glyphs
+        int cells_count = 0;
+        cache->EvictCandidates.resize(0);
+        for (int shelf_n = 0; shelf_n < cache->Shelves.Size; shelf_n++)
+            if (cache->Shelves[shelf_n].SrcIndex == src_n)
+            {
+                cells_count += cache->Shelves[shelf_n].CellsCount;
+                for (int n = 0; n < cache->Shelves[shelf_n].CellsCount; n++)
+                {
+                    const int cell_n = shelf_n * cache->CellsPerShelfMax + n;
+                    if (cache->Cells[cell_n] == -1)
+                        continue;
+                    const ImFontDynamicGlyph* dyn_glyph = &cache->Glyphs[cache->Cells[cell_n]];
+                    if (!dyn_glyph->Pinned && dyn_glyph->LastUsedFrame < evict_frame)
+                        cache->EvictCandidates.push_back(((ImU64)(ImU32)dyn_glyph->LastUsedFrame << 32) | (ImU32)cell_n);
+                }
+            }
+        const int free_cells_target = ImMax(cells_count / 8, missed_count);
+        if (src.FreeCells.Size < free_cells_target && cache->EvictCandidates.Size > 0)
+        {
+            ImQsort(cache->EvictCandidates.Data, (size_t)cache->EvictCandidates.Size, sizeof(ImU64), ImFontAtlasDynamicGlyphsCompareEvictCandidates);
+            for (int i = 0; i < cache->EvictCandidates.Size && src.FreeCells.Size < free_cells_target; i++)
+            {
+                const int cell_n = (int)(cache->EvictCandidates[i] & 0xFFFFFFFF);
+                ImFontAtlasDynamicGlyphsEvict(cache, cell_n);
+                src.FreeCells.push_back(cell_n);
+                tex_changed = true;
+            }
+        }
+
+        // All our glyphs are in use: take over a shelf of another source font
+        if (src.FreeCells.Size < missed_count)
+            ImFontAtlasDynamicGlyphsReassignShelf(atlas, src_n, evict_frame);
+    }
+
+    // Geometry reused without calling FindGlyph() (retained windows, ImDrawListCache) doesn't mark its glyphs as used:
+    // tell it that evicted glyphs may be part of it
+    if (tex_changed)
+        atlas->TexGeneration++;
+}
+
+// Called by Build() once fonts are setup
+static void ImFontAtlasBuildDynamicGlyphs(ImFontAtlas* atlas, ImFontAtlasDynamicGlyphs* cache, const ImVector<ImFontBuildDynamicGlyph>& build_glyphs)
+{
+    // Glyphs which are not rasterized on demand (e.g. custom rectangle glyphs, TAB) are always resident
+    atlas->DynamicGlyphs = cache;
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImFont* font = atlas->Fonts[font_n];
+        font->DynamicGlyphsOffset = cache->Glyphs.Size;
+        cache->Glyphs.resize(cache->Glyphs.Size + font->Glyphs.Size);
+        for (int glyph_n = 0; glyph_n < font->Glyphs.Size; glyph_n++)
+        {
+            ImFontDynamicGlyph& dyn_glyph = cache->Glyphs[font->DynamicGlyphsOffset + glyph_n];
+            dyn_glyph.SrcIndex = -1;
+            dyn_glyph.GlyphIndex = 0;
+            dyn_glyph.CellIndex = -1;
+            dyn_glyph.LastUsedFrame = 0;
+            dyn_glyph.Resident = 1;
+            dyn_glyph.Pinned = true;
+        }
+    }
+    for (int i = 0; i < build_glyphs.Size; i++)
+    {
+        const ImFontBuildDynamicGlyph& build_glyph = build_glyphs[i];
+        ImFontDynamicGlyph& dyn_glyph = cache->Glyphs[build_glyph.Font->DynamicGlyphsOffset + build_glyph.GlyphN];
+        dyn_glyph.SrcIndex = build_glyph.SrcIndex;
+        dyn_glyph.GlyphIndex = build_glyph.GlyphIndex;
+        dyn_glyph.Resident = 0;
+        dyn_glyph.Pinned = false;
+    }
+
+    // Rasterize glyphs which may be needed on any frame and can't be evicted: fallback glyph (used when running out of room) and ellipsis
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImFont* font = atlas->Fonts[font_n];
+        const ImFontGlyph* pinned_glyphs[3] = { font->FallbackGlyph, font->FindGlyphNoFallback(font->EllipsisChar), font->FindGlyphNoFallback(font->DotChar) };
+        for (int n = 0; n < IM_ARRAYSIZE(pinned_glyphs); n++)
+            if (pinned_glyphs[n] != NULL)
+            {
+                const int glyph_n = (int)(pinned_glyphs[n] - font->Glyphs.Data);
+                ImFontDynamicGlyph& dyn_glyph = cache->Glyphs[font->DynamicGlyphsOffset + glyph_n];
+                if (pinned_glyphs[n]->Visible && !dyn_glyph.Resident)
+                {
+                    ImFontAtlasDynamicGlyphsFind(font, glyph_n);
+                    IM_ASSERT(dyn_glyph.Resident && "Not enough room to rasterize fallback glyphs. Increase TexDynamicHeight!");
+                }
+                dyn_glyph.Pinned = true;
+            }
+    }
+}
+
+// Glyphs of a job are packed into distinct rectangles of the texture: jobs don't need any synchronization.
+static void ImFontAtlasBuildRenderGlyphs(void* job_data, int job_index)
+{
+    ImFontBuildRenderJobsData* data = (ImFontBuildRenderJobsData*)job_data;
+    const ImFontBuildRenderJob& job = data->Jobs[job_index];
+    ImFontAtlas* atlas = data->Atlas;
+    ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+    ImFontBuildSrcData& src_tmp = data->SrcTmpArray[job.SrcIndex];
+
+    // Signed distance fields: output what stbtt_PackFontRangesRenderIntoRects() would, without oversampling
+    if (cfg.SignedDistanceField)
+    {
+        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+        const int spread = atlas->TexSdfSpread;
+        for (int glyph_i = job.GlyphStart; glyph_i < job.GlyphStart + job.GlyphCount; glyph_i++)
+        {
+            const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
+            const stbrp_rect& r = src_tmp.Rects[glyph_i];
+            stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+            int advance, lsb;
+            stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+            pc.xadvance = scale * advance;
+            if (!r.was_packed || r.w == 0 || r.h == 0)
+                continue;
+            int w, h, xoff, yoff;
+            unsigned char* sdf = stbtt_GetGlyphSDF(&src_tmp.FontInfo, scale, glyph_index_in_font, spread, 128, 128.0f / spread, &w, &h, &xoff, &yoff);
+            IM_ASSERT(sdf != NULL && w == r.w - atlas->TexGlyphPadding && h == r.h - atlas->TexGlyphPadding);
+            for (int y = 0; y < h; y++)
+                memcpy(atlas->TexPixelsAlpha8 + (size_t)(r.y + y) * atlas->TexWidth + r.x, sdf + (size_t)y * w, (size_t)w);
+            stbtt_FreeSDF(sdf, NULL);
+            pc.x0 = (unsigned short)r.x;
+            pc.y0 = (unsigned short)r.y;
+            pc.x1 = (unsigned short)(r.x + w);
+            pc.y1 = (unsigned short)(r.y + h);
+            pc.xoff = (float)xoff;
+            pc.yoff = (float)yoff;
+            pc.xoff2 = (float)(xoff + w);
+            pc.yoff2 = (float)(yoff + h);
+        }
+        return;
+    }
+
+    // stbtt_PackFontRangesRenderIntoRects() temporarily modifies the packing context: use our own copy
+    stbtt_pack_context spc = *data->PackContext;
+    stbtt_pack_range range = src_tmp.PackRange;
+    range.array_of_unicode_codepoints += job.GlyphStart;
+    range.chardata_for_range += job.GlyphStart;
+    range.num_chars = job.GlyphCount;
+    stbrp_rect* rects = src_tmp.Rects + job.GlyphStart;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &range, 1, rects);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = rects;
+        for (int glyph_i = 0; glyph_i < job.GlyphCount; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2348,10 +4498,14 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     ImFontAtlasBuildInit(atlas);
 
     // Clear atlas
+    const bool dynamic_glyphs = (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) != 0;
+    ImFontAtlasDestroyDynamicGlyphs(atlas);
+    atlas->ClearTexDirtyRects();
     atlas->TexID = (ImTextureID)NULL;
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
+    atlas->TexUvSdfMinV = FLT_MAX;
     atlas->ClearTexData();
 
     // Temporary storage for building
@@ -2476,10 +4630,40 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
+            if (cfg.SignedDistanceField)
+            {
+                // Same box as stbtt_GetGlyphSDF(): no oversampling, extended by the spread on each side, nothing for empty glyphs
+                stbtt_GetGlyphBitmapBox(&src_tmp.FontInfo, glyph_index_in_font, scale, scale, &x0, &y0, &x1, &y1);
+                const bool empty = (x0 == x1 || y0 == y1);
+                src_tmp.Rects[glyph_i].w = (stbrp_coord)(empty ? 0 : x1 - x0 + atlas->TexSdfSpread * 2 + padding);
+                src_tmp.Rects[glyph_i].h = (stbrp_coord)(empty ? 0 : y1 - y0 + atlas->TexSdfSpread * 2 + padding);
+                total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+                continue;
+            }
             stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
             src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
             src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+            if (!dynamic_glyphs)
+                continue;
+
+            // Glyphs rasterized on demand: output the metrics stbtt_PackFontRangesRenderIntoRects() would, leaving texture coordinates to zero
+            const int glyph_w = src_tmp.Rects[glyph_i].w - padding;
+            const int glyph_h = src_tmp.Rects[glyph_i].h - padding;
+            const float recip_h = 1.0f / cfg.OversampleH;
+            const float recip_v = 1.0f / cfg.OversampleV;
+            const float sub_x = (cfg.OversampleH > 1) ? (float)-(cfg.OversampleH - 1) / (2.0f * cfg.OversampleH) : 0.0f;
+            const float sub_y = (cfg.OversampleV > 1) ? (float)-(cfg.OversampleV - 1) / (2.0f * cfg.OversampleV) : 0.0f;
+            int advance, lsb;
+            stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+            stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+            pc.xadvance = scale * advance;
+            pc.xoff = (float)x0 * recip_h + sub_x;
+            pc.yoff = (float)y0 * recip_v + sub_y;
+            pc.xoff2 = (x0 + glyph_w) * recip_h + sub_x;
+            pc.yoff2 = (y0 + glyph_h) * recip_v + sub_y;
+            src_tmp.GlyphsMaxWidth = ImMax(src_tmp.GlyphsMaxWidth, (int)src_tmp.Rects[glyph_i].w);
+            src_tmp.GlyphsMaxHeight = ImMax(src_tmp.GlyphsMaxHeight, (int)src_tmp.Rects[glyph_i].h);
         }
     }
 
@@ -2490,6 +4674,8 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     atlas->TexHeight = 0;
     if (atlas->TexDesiredWidth > 0)
         atlas->TexWidth = atlas->TexDesiredWidth;
+    else if (dynamic_glyphs)
+        atlas->TexWidth = 1024;
     else
         atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
 
@@ -2504,7 +4690,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
+        if (src_tmp.GlyphsCount == 0 || dynamic_glyphs || atlas->ConfigData[src_i].SignedDistanceField)
             continue;
 
         stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
@@ -2516,42 +4702,69 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
                 atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
     }
 
+    // Pack signed distance field glyphs under everything else, so renderers can tell them apart from their texture coordinates (see TexUvSdfMinV)
+    int sdf_glyphs_y = -1;
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    {
+        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+        if (src_tmp.GlyphsCount == 0 || !atlas->ConfigData[src_i].SignedDistanceField)
+            continue;
+        if (sdf_glyphs_y == -1)
+        {
+            sdf_glyphs_y = atlas->TexHeight;
+            stbtt_PackEnd(&spc);
+            stbtt_PackBegin(&spc, NULL, atlas->TexWidth, TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
+        }
+        stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+            if (src_tmp.Rects[glyph_i].was_packed)
+            {
+                src_tmp.Rects[glyph_i].y += (stbrp_coord)sdf_glyphs_y;
+                atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
+            }
+    }
+
     // 7. Allocate texture
+    // (With ImFontAtlasFlags_DynamicGlyphs, glyphs are rasterized on demand below the custom rectangles)
+    const int dynamic_glyphs_y = atlas->TexHeight;
+    if (dynamic_glyphs)
+        atlas->TexHeight += (atlas->TexDynamicHeight > 0) ? atlas->TexDynamicHeight : atlas->TexWidth / 2;
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    atlas->TexUvSdfMinV = (sdf_glyphs_y != -1) ? sdf_glyphs_y * atlas->TexUvScale.y : FLT_MAX;
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
     memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
     spc.pixels = atlas->TexPixelsAlpha8;
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
-    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    // Glyphs are split into small jobs so they can be spread over multiple threads by BuildParallelFor.
+    const int RENDER_JOB_GLYPHS = 32;
+    ImVector<ImFontBuildRenderJob> render_jobs;
+    for (int src_i = 0; src_i < src_tmp_array.Size && !dynamic_glyphs; src_i++)
     {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+        for (int glyph_start = 0; glyph_start < src_tmp.GlyphsCount; glyph_start += RENDER_JOB_GLYPHS)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            ImFontBuildRenderJob job = { src_i, glyph_start, ImMin(RENDER_JOB_GLYPHS, src_tmp.GlyphsCount - glyph_start) };
+            render_jobs.push_back(job);
         }
-        src_tmp.Rects = NULL;
     }
+    ImFontBuildRenderJobsData render_jobs_data = { atlas, &spc, src_tmp_array.Data, render_jobs.Data };
+    if (atlas->BuildParallelFor != NULL && render_jobs.Size > 1)
+        atlas->BuildParallelFor(ImFontAtlasBuildRenderGlyphs, &render_jobs_data, render_jobs.Size, atlas->BuildParallelForUserData);
+    else
+        for (int job_n = 0; job_n < render_jobs.Size; job_n++)
+            ImFontAtlasBuildRenderGlyphs(&render_jobs_data, job_n);
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
     stbtt_PackEnd(&spc);
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
+    ImVector<ImFontBuildDynamicGlyph> dynamic_build_glyphs;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
@@ -2583,13 +4796,46 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             float unused_x = 0.0f, unused_y = 0.0f;
             stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
             dst_font->AddGlyph(&cfg, (ImWchar)codepoint, q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, pc.xadvance);
+            if (dynamic_glyphs)
+            {
+                ImFontBuildDynamicGlyph build_glyph = { dst_font, dst_font->Glyphs.Size - 1, src_i, stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint) };
+                dynamic_build_glyphs.push_back(build_glyph);
+            }
+        }
+    }
+
+    // Keep the source fonts data needed to rasterize glyphs on demand
+    ImFontAtlasDynamicGlyphs* dynamic_glyphs_cache = NULL;
+    if (dynamic_glyphs)
+    {
+        dynamic_glyphs_cache = IM_NEW(ImFontAtlasDynamicGlyphs)();
+        dynamic_glyphs_cache->Sources.resize(src_tmp_array.Size);
+        memset(dynamic_glyphs_cache->Sources.Data, 0, sizeof(ImFontDynamicGlyphSrc) * (size_t)src_tmp_array.Size);
+        int cell_width_min = atlas->TexWidth;
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            const ImFontConfig& cfg = atlas->ConfigData[src_i];
+            const ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+            ImFontDynamicGlyphSrc& src = dynamic_glyphs_cache->Sources[src_i];
+            src.FontInfo = src_tmp.FontInfo;
+            src.Scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+            if (src_tmp.GlyphsCount == 0)
+                continue;
+            src.CellWidth = src_tmp.GlyphsMaxWidth;
+            src.CellHeight = src_tmp.GlyphsMaxHeight;
+            IM_ASSERT(src.CellWidth <= atlas->TexWidth && "Glyphs too large for the texture. Increase TexDesiredWidth!");
+            cell_width_min = ImMin(cell_width_min, src.CellWidth);
         }
+        dynamic_glyphs_cache->ShelvesY = dynamic_glyphs_y;
+        dynamic_glyphs_cache->CellsPerShelfMax = atlas->TexWidth / ImMax(cell_width_min, 1);
     }
 
     // Cleanup
     src_tmp_array.clear_destruct();
 
     ImFontAtlasBuildFinish(atlas);
+    if (dynamic_glyphs)
+        ImFontAtlasBuildDynamicGlyphs(atlas, dynamic_glyphs_cache, dynamic_build_glyphs);
     return true;
 }
 
@@ -2600,6 +4846,11 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
     return &io;
 }
 
+#else
+
+static void ImFontAtlasDestroyDynamicGlyphs(ImFontAtlas*) {}
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas*) {}
+
 #endif // IMGUI_ENABLE_STB_TRUETYPE
 
 void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
@@ -2856,6 +5107,420 @@ static void UnpackAccumulativeOffsetsIntoRanges(int base_codepoint, const short*
     out_ranges[0] = 0;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] ImFontAtlas baked cache
+//-------------------------------------------------------------------------
+// File layout (native byte order, every block starts at a multiple of 8 bytes so the file can be read in place once memory-mapped):
+// - ImFontAtlasBakedCacheHeader
+// - Key: describes all inputs of Build() (font data hashes, ImFontConfig settings, glyph ranges, atlas flags, custom rectangles).
+//   It is compared byte for byte, so a stale cache can never be loaded.
+// - Payload, checksummed: ImFontAtlasBakedCacheAtlas, custom rectangles, then for each font ImFontAtlasBakedCacheFont followed
+//   by its Glyphs[], IndexAdvanceX[], IndexLookup[] and IndexPages[] arrays, then texture pixels (RGBA32 if TexPixelsUseColors, Alpha8 otherwise).
+//-------------------------------------------------------------------------
+
+#define IM_FONT_ATLAS_BAKED_CACHE_VERSION   3
+
+struct ImFontAtlasBakedCacheHeader
+{
+    char                Magic[8];           // "ImFntBkd"
+    ImU32               Version;            // IM_FONT_ATLAS_BAKED_CACHE_VERSION
+    ImU32               KeySize;
+    ImU32               KeyHash;
+    ImU32               PayloadHash;
+    ImU64               PayloadSize;
+};
+
+struct ImFontAtlasBakedCacheAtlas
+{
+    int                 TexWidth;
+    int                 TexHeight;
+    int                 TexPixelsUseColors;
+    int                 PackIdMouseCursors;
+    int                 PackIdLines;
+    int                 CustomRectsCount;
+    ImVec2              TexUvWhitePixel;
+    float               TexUvSdfMinV;
+    ImVec4              TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+};
+
+struct ImFontAtlasBakedCacheCustomRect
+{
+    unsigned short      Width, Height;
+    unsigned short      X, Y;
+    unsigned int        GlyphID;
+    float               GlyphAdvanceX;
+    ImVec2              GlyphOffset;
+    int                 FontIndex;          // Index into atlas->Fonts[], -1 if none
+};
+
+struct ImFontAtlasBakedCacheFont
+{
+    float               FontSize;
+    float               FallbackAdvanceX;
+    float               Ascent, Descent;
+    int                 MetricsTotalSurface;
+    int                 ConfigDataCount;
+    int                 FallbackGlyphIndex; // Index into Glyphs[], -1 if none
+    int                 GlyphsCount;
+    int                 IndexAdvanceXCount;
+    int                 IndexLookupCount;
+    int                 IndexPagesCount;
+    ImWchar             FallbackChar;
+    ImWchar             EllipsisChar;
+    ImWchar             DotChar;
+    ImU8                Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8];
+};
+
+// Append data, then pad to the next multiple of 8 bytes unless 'align' is false
+static void ImFontAtlasBakedCacheWrite(ImVector<unsigned char>* buf, const void* data, size_t size, bool align = true)
+{
+    const int offset = buf->Size;
+    buf->resize(offset + (int)size);
+    if (size > 0)
+        memcpy(buf->Data + offset, data, size);
+    if (align)
+        buf->resize((int)IM_MEMALIGN(buf->Size, 8), 0);
+}
+
+template<typename T>
+static void ImFontAtlasBakedCacheWriteValue(ImVector<unsigned char>* buf, const T& value)
+{
+    ImFontAtlasBakedCacheWrite(buf, &value, sizeof(T), false);
+}
+
+// Read a block in place. Return NULL when going past the end of the data.
+struct ImFontAtlasBakedCacheReader
+{
+    const unsigned char*    Data;
+    size_t                  Size;
+    size_t                  Offset;
+
+    ImFontAtlasBakedCacheReader(const void* data, size_t size) { Data = (const unsigned char*)data; Size = size; Offset = 0; }
+    const void* Read(size_t size)
+    {
+        if (size > Size - Offset)
+            return NULL;
+        const void* p = Data + Offset;
+        Offset = ImMin(Offset + IM_MEMALIGN(size, 8), Size);
+        return p;
+    }
+};
+
+static int ImFontAtlasBakedCacheFindFontIndex(const ImFontAtlas* atlas, const ImFont* font)
+{
+    for (int i = 0; i < atlas->Fonts.Size; i++)
+        if (atlas->Fonts[i] == font)
+            return i;
+    return -1;
+}
+
+// Describe everything the output of Build() depends on
+static void ImFontAtlasBakedCacheBuildKey(const ImFontAtlas* atlas, ImVector<unsigned char>* key)
+{
+    ImVector<unsigned char>* k = key;
+    ImFontAtlasBakedCacheWriteValue(k, (int)IMGUI_VERSION_NUM);
+    ImFontAtlasBakedCacheWriteValue(k, (int)sizeof(ImWchar));
+    ImFontAtlasBakedCacheWriteValue(k, (int)sizeof(ImFontGlyph));
+    ImFontAtlasBakedCacheWriteValue(k, (int)sizeof(ImFontAtlasBakedCacheFont));
+    ImFontAtlasBakedCacheWriteValue(k, (int)atlas->Flags);
+    ImFontAtlasBakedCacheWriteValue(k, atlas->TexDesiredWidth);
+    ImFontAtlasBakedCacheWriteValue(k, atlas->TexGlyphPadding);
+    ImFontAtlasBakedCacheWriteValue(k, atlas->TexSdfSpread);
+    ImFontAtlasBakedCacheWriteValue(k, (int)(atlas->FontBuilderIO != NULL)); // Custom builders are identified by their flags only
+    ImFontAtlasBakedCacheWriteValue(k, atlas->FontBuilderFlags);
+    ImFontAtlasBakedCacheWriteValue(k, atlas->Fonts.Size);
+    ImFontAtlasBakedCacheWriteValue(k, atlas->ConfigData.Size);
+    for (int cfg_n = 0; cfg_n < atlas->ConfigData.Size; cfg_n++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[cfg_n];
+        IM_ASSERT(cfg.FontData != NULL && "Font data was cleared by ClearInputData()?");
+        ImFontAtlasBakedCacheWriteValue(k, cfg.FontDataSize);
+        ImFontAtlasBakedCacheWriteValue(k, ImHashData(cfg.FontData, (size_t)cfg.FontDataSize));
+        ImFontAtlasBakedCacheWriteValue(k, cfg.FontNo);
+        ImFontAtlasBakedCacheWriteValue(k, cfg.SizePixels);
+        ImFontAtlasBakedCacheWriteValue(k, cfg.OversampleH);
+        ImFontAtlasBakedCacheWriteValue(k, cfg.OversampleV);
+        ImFontAtlasBakedCacheWriteValue(k, (int)cfg.PixelSnapH);
+        ImFontAtlasBakedCacheWriteValue(k, cfg.GlyphExtraSpacing);
+        ImFontAtlasBakedCacheWriteValue(k, cfg.GlyphOffset);
+        ImFontAtlasBakedCacheWriteValue(k, cfg.GlyphMinAdvanceX);
+        ImFontAtlasBakedCacheWriteValue(k, cfg.GlyphMaxAdvanceX);
+        ImFontAtlasBakedCacheWriteValue(k, (int)cfg.MergeMode);
+        ImFontAtlasBakedCacheWriteValue(k, cfg.FontBuilderFlags);
+        ImFontAtlasBakedCacheWriteValue(k, cfg.RasterizerMultiply);
+        ImFontAtlasBakedCacheWriteValue(k, (int)cfg.EllipsisChar);
+        ImFontAtlasBakedCacheWriteValue(k, (int)cfg.SignedDistanceField);
+        ImFontAtlasBakedCacheWriteValue(k, ImFontAtlasBakedCacheFindFontIndex(atlas, cfg.DstFont));
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : ((ImFontAtlas*)atlas)->GetGlyphRangesDefault();
+        int ranges_size = 0;
+        while (ranges[ranges_size])
+            ranges_size++;
+        ImFontAtlasBakedCacheWriteValue(k, ranges_size);
+        ImFontAtlasBakedCacheWrite(k, ranges, ranges_size * sizeof(ImWchar), false);
+    }
+
+    // User custom rectangles (ignore the ones registered by ImFontAtlasBuildInit() when the atlas was built)
+    for (int rect_n = 0; rect_n < atlas->CustomRects.Size; rect_n++)
+    {
+        if (rect_n == atlas->PackIdMouseCursors || rect_n == atlas->PackIdLines)
+            continue;
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[rect_n];
+        ImFontAtlasBakedCacheWriteValue(k, rect_n);
+        ImFontAtlasBakedCacheWriteValue(k, (int)r.Width);
+        ImFontAtlasBakedCacheWriteValue(k, (int)r.Height);
+        ImFontAtlasBakedCacheWriteValue(k, r.GlyphID);
+        ImFontAtlasBakedCacheWriteValue(k, r.GlyphAdvanceX);
+        ImFontAtlasBakedCacheWriteValue(k, r.GlyphOffset);
+        ImFontAtlasBakedCacheWriteValue(k, ImFontAtlasBakedCacheFindFontIndex(atlas, r.Font));
+    }
+}
+
+bool    ImFontAtlas::SaveBakedCache(const char* filename)
+{
+    IM_ASSERT(IsBuilt() && "Call Build() first!");
+    if (!IsBuilt() || DynamicGlyphs != NULL || (TexPixelsUseColors ? TexPixelsRGBA32 == NULL : TexPixelsAlpha8 == NULL))
+        return false;
+
+    ImVector<unsigned char> key;
+    ImFontAtlasBakedCacheBuildKey(this, &key);
+
+    ImVector<unsigned char> payload;
+    ImFontAtlasBakedCacheAtlas baked_atlas;
+    memset(&baked_atlas, 0, sizeof(baked_atlas));
+    baked_atlas.TexWidth = TexWidth;
+    baked_atlas.TexHeight = TexHeight;
+    baked_atlas.TexPixelsUseColors = TexPixelsUseColors ? 1 : 0;
+    baked_atlas.PackIdMouseCursors = PackIdMouseCursors;
+    baked_atlas.PackIdLines = PackIdLines;
+    baked_atlas.CustomRectsCount = CustomRects.Size;
+    baked_atlas.TexUvWhitePixel = TexUvWhitePixel;
+    baked_atlas.TexUvSdfMinV = TexUvSdfMinV;
+    memcpy(baked_atlas.TexUvLines, TexUvLines, sizeof(TexUvLines));
+    ImFontAtlasBakedCacheWrite(&payload, &baked_atlas, sizeof(baked_atlas));
+    for (int rect_n = 0; rect_n < CustomRects.Size; rect_n++)
+    {
+        const ImFontAtlasCustomRect& r = CustomRects[rect_n];
+        ImFontAtlasBakedCacheCustomRect baked_rect;
+        memset(&baked_rect, 0, sizeof(baked_rect));
+        baked_rect.Width = r.Width;
+        baked_rect.Height = r.Height;
+        baked_rect.X = r.X;
+        baked_rect.Y = r.Y;
+        baked_rect.GlyphID = r.GlyphID;
+        baked_rect.GlyphAdvanceX = r.GlyphAdvanceX;
+        baked_rect.GlyphOffset = r.GlyphOffset;
+        baked_rect.FontIndex = ImFontAtlasBakedCacheFindFontIndex(this, r.Font);
+        ImFontAtlasBakedCacheWrite(&payload, &baked_rect, sizeof(baked_rect), false);
+    }
+    ImFontAtlasBakedCacheWrite(&payload, NULL, 0);
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        const ImFont* font = Fonts[font_n];
+        ImFontAtlasBakedCacheFont baked_font;
+        memset(&baked_font, 0, sizeof(baked_font));
+        baked_font.FontSize = font->FontSize;
+        baked_font.FallbackAdvanceX = font->FallbackAdvanceX;
+        baked_font.Ascent = font->Ascent;
+        baked_font.Descent = font->Descent;
+        baked_font.MetricsTotalSurface = font->MetricsTotalSurface;
+        baked_font.ConfigDataCount = font->ConfigDataCount;
+        baked_font.FallbackGlyphIndex = font->FallbackGlyph ? (int)(font->FallbackGlyph - font->Glyphs.Data) : -1;
+        baked_font.GlyphsCount = font->Glyphs.Size;
+        baked_font.IndexAdvanceXCount = font->IndexAdvanceX.Size;
+        baked_font.IndexLookupCount = font->IndexLookup.Size;
+        baked_font.IndexPagesCount = font->IndexPages.Size;
+        baked_font.FallbackChar = font->FallbackChar;
+        baked_font.EllipsisChar = font->EllipsisChar;
+        baked_font.DotChar = font->DotChar;
+        memcpy(baked_font.Used4kPagesMap, font->Used4kPagesMap, sizeof(font->Used4kPagesMap));
+        ImFontAtlasBakedCacheWrite(&payload, &baked_font, sizeof(baked_font));
+        ImFontAtlasBakedCacheWrite(&payload, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+        ImFontAtlasBakedCacheWrite(&payload, font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes());
+        ImFontAtlasBakedCacheWrite(&payload, font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes());
+        ImFontAtlasBakedCacheWrite(&payload, font->IndexPages.Data, (size_t)font->IndexPages.size_in_bytes());
+    }
+    if (TexPixelsUseColors)
+        ImFontAtlasBakedCacheWrite(&payload, TexPixelsRGBA32, (size_t)TexWidth * TexHeight * 4);
+    else
+        ImFontAtlasBakedCacheWrite(&payload, TexPixelsAlpha8, (size_t)TexWidth * TexHeight);
+
+    ImFontAtlasBakedCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.Magic, "ImFntBkd", 8);
+    header.Version = IM_FONT_ATLAS_BAKED_CACHE_VERSION;
+    header.KeySize = (ImU32)key.Size;
+    header.KeyHash = ImHashData(key.Data, (size_t)key.Size);
+    header.PayloadHash = ImHashData(payload.Data, (size_t)payload.Size);
+    header.PayloadSize = (ImU64)payload.Size;
+    ImFontAtlasBakedCacheWrite(&key, NULL, 0);
+
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ok = ImFileWrite(&header, sizeof(header), 1, f) == 1;
+    ok &= key.Size == 0 || ImFileWrite(key.Data, (ImU64)key.Size, 1, f) == 1;
+    ok &= ImFileWrite(payload.Data, (ImU64)payload.Size, 1, f) == 1;
+    ok &= ImFileClose(f);
+    return ok;
+}
+
+bool    ImFontAtlas::LoadBakedCache(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    if (data == NULL)
+        return false;
+    const bool ret = LoadBakedCacheFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
+}
+
+// Validate the whole file before modifying the atlas: 'apply' is false on the first pass
+static bool ImFontAtlasBakedCacheRead(ImFontAtlas* atlas, ImFontAtlasBakedCacheReader* reader, bool apply)
+{
+    const ImFontAtlasBakedCacheAtlas* baked_atlas = (const ImFontAtlasBakedCacheAtlas*)reader->Read(sizeof(ImFontAtlasBakedCacheAtlas));
+    if (baked_atlas == NULL || baked_atlas->TexWidth <= 0 || baked_atlas->TexHeight <= 0 || baked_atlas->CustomRectsCount < 0)
+        return false;
+    const ImFontAtlasBakedCacheCustomRect* baked_rects = (const ImFontAtlasBakedCacheCustomRect*)reader->Read(sizeof(ImFontAtlasBakedCacheCustomRect) * (size_t)baked_atlas->CustomRectsCount);
+    if (baked_rects == NULL || baked_atlas->PackIdMouseCursors >= baked_atlas->CustomRectsCount || baked_atlas->PackIdLines >= baked_atlas->CustomRectsCount)
+        return false;
+    if (apply)
+    {
+        ImFontAtlasDestroyDynamicGlyphs(atlas);
+        atlas->TexID = (ImTextureID)NULL;
+        atlas->ClearTexData();
+        atlas->TexGeneration++;
+        atlas->TexWidth = baked_atlas->TexWidth;
+        atlas->TexHeight = baked_atlas->TexHeight;
+        atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+        atlas->TexUvWhitePixel = baked_atlas->TexUvWhitePixel;
+        atlas->TexUvSdfMinV = baked_atlas->TexUvSdfMinV;
+        memcpy(atlas->TexUvLines, baked_atlas->TexUvLines, sizeof(atlas->TexUvLines));
+        atlas->TexPixelsUseColors = baked_atlas->TexPixelsUseColors != 0;
+        atlas->PackIdMouseCursors = baked_atlas->PackIdMouseCursors;
+        atlas->PackIdLines = baked_atlas->PackIdLines;
+        atlas->CustomRects.resize(baked_atlas->CustomRectsCount);
+    }
+    for (int rect_n = 0; rect_n < baked_atlas->CustomRectsCount; rect_n++)
+    {
+        const ImFontAtlasBakedCacheCustomRect& baked_rect = baked_rects[rect_n];
+        if (baked_rect.FontIndex < -1 || baked_rect.FontIndex >= atlas->Fonts.Size)
+            return false;
+        if (!apply)
+            continue;
+        ImFontAtlasCustomRect& r = atlas->CustomRects[rect_n];
+        r.Width = baked_rect.Width;
+        r.Height = baked_rect.Height;
+        r.X = baked_rect.X;
+        r.Y = baked_rect.Y;
+        r.GlyphID = baked_rect.GlyphID;
+        r.GlyphAdvanceX = baked_rect.GlyphAdvanceX;
+        r.GlyphOffset = baked_rect.GlyphOffset;
+        r.Font = (baked_rect.FontIndex >= 0) ? atlas->Fonts[baked_rect.FontIndex] : NULL;
+    }
+
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        const ImFontAtlasBakedCacheFont* baked_font = (const ImFontAtlasBakedCacheFont*)reader->Read(sizeof(ImFontAtlasBakedCacheFont));
+        if (baked_font == NULL || baked_font->GlyphsCount < 0 || baked_font->IndexLookupCount < 0 || baked_font->IndexAdvanceXCount != baked_font->IndexLookupCount || (baked_font->IndexLookupCount % IM_FONT_INDEX_PAGE_SIZE) != 0 || baked_font->IndexPagesCount < 0 || baked_font->FallbackGlyphIndex < -1 || baked_font->FallbackGlyphIndex >= baked_font->GlyphsCount)
+            return false;
+        const ImFontGlyph* glyphs = (const ImFontGlyph*)reader->Read(sizeof(ImFontGlyph) * (size_t)baked_font->GlyphsCount);
+        const float* index_advance_x = (const float*)reader->Read(sizeof(float) * (size_t)baked_font->IndexAdvanceXCount);
+        const ImWchar* index_lookup = (const ImWchar*)reader->Read(sizeof(ImWchar) * (size_t)baked_font->IndexLookupCount);
+        const ImU16* index_pages = (const ImU16*)reader->Read(sizeof(ImU16) * (size_t)baked_font->IndexPagesCount);
+        if (glyphs == NULL || index_advance_x == NULL || index_lookup == NULL || index_pages == NULL)
+            return false;
+        for (int i = 0; i < baked_font->IndexLookupCount; i++)
+            if (index_lookup[i] != (ImWchar)-1 && (int)index_lookup[i] >= baked_font->GlyphsCount)
+                return false;
+        for (int i = 0; i < baked_font->IndexPagesCount; i++)
+            if (index_pages[i] >= baked_font->IndexLookupCount / IM_FONT_INDEX_PAGE_SIZE)
+                return false;
+        if (!apply)
+            continue;
+
+        ImFont* font = atlas->Fonts[font_n];
+        font->ClearOutputData();
+        font->ContainerAtlas = atlas;
+        font->ConfigData = NULL;
+        for (int cfg_n = 0; cfg_n < atlas->ConfigData.Size && font->ConfigData == NULL; cfg_n++)
+            if (atlas->ConfigData[cfg_n].DstFont == font)
+                font->ConfigData = &atlas->ConfigData[cfg_n];
+        font->ConfigDataCount = (short)baked_font->ConfigDataCount;
+        font->FontSize = baked_font->FontSize;
+        font->FallbackAdvanceX = baked_font->FallbackAdvanceX;
+        font->Ascent = baked_font->Ascent;
+        font->Descent = baked_font->Descent;
+        font->MetricsTotalSurface = baked_font->MetricsTotalSurface;
+        font->FallbackChar = baked_font->FallbackChar;
+        font->EllipsisChar = baked_font->EllipsisChar;
+        font->DotChar = baked_font->DotChar;
+        memcpy(font->Used4kPagesMap, baked_font->Used4kPagesMap, sizeof(font->Used4kPagesMap));
+        font->Glyphs.resize(baked_font->GlyphsCount);
+        font->IndexAdvanceX.resize(baked_font->IndexAdvanceXCount);
+        font->IndexLookup.resize(baked_font->IndexLookupCount);
+        font->IndexPages.resize(baked_font->IndexPagesCount);
+        if (baked_font->GlyphsCount > 0)
+            memcpy(font->Glyphs.Data, glyphs, (size_t)font->Glyphs.size_in_bytes());
+        if (baked_font->IndexAdvanceXCount > 0)
+            memcpy(font->IndexAdvanceX.Data, index_advance_x, (size_t)font->IndexAdvanceX.size_in_bytes());
+        if (baked_font->IndexLookupCount > 0)
+            memcpy(font->IndexLookup.Data, index_lookup, (size_t)font->IndexLookup.size_in_bytes());
+        if (baked_font->IndexPagesCount > 0)
+            memcpy(font->IndexPages.Data, index_pages, (size_t)font->IndexPages.size_in_bytes());
+        font->FallbackGlyph = (baked_font->FallbackGlyphIndex >= 0) ? &font->Glyphs[baked_font->FallbackGlyphIndex] : NULL;
+        ImFontBuildAsciiGlyphs(font);
+        font->DirtyLookupTables = false;
+    }
+
+    const size_t pixels_size = (size_t)baked_atlas->TexWidth * baked_atlas->TexHeight * (baked_atlas->TexPixelsUseColors ? 4 : 1);
+    const void* pixels = reader->Read(pixels_size);
+    if (pixels == NULL || reader->Offset != reader->Size)
+        return false;
+    if (apply)
+    {
+        if (baked_atlas->TexPixelsUseColors)
+            atlas->TexPixelsRGBA32 = (unsigned int*)IM_ALLOC(pixels_size);
+        else
+            atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(pixels_size);
+        memcpy(baked_atlas->TexPixelsUseColors ? (void*)atlas->TexPixelsRGBA32 : (void*)atlas->TexPixelsAlpha8, pixels, pixels_size);
+        atlas->TexReady = true;
+    }
+    return true;
+}
+
+bool    ImFontAtlas::LoadBakedCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (Flags & ImFontAtlasFlags_DynamicGlyphs)
+        return false;
+
+    // Default font is none are specified (same as Build())
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+
+    // Check header and key
+    ImFontAtlasBakedCacheReader reader(data, data_size);
+    const ImFontAtlasBakedCacheHeader* header = (const ImFontAtlasBakedCacheHeader*)reader.Read(sizeof(ImFontAtlasBakedCacheHeader));
+    if (header == NULL || memcmp(header->Magic, "ImFntBkd", 8) != 0 || header->Version != IM_FONT_ATLAS_BAKED_CACHE_VERSION)
+        return false;
+    ImVector<unsigned char> key;
+    ImFontAtlasBakedCacheBuildKey(this, &key);
+    const void* file_key = reader.Read(header->KeySize);
+    if (file_key == NULL || header->KeySize != (ImU32)key.Size || header->KeyHash != ImHashData(key.Data, (size_t)key.Size) || memcmp(file_key, key.Data, (size_t)key.Size) != 0)
+        return false;
+    if (header->PayloadSize != (ImU64)(data_size - reader.Offset) || header->PayloadHash != ImHashData(reader.Data + reader.Offset, (size_t)header->PayloadSize))
+        return false;
+
+    // Load
+    ImFontAtlasBakedCacheReader payload_reader(reader.Data + reader.Offset, (size_t)header->PayloadSize);
+    if (!ImFontAtlasBakedCacheRead(this, &payload_reader, false))
+        return false;
+    payload_reader.Offset = 0;
+    ImFontAtlasBakedCacheRead(this, &payload_reader, true);
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] ImFontAtlas glyph ranges helpers
 //-------------------------------------------------------------------------
@@ -3110,6 +5775,7 @@ ImFont::ImFont()
     EllipsisChar = (ImWchar)-1;
     DotChar = (ImWchar)-1;
     FallbackGlyph = NULL;
+    memset(AsciiGlyphs, 0, sizeof(AsciiGlyphs));
     ContainerAtlas = NULL;
     ConfigData = NULL;
     ConfigDataCount = 0;
@@ -3117,6 +5783,7 @@ ImFont::ImFont()
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    DynamicGlyphsOffset = -1;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
 }
 
@@ -3132,11 +5799,28 @@ void    ImFont::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
     FallbackGlyph = NULL;
+    memset(AsciiGlyphs, 0, sizeof(AsciiGlyphs));
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    DynamicGlyphsOffset = -1;
+    TextSizeCache.Clear();
+}
+
+void ImFontBuildAsciiGlyphs(ImFont* font)
+{
+    // Left empty without a fallback glyph: RenderText() only uses the table when all entries are valid.
+    memset(font->AsciiGlyphs, 0, sizeof(font->AsciiGlyphs));
+    if (font->FallbackGlyph == NULL)
+        return;
+    for (int c = 0; c < IM_ARRAYSIZE(font->AsciiGlyphs); c++)
+    {
+        const ImFontGlyph* glyph = font->FindGlyphNoFallback((ImWchar)c);
+        font->AsciiGlyphs[c] = glyph ? glyph : font->FallbackGlyph;
+    }
 }
 
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
@@ -3149,6 +5833,7 @@ static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_cha
 
 void ImFont::BuildLookupTable()
 {
+    TextSizeCache.Clear();
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -3157,14 +5842,16 @@ void ImFont::BuildLookupTable()
     IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
     DirtyLookupTables = false;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
     GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
     {
         int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
+        const int offset = AllocIndexPage(codepoint);
+        IndexAdvanceX[offset] = Glyphs[i].AdvanceX;
+        IndexLookup[offset] = (ImWchar)i;
 
         // Mark 4K page as used
         const int page_n = codepoint / 4096;
@@ -3181,8 +5868,9 @@ void ImFont::BuildLookupTable()
         tab_glyph = *FindGlyph((ImWchar)' ');
         tab_glyph.Codepoint = '\t';
         tab_glyph.AdvanceX *= IM_TABSIZE;
-        IndexAdvanceX[(int)tab_glyph.Codepoint] = (float)tab_glyph.AdvanceX;
-        IndexLookup[(int)tab_glyph.Codepoint] = (ImWchar)(Glyphs.Size - 1);
+        const int offset = AllocIndexPage(tab_glyph.Codepoint);
+        IndexAdvanceX[offset] = (float)tab_glyph.AdvanceX;
+        IndexLookup[offset] = (ImWchar)(Glyphs.Size - 1);
     }
 
     // Mark special glyphs as not visible (note that AddGlyph already mark as non-visible glyphs with zero-size polygons)
@@ -3214,9 +5902,12 @@ void ImFont::BuildLookupTable()
     }
 
     FallbackAdvanceX = FallbackGlyph->AdvanceX;
-    for (int i = 0; i < max_codepoint + 1; i++)
+    for (int i = 0; i < IndexAdvanceX.Size; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
+
+    // Last, as the TAB glyph above may have reallocated Glyphs
+    ImFontBuildAsciiGlyphs(this);
 }
 
 // API is designed this way to avoid exposing the 4K page size
@@ -3241,10 +5932,34 @@ void ImFont::SetGlyphVisible(ImWchar c, bool visible)
 void ImFont::GrowIndex(int new_size)
 {
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
-    if (new_size <= IndexLookup.Size)
+    const int new_blocks_count = (new_size + IM_FONT_INDEX_PAGE_SIZE - 1) / IM_FONT_INDEX_PAGE_SIZE;
+    if (new_blocks_count <= IndexPages.Size)
         return;
-    IndexAdvanceX.resize(new_size, -1.0f);
-    IndexLookup.resize(new_size, (ImWchar)-1);
+    if (IndexLookup.Size == 0)
+    {
+        // Page 0 is shared by all blocks without glyphs
+        IndexAdvanceX.resize(IM_FONT_INDEX_PAGE_SIZE, -1.0f);
+        IndexLookup.resize(IM_FONT_INDEX_PAGE_SIZE, (ImWchar)-1);
+    }
+    IndexPages.resize(new_blocks_count, 0);
+}
+
+int ImFont::AllocIndexPage(unsigned int c)
+{
+    GrowIndex((int)c + 1);
+    ImU16& page = IndexPages[c / IM_FONT_INDEX_PAGE_SIZE];
+    if (page == 0)
+    {
+        // New pages start as a copy of page 0: no glyph, fallback advance once built
+        const int page_count = IndexLookup.Size / IM_FONT_INDEX_PAGE_SIZE;
+        IM_ASSERT(page_count < 0xFFFF);
+        page = (ImU16)page_count;
+        IndexAdvanceX.resize(IndexAdvanceX.Size + IM_FONT_INDEX_PAGE_SIZE);
+        IndexLookup.resize(IndexLookup.Size + IM_FONT_INDEX_PAGE_SIZE);
+        memcpy(&IndexAdvanceX.Data[page_count * IM_FONT_INDEX_PAGE_SIZE], &IndexAdvanceX.Data[0], IM_FONT_INDEX_PAGE_SIZE * sizeof(float));
+        memcpy(&IndexLookup.Data[page_count * IM_FONT_INDEX_PAGE_SIZE], &IndexLookup.Data[0], IM_FONT_INDEX_PAGE_SIZE * sizeof(ImWchar));
+    }
+    return GetIndexOffset(c);
 }
 
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
@@ -3297,33 +6012,44 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    unsigned int index_size = (unsigned int)IndexLookup.Size;
+    const int dst_offset = GetIndexOffset(dst);
+    const int src_offset = GetIndexOffset(src);
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst_offset >= 0 && IndexLookup.Data[dst_offset] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
         return;
-    if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
+    if (src_offset < 0 && dst_offset < 0) // both 'dst' and 'src' don't exist -> no-op
         return;
 
-    GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    const ImWchar src_glyph_index = (src_offset >= 0) ? IndexLookup.Data[src_offset] : (ImWchar)-1;
+    const float src_advance_x = (src_offset >= 0) ? IndexAdvanceX.Data[src_offset] : 1.0f;
+    const int offset = AllocIndexPage(dst);
+    IndexLookup[offset] = src_glyph_index;
+    IndexAdvanceX[offset] = src_advance_x;
+    ImFontBuildAsciiGlyphs(this);
+    TextSizeCache.Clear();
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
+    const int offset = GetIndexOffset(c);
+    if (offset < 0)
         return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[offset];
     if (i == (ImWchar)-1)
         return FallbackGlyph;
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    if (DynamicGlyphsOffset >= 0)
+        return ImFontAtlasDynamicGlyphsFind(this, i);
+#endif
     return &Glyphs.Data[i];
 }
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
+    const int offset = GetIndexOffset(c);
+    if (offset < 0)
         return NULL;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[offset];
     if (i == (ImWchar)-1)
         return NULL;
     return &Glyphs.Data[i];
@@ -3383,7 +6109,8 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        const int index_offset = GetIndexOffset(c);
+        const float char_width = (index_offset >= 0 ? IndexAdvanceX.Data[index_offset] : FallbackAdvanceX);
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -3442,65 +6169,84 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
 
+    // Bytes in [s, ascii_run_end) are printable ASCII located before the next word-wrap point: they need no decoding, no special
+    // character or word-wrap handling and their advance is read from the page of the first block of code-points.
+    const float* ascii_advance_x = (IndexPages.Size > 0) ? &IndexAdvanceX.Data[IndexPages.Data[0] * IM_FONT_INDEX_PAGE_SIZE] : NULL;
+    const char* ascii_run_end = text_begin;
+
     const char* s = text_begin;
     while (s < text_end)
     {
-        if (word_wrap_enabled)
+        const char* prev_s = s;
+        float char_width;
+        if (s < ascii_run_end)
+        {
+            char_width = ascii_advance_x[(unsigned char)*s++] * scale;
+        }
+        else
         {
-            // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
-            if (!word_wrap_eol)
+            if (word_wrap_enabled)
             {
-                word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
-                if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
-                    word_wrap_eol++;    // +1 may not be a character start point in UTF-8 but it's ok because we use s >= word_wrap_eol below
-            }
+                // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
+                if (!word_wrap_eol)
+                {
+                    word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
+                    if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
+                        word_wrap_eol++;    // +1 may not be a character start point in UTF-8 but it's ok because we use s >= word_wrap_eol below
+                }
 
-            if (s >= word_wrap_eol)
-            {
-                if (text_size.x < line_width)
-                    text_size.x = line_width;
-                text_size.y += line_height;
-                line_width = 0.0f;
-                word_wrap_eol = NULL;
-
-                // Wrapping skips upcoming blanks
-                while (s < text_end)
+                if (s >= word_wrap_eol)
                 {
-                    const char c = *s;
-                    if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+                    if (text_size.x < line_width)
+                        text_size.x = line_width;
+                    text_size.y += line_height;
+                    line_width = 0.0f;
+                    word_wrap_eol = NULL;
+
+                    // Wrapping skips upcoming blanks
+                    while (s < text_end)
+                    {
+                        const char c = *s;
+                        if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+                    }
+                    continue;
                 }
-                continue;
             }
-        }
 
-        // Decode and advance source
-        const char* prev_s = s;
-        unsigned int c = (unsigned int)*s;
-        if (c < 0x80)
-        {
-            s += 1;
-        }
-        else
-        {
-            s += ImTextCharFromUtf8(&c, s, text_end);
-            if (c == 0) // Malformed UTF-8?
-                break;
-        }
+            // Decode and advance source
+            unsigned int c = (unsigned int)*s;
+            if (c < 0x80)
+            {
+                s += 1;
+            }
+            else
+            {
+                s += ImTextCharFromUtf8(&c, s, text_end);
+                if (c == 0) // Malformed UTF-8?
+                    break;
+            }
 
-        if (c < 32)
-        {
-            if (c == '\n')
+            if (c < 32)
             {
-                text_size.x = ImMax(text_size.x, line_width);
-                text_size.y += line_height;
-                line_width = 0.0f;
-                continue;
+                if (c == '\n')
+                {
+                    text_size.x = ImMax(text_size.x, line_width);
+                    text_size.y += line_height;
+                    line_width = 0.0f;
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
             }
-            if (c == '\r')
-                continue;
+            else if (c < 0x80 && ascii_advance_x != NULL)
+            {
+                ascii_run_end = ImTextFindAsciiRunEnd(s, word_wrap_enabled ? word_wrap_eol : text_end);
+            }
+
+            const int index_offset = GetIndexOffset(c);
+            char_width = (index_offset >= 0 ? IndexAdvanceX.Data[index_offset] : FallbackAdvanceX) * scale;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -3522,6 +6268,106 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     return text_size;
 }
 
+ImVec2 ImFont::CalcTextSizeCached(float size, float wrap_width, const char* text_begin, const char* text_end)
+{
+    ImFontTextSizeCache& cache = TextSizeCache;
+    if (!cache.Enabled)
+        return CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end, NULL);
+    if (!text_end)
+        text_end = text_begin + strlen(text_begin);
+
+    // Hashing the text is much cheaper than decoding it and looking up every glyph advance, except for short texts
+    const int text_len = (int)(text_end - text_begin);
+    if (text_len == 0 || (text_len < cache.MinTextLen && wrap_width <= 0.0f))
+        return CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end, NULL);
+    ImU32 size_bits, wrap_width_bits;
+    memcpy(&size_bits, &size, sizeof(ImU32));
+    memcpy(&wrap_width_bits, &wrap_width, sizeof(ImU32));
+    const ImGuiID key = ImHashData(text_begin, (size_t)text_len, size_bits ^ (wrap_width_bits * 0x9E3779B1));
+    const int entry_idx = cache.Map.GetInt(key, -1);
+    if (entry_idx != -1)
+    {
+        ImFontTextSizeCacheEntry& entry = cache.Entries[entry_idx];
+        if (entry.TextLen == text_len && entry.FontSize == size && entry.WrapWidth == wrap_width && memcmp(cache.TextBuffer.Data + entry.TextOffset, text_begin, (size_t)text_len) == 0)
+        {
+            entry.LastUsedFrame = cache.Frame;
+            cache.Hits++;
+            return entry.Size;
+        }
+    }
+
+    // Measure and add an entry (a colliding entry is replaced, its text stays in TextBuffer[] until the next eviction pass)
+    const ImVec2 text_size = CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end, NULL);
+    if (entry_idx == -1)
+    {
+        cache.Map.SetInt(key, cache.Entries.Size);
+        cache.Entries.resize(cache.Entries.Size + 1);
+    }
+    ImFontTextSizeCacheEntry& entry = (entry_idx == -1) ? cache.Entries.back() : cache.Entries[entry_idx];
+    entry.Key = key;
+    entry.TextOffset = cache.TextBuffer.Size;
+    entry.TextLen = text_len;
+    entry.FontSize = size;
+    entry.WrapWidth = wrap_width;
+    entry.LastUsedFrame = cache.Frame;
+    entry.Size = text_size;
+    cache.TextBuffer.resize(cache.TextBuffer.Size + text_len);
+    memcpy(cache.TextBuffer.Data + entry.TextOffset, text_begin, (size_t)text_len);
+    cache.Misses++;
+    return text_size;
+}
+
+void ImFontAtlasUpdateTextSizeCaches(ImFontAtlas* atlas)
+{
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImFontTextSizeCache& cache = atlas->Fonts[font_n]->TextSizeCache;
+        if (!cache.Enabled)
+        {
+            if (cache.Entries.Size > 0)
+                cache.Clear();
+            continue;
+        }
+        cache.Frame++;
+
+        // Evict old entries once every MaxAge frames, or sooner when the cache doubled since the last pass (e.g. text changing every frame)
+        if (cache.Frame - cache.LastSweepFrame < cache.MaxAge && cache.Entries.Size < cache.SweepSize * 2 + 64)
+            continue;
+        cache.LastSweepFrame = cache.Frame;
+        const int min_used_frame = cache.Frame - cache.MaxAge;
+        int entries_count = 0;
+        int text_buffer_size = 0;
+        for (int entry_n = 0; entry_n < cache.Entries.Size; entry_n++)
+            if (cache.Entries[entry_n].LastUsedFrame >= min_used_frame)
+            {
+                text_buffer_size += cache.Entries[entry_n].TextLen;
+                cache.Entries[entries_count++] = cache.Entries[entry_n];
+            }
+        if (entries_count == cache.Entries.Size && text_buffer_size == cache.TextBuffer.Size)
+        {
+            cache.SweepSize = entries_count;
+            continue;
+        }
+
+        ImVector<char> text_buffer;
+        text_buffer.resize(text_buffer_size);
+        text_buffer_size = 0;
+        for (int entry_n = 0; entry_n < entries_count; entry_n++)
+        {
+            ImFontTextSizeCacheEntry& entry = cache.Entries[entry_n];
+            memcpy(text_buffer.Data + text_buffer_size, cache.TextBuffer.Data + entry.TextOffset, (size_t)entry.TextLen);
+            entry.TextOffset = text_buffer_size;
+            text_buffer_size += entry.TextLen;
+        }
+        cache.TextBuffer.swap(text_buffer);
+        cache.Entries.resize(entries_count);
+        cache.Map.Clear();
+        for (int entry_n = 0; entry_n < entries_count; entry_n++)
+            cache.Map.SetInt(cache.Entries[entry_n].Key, entry_n);
+        cache.SweepSize = entries_count;
+    }
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, ImWchar c) const
 {
@@ -3533,8 +6379,21 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     pos.x = IM_FLOOR(pos.x);
     pos.y = IM_FLOOR(pos.y);
+    if (draw_list->Flags & ImDrawListFlags_Fingerprint)
+    {
+        const struct { ImVec2 Pos; float Size; ImU32 Col; ImU32 C; } params = { pos, size, col, (ImU32)c };
+        ImDrawListFingerprint(draw_list, &params, sizeof(params));
+        if (ImDrawListFingerprintSkip(draw_list))
+            return;
+    }
+    const ImVec2 p_min(pos.x + glyph->X0 * scale, pos.y + glyph->Y0 * scale), p_max(pos.x + glyph->X1 * scale, pos.y + glyph->Y1 * scale);
+    if (draw_list->Flags & ImDrawListFlags_InstancedQuads)
+    {
+        draw_list->PrimRectInstanced(p_min, p_max, ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
+        return;
+    }
     draw_list->PrimReserve(6, 4);
-    draw_list->PrimRectUV(ImVec2(pos.x + glyph->X0 * scale, pos.y + glyph->Y0 * scale), ImVec2(pos.x + glyph->X1 * scale, pos.y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
+    draw_list->PrimRectUV(p_min, p_max, ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
@@ -3583,11 +6442,16 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     if (s == text_end)
         return;
 
-    // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
-    const int vtx_count_max = (int)(text_end - s) * 4;
-    const int idx_count_max = (int)(text_end - s) * 6;
+    // Reserve vertices (or instanced quads) for remaining worse case (over-reserving is useful and easily amortized)
+    const bool use_quads = (draw_list->Flags & ImDrawListFlags_InstancedQuads) != 0;
+    const int vtx_count_max = use_quads ? 0 : (int)(text_end - s) * 4;
+    const int idx_count_max = use_quads ? 0 : (int)(text_end - s) * 6;
+    const int quad_count_max = use_quads ? (int)(text_end - s) : 0;
     const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
-    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    ImDrawQuad* quad_write = use_quads ? draw_list->PrimReserveQuads(quad_count_max) : NULL;
+    ImDrawQuad* quad_write_end = quad_write + quad_count_max;
+    if (!use_quads)
+        draw_list->PrimReserve(idx_count_max, vtx_count_max);
 
     ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
@@ -3595,65 +6459,87 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
 
+    // Bytes in [s, ascii_run_end) are printable ASCII located before the next word-wrap point: they need no decoding, no special
+    // character or word-wrap handling, and their glyph comes straight from AsciiGlyphs[]. Dynamic glyphs need FindGlyph() to rasterize them.
+    const bool ascii_fast_path = (AsciiGlyphs[0] != NULL && DynamicGlyphsOffset < 0);
+    const char* ascii_run_end = s;
+
     while (s < text_end)
     {
-        if (word_wrap_enabled)
+        const ImFontGlyph* glyph;
+        if (s < ascii_run_end)
+        {
+            glyph = AsciiGlyphs[(unsigned char)*s++];
+        }
+        else
         {
-            // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
-            if (!word_wrap_eol)
+            if (word_wrap_enabled)
             {
-                word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - pos.x));
-                if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
-                    word_wrap_eol++;    // +1 may not be a character start point in UTF-8 but it's ok because we use s >= word_wrap_eol below
+                // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
+                if (!word_wrap_eol)
+                {
+                    word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - pos.x));
+                    if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
+                        word_wrap_eol++;    // +1 may not be a character start point in UTF-8 but it's ok because we use s >= word_wrap_eol below
+                }
+
+                if (s >= word_wrap_eol)
+                {
+                    x = pos.x;
+                    y += line_height;
+                    word_wrap_eol = NULL;
+
+                    // Wrapping skips upcoming blanks
+                    while (s < text_end)
+                    {
+                        const char c = *s;
+                        if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+                    }
+                    continue;
+                }
             }
 
-            if (s >= word_wrap_eol)
+            // Decode and advance source
+            unsigned int c = (unsigned int)*s;
+            if (c < 0x80)
+            {
+                s += 1;
+            }
+            else
             {
-                x = pos.x;
-                y += line_height;
-                word_wrap_eol = NULL;
+                s += ImTextCharFromUtf8(&c, s, text_end);
+                if (c == 0) // Malformed UTF-8?
+                    break;
+            }
 
-                // Wrapping skips upcoming blanks
-                while (s < text_end)
+            if (c < 32)
+            {
+                if (c == '\n')
                 {
-                    const char c = *s;
-                    if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+                    x = pos.x;
+                    y += line_height;
+                    if (y > clip_rect.w)
+                        break; // break out of main loop
+                    continue;
                 }
-                continue;
+                if (c == '\r')
+                    continue;
             }
-        }
-
-        // Decode and advance source
-        unsigned int c = (unsigned int)*s;
-        if (c < 0x80)
-        {
-            s += 1;
-        }
-        else
-        {
-            s += ImTextCharFromUtf8(&c, s, text_end);
-            if (c == 0) // Malformed UTF-8?
-                break;
-        }
 
-        if (c < 32)
-        {
-            if (c == '\n')
+            if (c < 0x80 && ascii_fast_path)
             {
-                x = pos.x;
-                y += line_height;
-                if (y > clip_rect.w)
-                    break; // break out of main loop
-                continue;
+                glyph = AsciiGlyphs[c];
+                if (c >= 32)
+                    ascii_run_end = ImTextFindAsciiRunEnd(s, word_wrap_enabled ? word_wrap_eol : text_end);
+            }
+            else
+            {
+                glyph = FindGlyph((ImWchar)c);
+                if (glyph == NULL)
+                    continue;
             }
-            if (c == '\r')
-                continue;
         }
 
-        const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
-        if (glyph == NULL)
-            continue;
-
         float char_width = glyph->AdvanceX * scale;
         if (glyph->Visible)
         {
@@ -3704,13 +6590,28 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
+                if (use_quads)
+                {
+                    quad_write->Min = ImVec2(x1, y1); quad_write->Max = ImVec2(x2, y2); quad_write->UvMin = ImVec2(u1, v1); quad_write->UvMax = ImVec2(u2, v2); quad_write->Col = glyph_col; quad_write->Rounding = 0.0f; quad_write->Flags = 0;
+                    quad_write++;
+                }
+                else
                 {
                     idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                     idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+                    const ImS16 px1 = ImDrawVertPos::Pack(x1), py1 = ImDrawVertPos::Pack(y1), px2 = ImDrawVertPos::Pack(x2), py2 = ImDrawVertPos::Pack(y2);
+                    const ImU16 pu1 = ImDrawVertUV::Pack(u1), pv1 = ImDrawVertUV::Pack(v1), pu2 = ImDrawVertUV::Pack(u2), pv2 = ImDrawVertUV::Pack(v2);
+                    vtx_write[0].pos.x16 = px1; vtx_write[0].pos.y16 = py1; vtx_write[0].col = glyph_col; vtx_write[0].uv.u16 = pu1; vtx_write[0].uv.v16 = pv1;
+                    vtx_write[1].pos.x16 = px2; vtx_write[1].pos.y16 = py1; vtx_write[1].col = glyph_col; vtx_write[1].uv.u16 = pu2; vtx_write[1].uv.v16 = pv1;
+                    vtx_write[2].pos.x16 = px2; vtx_write[2].pos.y16 = py2; vtx_write[2].col = glyph_col; vtx_write[2].uv.u16 = pu2; vtx_write[2].uv.v16 = pv2;
+                    vtx_write[3].pos.x16 = px1; vtx_write[3].pos.y16 = py2; vtx_write[3].col = glyph_col; vtx_write[3].uv.u16 = pu1; vtx_write[3].uv.v16 = pv2;
+#else
+                    vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = glyph_col; vtx_write[0].uv = ImVec2(u1, v1);
+                    vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = glyph_col; vtx_write[1].uv = ImVec2(u2, v1);
+                    vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = glyph_col; vtx_write[2].uv = ImVec2(u2, v2);
+                    vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = glyph_col; vtx_write[3].uv = ImVec2(u1, v2);
+#endif
                     vtx_write += 4;
                     vtx_current_idx += 4;
                     idx_write += 6;
@@ -3720,7 +6621,12 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
         x += char_width;
     }
 
-    // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+    // Give back unused quads or vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+    if (use_quads)
+    {
+        draw_list->PrimUnreserveQuads((int)(quad_write_end - quad_write));
+        return;
+    }
     draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
     draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
     draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
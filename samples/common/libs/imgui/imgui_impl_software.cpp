@@ -0,0 +1,824 @@
+// dear imgui: Renderer Backend for CPU rendering into a RGBA8 buffer (headless rendering, screenshots, thumbnails)
+// This needs to be used along with a Platform Backend, or with io.DisplaySize/io.DeltaTime set by yourself when running without a window.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftware_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded: the framebuffer is split in tiles, which are rasterized in parallel.
+//  [X] Renderer: Font atlas built with ImFontAtlasFlags_DynamicGlyphs (regions listed in ImFontAtlas::TexDirtyRects are uploaded by RenderDrawData).
+//  [X] Renderer: Font atlas glyphs are rasterized on our threads, unless ImFontAtlas::BuildParallelFor is already set.
+//  [X] Renderer: Signed distance field glyphs (ImFontConfig::SignedDistanceField). We set ImGuiBackendFlags_RendererHasSdfText.
+
+// CHANGELOG
+//  2026-10-18: Keep worker threads alive between frames, instead of spawning them several times per RenderDrawData() call.
+//  2026-10-17: Support signed distance field glyphs (ImGuiBackendFlags_RendererHasSdfText).
+//  2026-10-17: Build the font atlas on our threads.
+//  2026-10-17: Upload font atlas regions rasterized on demand (ImFontAtlasFlags_DynamicGlyphs).
+//  2026-10-17: Initial version.
+
+// Overview of ImGui_ImplSoftware_RenderDrawData():
+// - Triangles are set up in parallel (fixed point edge equations + planes for interpolated attributes),
+//   then binned in submission order into tiles of IMGUI_IMPL_SOFTWARE_TILE_SIZE pixels.
+// - Tiles are then rasterized in parallel. Each tile is owned by a single thread, which draws its triangles in order: no synchronization is needed on pixels.
+// - Most triangles output by Dear ImGui use the white pixel of the font atlas: when the 3 vertices share their UV, the texel is sampled
+//   once per triangle. When they also share their color, pixels are filled with a constant color.
+// - User callbacks are called in order: triangles submitted before a callback are fully rasterized before it is called.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_software.h"
+#include <stdio.h>
+#include <stdint.h>     // int64_t
+#include <float.h>      // FLT_MAX
+#include <math.h>       // sqrtf
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Tile size in pixels. Smaller tiles balance work better between threads, larger tiles reduce the cost of binning.
+#ifndef IMGUI_IMPL_SOFTWARE_TILE_SIZE
+#define IMGUI_IMPL_SOFTWARE_TILE_SIZE   64
+#endif
+
+#define IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS   4                                       // Vertex positions are snapped to 1/16th of a pixel
+#define IMGUI_IMPL_SOFTWARE_SUBPIXEL_ONE    (1 << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS)
+#define IMGUI_IMPL_SOFTWARE_COORD_MAX       ((float)(1 << 20))                      // Positions are clamped to +/- this many pixels to keep edge equations within 64-bit
+
+enum ImGui_ImplSoftware_ShadeMode
+{
+    ImGui_ImplSoftware_ShadeMode_Flat,          // Constant color
+    ImGui_ImplSoftware_ShadeMode_Gouraud,       // Interpolated color, constant texel (merged into the color)
+    ImGui_ImplSoftware_ShadeMode_Textured,      // Interpolated color and UV
+    ImGui_ImplSoftware_ShadeMode_TexturedSdf    // Interpolated color and UV, texel alpha is a signed distance field (font atlas glyphs at V >= ImFontAtlas::TexUvSdfMinV)
+};
+
+// A triangle ready to be rasterized, computed once and shared by all tiles it touches
+struct ImGui_ImplSoftware_Triangle
+{
+    int                                 X[3], Y[3];                 // Vertex positions, in fixed point pixels. Ordered so that edge equations are positive inside.
+    int                                 MinX, MinY, MaxX, MaxY;     // Pixel bounds, intersected with scissor and framebuffer (Max exclusive). Empty when the triangle is culled.
+    ImGui_ImplSoftware_ShadeMode        ShadeMode;
+    ImU32                               Col;                        // ShadeMode_Flat: RGBA8 color, R in lowest byte
+    const ImGui_ImplSoftware_Texture*   Texture;                    // ShadeMode_Textured, ShadeMode_TexturedSdf
+    float                               SdfScale;                   // ShadeMode_TexturedSdf: coverage = (texel alpha - 128) * SdfScale + 0.5f
+    float                               Planes[6][3];               // R, G, B, A (0..255) then U, V: value at center of pixel (x, y) = [0] + [1] * x + [2] * y
+};
+
+// A draw command, triangles of all draw commands being numbered continuously
+struct ImGui_ImplSoftware_Command
+{
+    const ImDrawVert*                   VtxBuffer;                  // Already offset by ImDrawCmd::VtxOffset
+    const ImDrawIdx*                    IdxBuffer;                  // Already offset by ImDrawCmd::IdxOffset
+    int                                 TriStart;
+    int                                 TriCount;
+    int                                 ClipMinX, ClipMinY, ClipMaxX, ClipMaxY;
+    const ImGui_ImplSoftware_Texture*   Texture;
+};
+
+// Worker threads created by ImGui_ImplSoftware_Init(), woken up for each parallel job (the calling thread also takes part in it)
+struct ImGui_ImplSoftware_ThreadPool
+{
+    std::thread                                 Threads[63];
+    int                                         ThreadsCount;       // Number of workers, not including the calling thread
+    std::mutex                                  Mutex;
+    std::condition_variable                     JobCond;            // Signaled when a job is posted, or when quitting
+    std::condition_variable                     DoneCond;           // Signaled when the last worker is done with the current job
+    void                                        (*JobFunc)(void* job_data);
+    void*                                       JobData;
+    int                                         JobWorkersCount;    // Number of workers taking part in the current job
+    int                                         JobPendingCount;    // Number of workers still running the current job
+    unsigned int                                JobGeneration;      // Incremented for each job, so each worker runs it once
+    bool                                        Quit;
+
+    ImGui_ImplSoftware_ThreadPool() { ThreadsCount = 0; JobFunc = NULL; JobData = NULL; JobWorkersCount = JobPendingCount = 0; JobGeneration = 0; Quit = false; }
+};
+
+struct ImGui_ImplSoftware_Data
+{
+    int                                         ThreadCount;
+    ImGui_ImplSoftware_ThreadPool               ThreadPool;
+    ImGui_ImplSoftware_Texture                  FontTexture;
+    ImVector<unsigned char>                     FontPixels;
+    float                                       FontSdfMinV;        // Copy of ImFontAtlas::TexUvSdfMinV
+    float                                       FontSdfSpread;      // Copy of ImFontAtlas::TexSdfSpread
+
+    // Scratch buffers reused between frames
+    ImVector<ImGui_ImplSoftware_Command>        Commands;
+    ImVector<ImGui_ImplSoftware_Triangle>       Triangles;
+    ImVector<int>                               TileTriStart;       // Index in TileTris[] of the first triangle of each tile (+ one extra entry for the end)
+    ImVector<int>                               TileTris;           // Triangles indices binned by tile, in submission order
+
+    ImGui_ImplSoftware_Data()   { ThreadCount = 1; FontSdfMinV = FLT_MAX; FontSdfSpread = 0.0f; }
+};
+
+// Small helpers (we don't include imgui_internal.h in backends)
+template<typename T> static inline T    ImGui_ImplSoftware_Min(T a, T b)    { return a < b ? a : b; }
+template<typename T> static inline T    ImGui_ImplSoftware_Max(T a, T b)    { return a >= b ? a : b; }
+template<typename T> static inline void ImGui_ImplSoftware_Swap(T& a, T& b) { T tmp = a; a = b; b = tmp; }
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoftware_Data* ImGui_ImplSoftware_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftware_Data*)ImGui::GetIO().BackendRendererUserData : NULL;
+}
+
+static void ImGui_ImplSoftware_WorkerThread(ImGui_ImplSoftware_ThreadPool* pool, int worker_n)
+{
+    unsigned int last_generation = 0;
+    std::unique_lock<std::mutex> lock(pool->Mutex);
+    for (;;)
+    {
+        pool->JobCond.wait(lock, [&]() { return pool->Quit || pool->JobGeneration != last_generation; });
+        if (pool->Quit)
+            return;
+        last_generation = pool->JobGeneration;
+        if (worker_n >= pool->JobWorkersCount)
+            continue;
+        lock.unlock();
+        pool->JobFunc(pool->JobData);
+        lock.lock();
+        if (--pool->JobPendingCount == 0)
+            pool->DoneCond.notify_one();
+    }
+}
+
+static void ImGui_ImplSoftware_StartThreads(ImGui_ImplSoftware_ThreadPool* pool, int thread_count)
+{
+    pool->ThreadsCount = ImGui_ImplSoftware_Min(thread_count - 1, (int)IM_ARRAYSIZE(pool->Threads));
+    for (int n = 0; n < pool->ThreadsCount; n++)
+        pool->Threads[n] = std::thread(ImGui_ImplSoftware_WorkerThread, pool, n);
+}
+
+static void ImGui_ImplSoftware_StopThreads(ImGui_ImplSoftware_ThreadPool* pool)
+{
+    {
+        std::lock_guard<std::mutex> lock(pool->Mutex);
+        pool->Quit = true;
+    }
+    pool->JobCond.notify_all();
+    for (int n = 0; n < pool->ThreadsCount; n++)
+        pool->Threads[n].join();
+    pool->ThreadsCount = 0;
+}
+
+// Run 'func' on 'thread_count' threads, including the calling one. Work is distributed by 'func' itself (e.g. with an atomic counter).
+template<typename FUNC>
+static void ImGui_ImplSoftware_RunThreads(ImGui_ImplSoftware_Data* bd, int thread_count, FUNC func)
+{
+    ImGui_ImplSoftware_ThreadPool* pool = &bd->ThreadPool;
+    const int workers_count = ImGui_ImplSoftware_Min(thread_count - 1, pool->ThreadsCount);
+    if (workers_count <= 0)
+    {
+        func();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pool->Mutex);
+        pool->JobFunc = [](void* job_data) { (*(FUNC*)job_data)(); };
+        pool->JobData = (void*)&func;
+        pool->JobWorkersCount = pool->JobPendingCount = workers_count;
+        pool->JobGeneration++;
+    }
+    pool->JobCond.notify_all();
+    func();
+    std::unique_lock<std::mutex> lock(pool->Mutex);
+    pool->DoneCond.wait(lock, [&]() { return pool->JobPendingCount == 0; });
+}
+
+bool ImGui_ImplSoftware_Init(int thread_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendRendererUserData == NULL && "Already initialized a renderer backend!");
+
+    ImGui_ImplSoftware_Data* bd = IM_NEW(ImGui_ImplSoftware_Data)();
+    if (thread_count <= 0)
+        thread_count = (int)std::thread::hardware_concurrency();
+    bd->ThreadCount = (thread_count > 0) ? thread_count : 1;
+    ImGui_ImplSoftware_StartThreads(&bd->ThreadPool, bd->ThreadCount);
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_software";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfText;    // We can convert signed distance field glyphs to coverage.
+    return true;
+}
+
+void ImGui_ImplSoftware_Shutdown()
+{
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    IM_ASSERT(bd != NULL && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplSoftware_DestroyFontsTexture();
+    ImGui_ImplSoftware_StopThreads(&bd->ThreadPool);
+    io.BackendRendererName = NULL;
+    io.BackendRendererUserData = NULL;
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoftware_NewFrame()
+{
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplSoftware_Init()?");
+    if (bd->FontTexture.Pixels == NULL)
+        ImGui_ImplSoftware_CreateFontsTexture();
+}
+
+// Run font atlas build jobs on our threads (see ImFontAtlas::BuildParallelFor)
+static void ImGui_ImplSoftware_FontAtlasParallelFor(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count, void* user_data)
+{
+    ImGui_ImplSoftware_Data* bd = (ImGui_ImplSoftware_Data*)user_data;
+    std::atomic<int> next_job(0);
+    ImGui_ImplSoftware_RunThreads(bd, ImGui_ImplSoftware_Min(bd->ThreadCount, job_count), [&]()
+    {
+        for (int job_n = next_job++; job_n < job_count; job_n = next_job++)
+            job_func(job_data, job_n);
+    });
+}
+
+bool ImGui_ImplSoftware_CreateFontsTexture()
+{
+    // Build texture atlas, and keep our own copy as the atlas may discard its pixels with ClearTexData()
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    unsigned char* pixels;
+    int width, height;
+    const bool use_our_threads = (io.Fonts->BuildParallelFor == NULL && bd->ThreadCount > 1);
+    if (use_our_threads)
+    {
+        io.Fonts->BuildParallelFor = ImGui_ImplSoftware_FontAtlasParallelFor;
+        io.Fonts->BuildParallelForUserData = bd;
+    }
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    if (use_our_threads)
+    {
+        io.Fonts->BuildParallelFor = NULL;
+        io.Fonts->BuildParallelForUserData = NULL;
+    }
+    bd->FontPixels.resize(width * height * 4);
+    memcpy(bd->FontPixels.Data, pixels, (size_t)bd->FontPixels.Size);
+    bd->FontTexture.Pixels = bd->FontPixels.Data;
+    bd->FontTexture.Width = width;
+    bd->FontTexture.Height = height;
+    bd->FontSdfMinV = io.Fonts->TexUvSdfMinV;
+    bd->FontSdfSpread = (float)io.Fonts->TexSdfSpread;
+
+    // Store our identifier
+    io.Fonts->SetTexID((ImTextureID)&bd->FontTexture);
+    return true;
+}
+
+// Copy glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+static void ImGui_ImplSoftware_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    ImFontAtlas* atlas = io.Fonts;
+    if (atlas->TexDirtyRects.Size == 0 || bd->FontTexture.Pixels == NULL)
+        return;
+    IM_ASSERT(atlas->TexPixelsRGBA32 != NULL && atlas->TexWidth == bd->FontTexture.Width && atlas->TexHeight == bd->FontTexture.Height);
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlasDirtyRect& r = atlas->TexDirtyRects[n];
+        for (int y = r.Y; y < r.Y + r.Height; y++)
+            memcpy(&bd->FontPixels.Data[((size_t)y * atlas->TexWidth + r.X) * 4], &atlas->TexPixelsRGBA32[(size_t)y * atlas->TexWidth + r.X], (size_t)r.Width * 4);
+    }
+    atlas->ClearTexDirtyRects();
+}
+
+void ImGui_ImplSoftware_DestroyFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    if (bd->FontTexture.Pixels != NULL)
+    {
+        bd->FontPixels.clear();
+        bd->FontTexture = ImGui_ImplSoftware_Texture();
+        io.Fonts->SetTexID(0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+static inline int ImGui_ImplSoftware_ToFixed(float v, float offset, float scale)
+{
+    v = (v - offset) * scale;
+    v = (v >= -IMGUI_IMPL_SOFTWARE_COORD_MAX) ? (v <= IMGUI_IMPL_SOFTWARE_COORD_MAX ? v : IMGUI_IMPL_SOFTWARE_COORD_MAX) : -IMGUI_IMPL_SOFTWARE_COORD_MAX; // Also map NaN to the lower bound
+    v *= (float)IMGUI_IMPL_SOFTWARE_SUBPIXEL_ONE;
+    return (int)(v >= 0.0f ? v + 0.5f : v - 0.5f);
+}
+
+static inline ImU32 ImGui_ImplSoftware_ColorToRGBA(ImU32 col)
+{
+    return (((col >> IM_COL32_R_SHIFT) & 0xFF) << 0) | (((col >> IM_COL32_G_SHIFT) & 0xFF) << 8) | (((col >> IM_COL32_B_SHIFT) & 0xFF) << 16) | (((col >> IM_COL32_A_SHIFT) & 0xFF) << 24);
+}
+
+static inline unsigned int ImGui_ImplSoftware_Div255(unsigned int v)   // Exact for v in 0..255*255
+{
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+// Multiply two RGBA8 colors
+static inline ImU32 ImGui_ImplSoftware_Modulate(ImU32 a, ImU32 b)
+{
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoftware_Div255(((a >> shift) & 0xFF) * ((b >> shift) & 0xFF)) << shift;
+    return out;
+}
+
+// Bilinear filtering with clamp to edge addressing, return RGBA8
+static ImU32 ImGui_ImplSoftware_SampleBilinear(const ImGui_ImplSoftware_Texture* tex, float u, float v)
+{
+    float fx = u * tex->Width - 0.5f;
+    float fy = v * tex->Height - 0.5f;
+    fx = (fx >= 0.0f) ? (fx <= (float)(tex->Width - 1) ? fx : (float)(tex->Width - 1)) : 0.0f;
+    fy = (fy >= 0.0f) ? (fy <= (float)(tex->Height - 1) ? fy : (float)(tex->Height - 1)) : 0.0f;
+    const int x0 = (int)fx, y0 = (int)fy;
+    const int x1 = (x0 + 1 < tex->Width) ? x0 + 1 : x0;
+    const int y1 = (y0 + 1 < tex->Height) ? y0 + 1 : y0;
+    const unsigned int wx = (unsigned int)((fx - x0) * 256.0f), wy = (unsigned int)((fy - y0) * 256.0f);
+    const unsigned char* p00 = tex->Pixels + (y0 * tex->Width + x0) * 4;
+    const unsigned char* p10 = tex->Pixels + (y0 * tex->Width + x1) * 4;
+    const unsigned char* p01 = tex->Pixels + (y1 * tex->Width + x0) * 4;
+    const unsigned char* p11 = tex->Pixels + (y1 * tex->Width + x1) * 4;
+    ImU32 out = 0;
+    for (int c = 0; c < 4; c++)
+    {
+        const unsigned int top = p00[c] * (256 - wx) + p10[c] * wx;
+        const unsigned int bottom = p01[c] * (256 - wx) + p11[c] * wx;
+        out |= (((top * (256 - wy) + bottom * wy) + (1 << 15)) >> 16) << (c * 8);
+    }
+    return out;
+}
+
+// Blend a RGBA8 color (R in lowest byte) over a pixel
+static inline void ImGui_ImplSoftware_BlendPixel(unsigned char* dst, ImU32 src)
+{
+    const unsigned int a = src >> 24;
+    if (a == 255)
+    {
+        memcpy(dst, &src, 4); // Also writes alpha = 255 (assume little-endian RGBA8 layout in memory, same as in the rest of the code)
+        return;
+    }
+    if (a == 0)
+        return;
+    const unsigned int inv_a = 255 - a;
+    dst[0] = (unsigned char)ImGui_ImplSoftware_Div255(((src >> 0) & 0xFF) * a + dst[0] * inv_a);
+    dst[1] = (unsigned char)ImGui_ImplSoftware_Div255(((src >> 8) & 0xFF) * a + dst[1] * inv_a);
+    dst[2] = (unsigned char)ImGui_ImplSoftware_Div255(((src >> 16) & 0xFF) * a + dst[2] * inv_a);
+    dst[3] = (unsigned char)(a + ImGui_ImplSoftware_Div255(dst[3] * inv_a));
+}
+
+static inline unsigned int ImGui_ImplSoftware_SaturateChannel(float v)
+{
+    return (v >= 0.0f) ? (v <= 255.0f ? (unsigned int)(v + 0.5f) : 255) : 0;
+}
+
+static void ImGui_ImplSoftware_SetupTriangle(const ImGui_ImplSoftware_Data* bd, ImGui_ImplSoftware_Triangle* tri, const ImGui_ImplSoftware_Command* cmd, int tri_n, const ImVec2& display_pos, const ImVec2& fb_scale)
+{
+    const ImDrawVert* v[3];
+    for (int n = 0; n < 3; n++)
+    {
+        v[n] = &cmd->VtxBuffer[cmd->IdxBuffer[tri_n * 3 + n]];
+        const ImVec2 pos = v[n]->pos;
+        tri->X[n] = ImGui_ImplSoftware_ToFixed(pos.x, display_pos.x, fb_scale.x);
+        tri->Y[n] = ImGui_ImplSoftware_ToFixed(pos.y, display_pos.y, fb_scale.y);
+    }
+
+    // Orient so that edge equations are positive inside, discard degenerate triangles
+    const int64_t area = (int64_t)(tri->X[1] - tri->X[0]) * (tri->Y[2] - tri->Y[0]) - (int64_t)(tri->Y[1] - tri->Y[0]) * (tri->X[2] - tri->X[0]);
+    tri->MinX = tri->MaxX = 0;
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        ImGui_ImplSoftware_Swap(tri->X[1], tri->X[2]);
+        ImGui_ImplSoftware_Swap(tri->Y[1], tri->Y[2]);
+        ImGui_ImplSoftware_Swap(v[1], v[2]);
+    }
+
+    // Pixel bounds (conservative, the edge equations decide coverage)
+    const int min_x = ImGui_ImplSoftware_Min(ImGui_ImplSoftware_Min(tri->X[0], tri->X[1]), tri->X[2]);
+    const int min_y = ImGui_ImplSoftware_Min(ImGui_ImplSoftware_Min(tri->Y[0], tri->Y[1]), tri->Y[2]);
+    const int max_x = ImGui_ImplSoftware_Max(ImGui_ImplSoftware_Max(tri->X[0], tri->X[1]), tri->X[2]);
+    const int max_y = ImGui_ImplSoftware_Max(ImGui_ImplSoftware_Max(tri->Y[0], tri->Y[1]), tri->Y[2]);
+    tri->MinX = ImGui_ImplSoftware_Max(min_x >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS, cmd->ClipMinX);
+    tri->MinY = ImGui_ImplSoftware_Max(min_y >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS, cmd->ClipMinY);
+    tri->MaxX = ImGui_ImplSoftware_Min((max_x >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + 1, cmd->ClipMaxX);
+    tri->MaxY = ImGui_ImplSoftware_Min((max_y >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + 1, cmd->ClipMaxY);
+    if (tri->MinX >= tri->MaxX || tri->MinY >= tri->MaxY)
+    {
+        tri->MinX = tri->MaxX = 0;
+        return;
+    }
+
+    // Select the cheapest shading
+    const ImVec2 uv0 = v[0]->uv, uv1 = v[1]->uv, uv2 = v[2]->uv;
+    const bool constant_uv = (uv0.x == uv1.x && uv0.x == uv2.x && uv0.y == uv1.y && uv0.y == uv2.y);
+    ImU32 texel = IM_COL32_WHITE;
+    if (constant_uv && cmd->Texture != NULL)
+        texel = ImGui_ImplSoftware_SampleBilinear(cmd->Texture, uv0.x, uv0.y);
+    ImU32 cols[3];
+    for (int n = 0; n < 3; n++)
+        cols[n] = constant_uv ? ImGui_ImplSoftware_Modulate(ImGui_ImplSoftware_ColorToRGBA(v[n]->col), texel) : ImGui_ImplSoftware_ColorToRGBA(v[n]->col);
+    tri->Texture = cmd->Texture;
+    if (constant_uv && cols[0] == cols[1] && cols[0] == cols[2])
+    {
+        tri->ShadeMode = ImGui_ImplSoftware_ShadeMode_Flat;
+        tri->Col = cols[0];
+        return;
+    }
+    tri->ShadeMode = (constant_uv || cmd->Texture == NULL) ? ImGui_ImplSoftware_ShadeMode_Gouraud : ImGui_ImplSoftware_ShadeMode_Textured;
+    if (tri->ShadeMode == ImGui_ImplSoftware_ShadeMode_Textured && cmd->Texture == &bd->FontTexture && uv0.y >= bd->FontSdfMinV && uv1.y >= bd->FontSdfMinV && uv2.y >= bd->FontSdfMinV)
+        tri->ShadeMode = ImGui_ImplSoftware_ShadeMode_TexturedSdf;
+
+    // Attribute planes, evaluated at pixel centers
+    const float one_over_subpixel = 1.0f / IMGUI_IMPL_SOFTWARE_SUBPIXEL_ONE;
+    const float x0 = tri->X[0] * one_over_subpixel, y0 = tri->Y[0] * one_over_subpixel;
+    const float dx1 = (tri->X[1] - tri->X[0]) * one_over_subpixel, dy1 = (tri->Y[1] - tri->Y[0]) * one_over_subpixel;
+    const float dx2 = (tri->X[2] - tri->X[0]) * one_over_subpixel, dy2 = (tri->Y[2] - tri->Y[0]) * one_over_subpixel;
+    const float inv_det = 1.0f / (dx1 * dy2 - dx2 * dy1);
+    float values[6][3];
+    for (int n = 0; n < 3; n++)
+    {
+        for (int c = 0; c < 4; c++)
+            values[c][n] = (float)((cols[n] >> (c * 8)) & 0xFF);
+        const ImVec2 uv = v[n]->uv;
+        values[4][n] = uv.x;
+        values[5][n] = uv.y;
+    }
+    const int plane_count = (tri->ShadeMode == ImGui_ImplSoftware_ShadeMode_Gouraud) ? 4 : 6;
+    for (int p = 0; p < plane_count; p++)
+    {
+        const float d1 = values[p][1] - values[p][0];
+        const float d2 = values[p][2] - values[p][0];
+        const float ddx = (d1 * dy2 - d2 * dy1) * inv_det;
+        const float ddy = (d2 * dx1 - d1 * dx2) * inv_det;
+        tri->Planes[p][0] = values[p][0] + ddx * (0.5f - x0) + ddy * (0.5f - y0);
+        tri->Planes[p][1] = ddx;
+        tri->Planes[p][2] = ddy;
+    }
+
+    // Signed distance field: UV are affine over the triangle, so the pixel footprint in texels is constant (same as ImFontSdfCalcCoverage() in imgui_draw.cpp)
+    if (tri->ShadeMode == ImGui_ImplSoftware_ShadeMode_TexturedSdf)
+    {
+        const float tex_w = (float)cmd->Texture->Width, tex_h = (float)cmd->Texture->Height;
+        const float texels_per_pixel_x = sqrtf(tri->Planes[4][1] * tri->Planes[4][1] * tex_w * tex_w + tri->Planes[5][1] * tri->Planes[5][1] * tex_h * tex_h);
+        const float texels_per_pixel_y = sqrtf(tri->Planes[4][2] * tri->Planes[4][2] * tex_w * tex_w + tri->Planes[5][2] * tri->Planes[5][2] * tex_h * tex_h);
+        const float texels_per_pixel = ImGui_ImplSoftware_Max(ImGui_ImplSoftware_Max(texels_per_pixel_x, texels_per_pixel_y), 1e-6f);
+        tri->SdfScale = (bd->FontSdfSpread / 128.0f) / texels_per_pixel;
+    }
+}
+
+// Rasterize a triangle within a rectangle of pixels
+static void ImGui_ImplSoftware_RasterTriangle(const ImGui_ImplSoftware_Triangle* tri, unsigned char* pixels, int stride, int rect_min_x, int rect_min_y, int rect_max_x, int rect_max_y)
+{
+    const int x_min = ImGui_ImplSoftware_Max(tri->MinX, rect_min_x), y_min = ImGui_ImplSoftware_Max(tri->MinY, rect_min_y);
+    const int x_max = ImGui_ImplSoftware_Min(tri->MaxX, rect_max_x), y_max = ImGui_ImplSoftware_Min(tri->MaxY, rect_max_y);
+    if (x_min >= x_max || y_min >= y_max)
+        return;
+
+    // Edge equations, evaluated at the center of pixel (x_min, y_min). Edge n is opposite to vertex n.
+    // Top-left fill rule: pixel centers exactly on an edge are only covered by a top or left edge, the -1 bias excludes them for other edges.
+    int64_t w_row[3], step_x[3], step_y[3];
+    const int64_t px = ((int64_t)x_min << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + IMGUI_IMPL_SOFTWARE_SUBPIXEL_ONE / 2;
+    const int64_t py = ((int64_t)y_min << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + IMGUI_IMPL_SOFTWARE_SUBPIXEL_ONE / 2;
+    for (int n = 0; n < 3; n++)
+    {
+        const int ax = tri->X[(n + 1) % 3], ay = tri->Y[(n + 1) % 3];
+        const int bx = tri->X[(n + 2) % 3], by = tri->Y[(n + 2) % 3];
+        const int64_t edge_dx = bx - ax, edge_dy = by - ay;
+        const bool top_left = (edge_dy < 0) || (edge_dy == 0 && edge_dx > 0);
+        w_row[n] = edge_dx * (py - ay) - edge_dy * (px - ax) + (top_left ? 0 : -1);
+        step_x[n] = -edge_dy * IMGUI_IMPL_SOFTWARE_SUBPIXEL_ONE;
+        step_y[n] = edge_dx * IMGUI_IMPL_SOFTWARE_SUBPIXEL_ONE;
+    }
+
+    const ImGui_ImplSoftware_ShadeMode shade_mode = tri->ShadeMode;
+    const int plane_count = (shade_mode == ImGui_ImplSoftware_ShadeMode_Flat) ? 0 : (shade_mode == ImGui_ImplSoftware_ShadeMode_Gouraud) ? 4 : 6;
+    for (int y = y_min; y < y_max; y++)
+    {
+        int64_t w0 = w_row[0], w1 = w_row[1], w2 = w_row[2];
+        unsigned char* dst = pixels + (size_t)y * stride + (size_t)x_min * 4;
+        float attr[6];
+        for (int p = 0; p < plane_count; p++)
+            attr[p] = tri->Planes[p][0] + tri->Planes[p][1] * x_min + tri->Planes[p][2] * y;
+        for (int x = x_min; x < x_max; x++, dst += 4)
+        {
+            if ((w0 | w1 | w2) >= 0)
+            {
+                if (shade_mode == ImGui_ImplSoftware_ShadeMode_Flat)
+                {
+                    ImGui_ImplSoftware_BlendPixel(dst, tri->Col);
+                }
+                else
+                {
+                    ImU32 col = ImGui_ImplSoftware_SaturateChannel(attr[0]) | (ImGui_ImplSoftware_SaturateChannel(attr[1]) << 8) | (ImGui_ImplSoftware_SaturateChannel(attr[2]) << 16) | (ImGui_ImplSoftware_SaturateChannel(attr[3]) << 24);
+                    if (shade_mode == ImGui_ImplSoftware_ShadeMode_Textured)
+                        col = ImGui_ImplSoftware_Modulate(col, ImGui_ImplSoftware_SampleBilinear(tri->Texture, attr[4], attr[5]));
+                    else if (shade_mode == ImGui_ImplSoftware_ShadeMode_TexturedSdf)
+                    {
+                        const float dist = (float)(int)(ImGui_ImplSoftware_SampleBilinear(tri->Texture, attr[4], attr[5]) >> 24) - 128.0f;
+                        const unsigned int coverage = ImGui_ImplSoftware_SaturateChannel((dist * tri->SdfScale + 0.5f) * 255.0f);
+                        col = (col & 0x00FFFFFF) | (ImGui_ImplSoftware_Div255((col >> 24) * coverage) << 24);
+                    }
+                    ImGui_ImplSoftware_BlendPixel(dst, col);
+                }
+            }
+            w0 += step_x[0];
+            w1 += step_x[1];
+            w2 += step_x[2];
+            for (int p = 0; p < plane_count; p++)
+                attr[p] += tri->Planes[p][1];
+        }
+        w_row[0] += step_y[0];
+        w_row[1] += step_y[1];
+        w_row[2] += step_y[2];
+    }
+}
+
+// Rasterize triangles of Commands[]
+static void ImGui_ImplSoftware_RenderCommands(const ImVec2& display_pos, const ImVec2& fb_scale, unsigned char* pixels, int width, int height, int stride)
+{
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    if (bd->Commands.Size == 0)
+        return;
+    const ImGui_ImplSoftware_Command& last_cmd = bd->Commands.back();
+    const int tri_count = last_cmd.TriStart + last_cmd.TriCount;
+    bd->Triangles.resize(tri_count);
+
+    // Setup triangles, in chunks of consecutive commands
+    const int setup_chunk_size = 1024;
+    std::atomic<int> next_setup_chunk(0);
+    ImGui_ImplSoftware_RunThreads(bd, ImGui_ImplSoftware_Min(bd->ThreadCount, (tri_count + setup_chunk_size - 1) / setup_chunk_size), [&]()
+    {
+        for (int chunk_n = next_setup_chunk++; chunk_n * setup_chunk_size < tri_count; chunk_n = next_setup_chunk++)
+        {
+            const int tri_start = chunk_n * setup_chunk_size;
+            const int tri_end = ImGui_ImplSoftware_Min(tri_start + setup_chunk_size, tri_count);
+
+            // Binary search for the command containing the first triangle of the chunk
+            int cmd_n = 0;
+            for (int count = bd->Commands.Size; count > 0; )
+            {
+                const int half = count / 2;
+                if (bd->Commands[cmd_n + half].TriStart + bd->Commands[cmd_n + half].TriCount <= tri_start)
+                {
+                    cmd_n += half + 1;
+                    count -= half + 1;
+                }
+                else
+                {
+                    count = half;
+                }
+            }
+            for (int tri_n = tri_start; tri_n < tri_end; )
+            {
+                const ImGui_ImplSoftware_Command* cmd = &bd->Commands[cmd_n++];
+                const int cmd_tri_end = ImGui_ImplSoftware_Min(cmd->TriStart + cmd->TriCount, tri_end);
+                for (; tri_n < cmd_tri_end; tri_n++)
+                    ImGui_ImplSoftware_SetupTriangle(bd, &bd->Triangles[tri_n], cmd, tri_n - cmd->TriStart, display_pos, fb_scale);
+            }
+        }
+    });
+
+    // Bin triangles into tiles, in submission order
+    const int tile_size = IMGUI_IMPL_SOFTWARE_TILE_SIZE;
+    const int tiles_x = (width + tile_size - 1) / tile_size;
+    const int tiles_y = (height + tile_size - 1) / tile_size;
+    const int tile_count = tiles_x * tiles_y;
+    bd->TileTriStart.resize(tile_count + 1);
+    memset(bd->TileTriStart.Data, 0, (size_t)bd->TileTriStart.size_in_bytes());
+    int* tile_counts = bd->TileTriStart.Data + 1;
+    for (const ImGui_ImplSoftware_Triangle* tri = bd->Triangles.begin(); tri != bd->Triangles.end(); tri++)
+        if (tri->MinX < tri->MaxX)
+            for (int ty = tri->MinY / tile_size; ty <= (tri->MaxY - 1) / tile_size; ty++)
+                for (int tx = tri->MinX / tile_size; tx <= (tri->MaxX - 1) / tile_size; tx++)
+                    tile_counts[ty * tiles_x + tx]++;
+    for (int tile_n = 0; tile_n < tile_count; tile_n++)
+        tile_counts[tile_n] += bd->TileTriStart[tile_n];
+    bd->TileTris.resize(bd->TileTriStart[tile_count]);
+    for (int tri_n = 0; tri_n < bd->Triangles.Size; tri_n++)
+    {
+        const ImGui_ImplSoftware_Triangle* tri = &bd->Triangles[tri_n];
+        if (tri->MinX < tri->MaxX)
+            for (int ty = tri->MinY / tile_size; ty <= (tri->MaxY - 1) / tile_size; ty++)
+                for (int tx = tri->MinX / tile_size; tx <= (tri->MaxX - 1) / tile_size; tx++)
+                    bd->TileTris[bd->TileTriStart[ty * tiles_x + tx]++] = tri_n;
+    }
+    for (int tile_n = tile_count; tile_n > 0; tile_n--) // Restore start offsets, which were advanced to the end of each tile while filling
+        bd->TileTriStart[tile_n] = bd->TileTriStart[tile_n - 1];
+    bd->TileTriStart[0] = 0;
+
+    // Rasterize tiles
+    std::atomic<int> next_tile(0);
+    ImGui_ImplSoftware_RunThreads(bd, ImGui_ImplSoftware_Min(bd->ThreadCount, tile_count), [&]()
+    {
+        for (int tile_n = next_tile++; tile_n < tile_count; tile_n = next_tile++)
+        {
+            const int tile_min_x = (tile_n % tiles_x) * tile_size;
+            const int tile_min_y = (tile_n / tiles_x) * tile_size;
+            const int tile_max_x = ImGui_ImplSoftware_Min(tile_min_x + tile_size, width);
+            const int tile_max_y = ImGui_ImplSoftware_Min(tile_min_y + tile_size, height);
+            for (int n = bd->TileTriStart[tile_n]; n < bd->TileTriStart[tile_n + 1]; n++)
+                ImGui_ImplSoftware_RasterTriangle(&bd->Triangles[bd->TileTris[n]], pixels, stride, tile_min_x, tile_min_y, tile_max_x, tile_max_y);
+        }
+    });
+    bd->Commands.resize(0);
+}
+
+void ImGui_ImplSoftware_RenderDrawData(ImDrawData* draw_data, unsigned char* pixels, int width, int height, int stride)
+{
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplSoftware_Init()?");
+    ImGui_ImplSoftware_UpdateFontsTexture();
+    if (width <= 0 || height <= 0 || draw_data->CmdListsCount == 0)
+        return;
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    const ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    const ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Gather draw commands, rendering what we have so far when encountering a user callback
+    bd->Commands.resize(0);
+    int tri_count = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                ImGui_ImplSoftware_RenderCommands(clip_off, clip_scale, pixels, width, height, stride);
+                tri_count = 0;
+
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state: we have none)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+                continue;
+            }
+            IM_ASSERT(pcmd->QuadCount == 0 && "Instanced quads are not supported, they are expanded by Render() as we don't set ImGuiBackendFlags_RendererHasInstancedQuads.");
+            IM_ASSERT(pcmd->ElemCount % 3 == 0);
+
+            // Project scissor/clipping rectangles into framebuffer space (rounded down, same as GPU backends)
+            const float clip_min_x = (pcmd->ClipRect.x - clip_off.x) * clip_scale.x;
+            const float clip_min_y = (pcmd->ClipRect.y - clip_off.y) * clip_scale.y;
+            const float clip_max_x = (pcmd->ClipRect.z - clip_off.x) * clip_scale.x;
+            const float clip_max_y = (pcmd->ClipRect.w - clip_off.y) * clip_scale.y;
+            ImGui_ImplSoftware_Command cmd;
+            cmd.ClipMinX = (clip_min_x > 0.0f) ? (int)ImGui_ImplSoftware_Min(clip_min_x, (float)width) : 0;
+            cmd.ClipMinY = (clip_min_y > 0.0f) ? (int)ImGui_ImplSoftware_Min(clip_min_y, (float)height) : 0;
+            cmd.ClipMaxX = (clip_max_x > 0.0f) ? (int)ImGui_ImplSoftware_Min(clip_max_x, (float)width) : 0;
+            cmd.ClipMaxY = (clip_max_y > 0.0f) ? (int)ImGui_ImplSoftware_Min(clip_max_y, (float)height) : 0;
+            if (pcmd->ElemCount == 0 || cmd.ClipMaxX <= cmd.ClipMinX || cmd.ClipMaxY <= cmd.ClipMinY)
+                continue;
+            cmd.VtxBuffer = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            cmd.IdxBuffer = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            cmd.TriStart = tri_count;
+            cmd.TriCount = (int)pcmd->ElemCount / 3;
+            cmd.Texture = (const ImGui_ImplSoftware_Texture*)pcmd->GetTexID();
+            bd->Commands.push_back(cmd);
+            tri_count += cmd.TriCount;
+        }
+    }
+    ImGui_ImplSoftware_RenderCommands(clip_off, clip_scale, pixels, width, height, stride);
+}
+
+//-----------------------------------------------------------------------------
+// Image files
+//-----------------------------------------------------------------------------
+
+bool ImGui_ImplSoftware_SaveImagePPM(const char* filename, const unsigned char* pixels, int width, int height, int stride)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return false;
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    ImVector<unsigned char> row;
+    row.resize(width * 3);
+    bool ok = true;
+    for (int y = 0; y < height && ok; y++)
+    {
+        const unsigned char* src = pixels + (size_t)y * stride;
+        for (int x = 0; x < width; x++)
+            memcpy(&row[x * 3], src + x * 4, 3);
+        ok = fwrite(row.Data, 1, (size_t)row.Size, f) == (size_t)row.Size;
+    }
+    return (fclose(f) == 0) && ok;
+}
+
+// Writing uncompressed PNG files only requires the CRC32 and Adler32 checksums: zlib 'stored' blocks hold up to 65535 bytes each.
+struct ImGui_ImplSoftware_PngWriter
+{
+    FILE*   File;
+    ImU32   Crc;
+    ImU32   Adler;
+    bool    Ok;
+
+    void WriteRaw(const void* data, size_t size)    { Ok &= (fwrite(data, 1, size, File) == size); }
+    void WriteU32(ImU32 v)                          { unsigned char b[4] = { (unsigned char)(v >> 24), (unsigned char)(v >> 16), (unsigned char)(v >> 8), (unsigned char)v }; Write(b, 4); }
+    void Write(const void* data, size_t size)
+    {
+        static ImU32 crc_table[256] = { 0 };
+        if (crc_table[1] == 0)
+            for (ImU32 n = 0; n < 256; n++)
+            {
+                ImU32 c = n;
+                for (int k = 0; k < 8; k++)
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : (c >> 1);
+                crc_table[n] = c;
+            }
+        const unsigned char* p = (const unsigned char*)data;
+        for (size_t n = 0; n < size; n++)
+            Crc = crc_table[(Crc ^ p[n]) & 0xFF] ^ (Crc >> 8);
+        WriteRaw(data, size);
+    }
+    void BeginChunk(const char* type, ImU32 size)   { unsigned char b[4] = { (unsigned char)(size >> 24), (unsigned char)(size >> 16), (unsigned char)(size >> 8), (unsigned char)size }; WriteRaw(b, 4); Crc = 0xFFFFFFFFu; Write(type, 4); }
+    void EndChunk()                                 { const ImU32 crc = Crc ^ 0xFFFFFFFFu; unsigned char b[4] = { (unsigned char)(crc >> 24), (unsigned char)(crc >> 16), (unsigned char)(crc >> 8), (unsigned char)crc }; WriteRaw(b, 4); }
+    void WriteImageData(const unsigned char* data, size_t size)  // Zlib stream data, also updating Adler32
+    {
+        ImU32 s1 = Adler & 0xFFFF, s2 = Adler >> 16;
+        for (size_t n = 0; n < size; n++)
+        {
+            s1 = (s1 + data[n]) % 65521;
+            s2 = (s2 + s1) % 65521;
+        }
+        Adler = (s2 << 16) | s1;
+        Write(data, size);
+    }
+};
+
+bool ImGui_ImplSoftware_SaveImagePNG(const char* filename, const unsigned char* pixels, int width, int height, int stride)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return false;
+    ImGui_ImplSoftware_PngWriter w;
+    w.File = f;
+    w.Crc = 0;
+    w.Adler = 1;
+    w.Ok = true;
+
+    static const unsigned char png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    w.WriteRaw(png_signature, 8);
+
+    // IHDR: 8-bit RGBA, no interlacing
+    w.BeginChunk("IHDR", 13);
+    w.WriteU32((ImU32)width);
+    w.WriteU32((ImU32)height);
+    static const unsigned char ihdr_tail[5] = { 8, 6, 0, 0, 0 };
+    w.Write(ihdr_tail, 5);
+    w.EndChunk();
+
+    // IDAT: zlib header, then each row (filter byte 0 + pixels) split into stored blocks, then Adler32
+    const size_t row_size = (size_t)width * 4 + 1;
+    const size_t raw_size = row_size * (size_t)height;
+    const size_t block_count = (raw_size + 65534) / 65535;
+    w.BeginChunk("IDAT", (ImU32)(2 + raw_size + block_count * 5 + 4));
+    static const unsigned char zlib_header[2] = { 0x78, 0x01 };
+    w.Write(zlib_header, 2);
+    size_t block_remaining = 0;
+    size_t raw_remaining = raw_size;
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char filter_type = 0;
+        const unsigned char* row = pixels + (size_t)y * stride;
+        for (size_t row_offset = 0; row_offset < row_size; )
+        {
+            if (block_remaining == 0)
+            {
+                block_remaining = (raw_remaining < 65535) ? raw_remaining : 65535;
+                const unsigned char block_header[5] = { (unsigned char)(block_remaining == raw_remaining ? 1 : 0), (unsigned char)block_remaining, (unsigned char)(block_remaining >> 8), (unsigned char)~block_remaining, (unsigned char)(~block_remaining >> 8) };
+                w.Write(block_header, 5);
+            }
+            size_t size = ImGui_ImplSoftware_Min(row_size - row_offset, block_remaining);
+            if (row_offset == 0)
+            {
+                w.WriteImageData(&filter_type, 1);
+                size--;
+                row_offset++;
+                block_remaining--;
+                raw_remaining--;
+            }
+            w.WriteImageData(row + row_offset - 1, size);
+            row_offset += size;
+            block_remaining -= size;
+            raw_remaining -= size;
+        }
+    }
+    w.WriteU32(w.Adler);
+    w.EndChunk();
+
+    w.BeginChunk("IEND", 0);
+    w.EndChunk();
+    return (fclose(f) == 0) && w.Ok;
+}
+
+#endif // #ifndef IMGUI_DISABLE
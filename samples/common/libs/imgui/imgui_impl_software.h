@@ -0,0 +1,38 @@
+// dear imgui: Renderer Backend for CPU rendering into a RGBA8 buffer (headless rendering, screenshots, thumbnails)
+// This needs to be used along with a Platform Backend, or with io.DisplaySize/io.DeltaTime set by yourself when running without a window.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftware_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded: the framebuffer is split in tiles, which are rasterized in parallel.
+
+// Output matches what GPU backends render with bilinear texture filtering and standard alpha blending:
+// - Triangles are sampled at pixel centers with a top-left fill rule (same as Direct3D and most OpenGL implementations).
+// - RGB = src.rgb * src.a + dst.rgb * (1 - src.a), A = src.a + dst.a * (1 - src.a).
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// RGBA8 texture, 4 bytes per pixel, rows are tightly packed. Pass a pointer to it as ImTextureID. Pixels are not copied.
+struct ImGui_ImplSoftware_Texture
+{
+    const unsigned char*    Pixels;
+    int                     Width;
+    int                     Height;
+
+    ImGui_ImplSoftware_Texture() { Pixels = NULL; Width = Height = 0; }
+};
+
+// Backend API
+IMGUI_IMPL_API bool     ImGui_ImplSoftware_Init(int thread_count = 0);   // 0: use all hardware threads. Worker threads are created here and kept until Shutdown().
+IMGUI_IMPL_API void     ImGui_ImplSoftware_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_RenderDrawData(ImDrawData* draw_data, unsigned char* pixels, int width, int height, int stride); // Blend into 'pixels' (RGBA8, 'stride' bytes per row), which you need to clear beforehand. Size is generally DisplaySize * FramebufferScale.
+
+// (Optional) Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftware_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_DestroyFontsTexture();
+
+// (Optional) Helpers to dump a RGBA8 buffer: binary PPM (RGB, alpha is dropped) or uncompressed PNG (RGBA)
+IMGUI_IMPL_API bool     ImGui_ImplSoftware_SaveImagePPM(const char* filename, const unsigned char* pixels, int width, int height, int stride);
+IMGUI_IMPL_API bool     ImGui_ImplSoftware_SaveImagePNG(const char* filename, const unsigned char* pixels, int width, int height, int stride);
@@ -53,6 +53,9 @@ Index of this file:
 #include <stdlib.h>     // NULL, malloc, free, qsort, atoi, atof
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // _InterlockedExchangeAdd
+#endif
 
 // Enable SSE intrinsics if available
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64) && !defined(IMGUI_DISABLE_SSE)
@@ -60,6 +63,12 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Enable NEON intrinsics if available (AArch64 only, as we use vdivq_f32)
+#if defined(__ARM_NEON) && defined(__aarch64__) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -113,6 +122,8 @@ Index of this file:
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
+struct ImDrawDataDamageTracker;     // Helper to compute ImDrawData::DamageRects[]
+struct ImGuiWindowRetainedDrawList; // Storage for ImGuiWindowFlags_RetainDrawList
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiContext;                // Main Dear ImGui context
@@ -139,6 +150,7 @@ struct ImGuiTableColumn;            // Storage for one column of a table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTextUndoState;          // Undo/redo history of the currently focused/edited text input box
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
@@ -174,6 +186,44 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // [SECTION] STB libraries includes
 //-------------------------------------------------------------------------
 
+// Undo/redo history for stb_textedit.h, replacing its fixed-size buffer (STB_TEXTEDIT_UNDOSTATECOUNT/STB_TEXTEDIT_UNDOCHARCOUNT).
+// Records and the characters they restore are stored on the heap, growing up to MemoryBudget bytes after which the oldest records are discarded.
+// The characters of a record are stored as a single span, copied in bulk from the edited text.
+struct ImGuiTextUndoRecord
+{
+    int                 Where;              // Position of the edit, in characters
+    int                 InsertLen;          // Number of characters to insert when applying the record, stored in the owning stack
+    int                 DeleteLen;          // Number of characters to delete when applying the record
+};
+
+struct IMGUI_API ImGuiTextUndoStack
+{
+    ImVector<ImGuiTextUndoRecord> Records;  // Oldest first
+    ImVector<ImWchar>   Chars;              // Characters inserted by Records[], in the same order. The last record owns the last InsertLen characters.
+    int                 RecordsBegin;       // Number of discarded records at the front of Records[] (compacted lazily)
+    int                 CharsBegin;         // Number of discarded characters at the front of Chars[] (compacted lazily)
+
+    ImGuiTextUndoStack()                    { RecordsBegin = CharsBegin = 0; }
+    void                Clear()             { Records.clear(); Chars.clear(); RecordsBegin = CharsBegin = 0; }
+    int                 GetCount() const    { return Records.Size - RecordsBegin; }
+    int                 GetMemoryUsed() const { return GetCount() * (int)sizeof(ImGuiTextUndoRecord) + (Chars.Size - CharsBegin) * (int)sizeof(ImWchar); }
+    const ImWchar*      GetTopChars() const { return Chars.Data + Chars.Size - Records.back().InsertLen; }
+    ImWchar*            Push(int where, int insert_len, int delete_len);    // Return storage for the insert_len characters of the new record
+    void                Pop();
+    void                DiscardOldest();
+};
+
+struct IMGUI_API ImGuiTextUndoState
+{
+    ImGuiTextUndoStack  UndoStack;
+    ImGuiTextUndoStack  RedoStack;
+    int                 MemoryBudget;       // Maximum memory used by both stacks, in bytes. Set from io.ConfigInputTextUndoMemory or ImGuiTextEditBuffer::UndoMemory while active.
+
+    ImGuiTextUndoState()                    { MemoryBudget = 0; }
+    void                ClearFreeMemory()   { UndoStack.Clear(); RedoStack.Clear(); }
+    int                 GetMemoryUsed() const { return UndoStack.GetMemoryUsed() + RedoStack.GetMemoryUsed(); }
+};
+
 namespace ImStb
 {
 
@@ -182,8 +232,7 @@ namespace ImStb
 #define STB_TEXTEDIT_STRING             ImGuiInputTextState
 #define STB_TEXTEDIT_CHARTYPE           ImWchar
 #define STB_TEXTEDIT_GETWIDTH_NEWLINE   (-1.0f)
-#define STB_TEXTEDIT_UNDOSTATECOUNT     99
-#define STB_TEXTEDIT_UNDOCHARCOUNT      999
+#define STB_TEXTEDIT_UNDOSTATE          ImGuiTextUndoState
 #include "imstb_textedit.h"
 
 } // namespace ImStb
@@ -251,6 +300,20 @@ namespace ImStb
 #define IM_MSVC_WARNING_SUPPRESS(XXXX)
 #endif
 
+// Atomics (for the few counters and flags which may be updated from worker threads building draw lists)
+// IM_ATOMIC_ADD is relaxed, IM_ATOMIC_LOAD has acquire semantic, IM_ATOMIC_STORE has release semantic.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define IM_ATOMIC_ADD(_PTR,_VAL)        _InterlockedExchangeAdd((volatile long*)(_PTR), (long)(_VAL))
+#define IM_ATOMIC_EXCHANGE(_PTR,_VAL)   _InterlockedExchange((volatile long*)(_PTR), (long)(_VAL))
+#define IM_ATOMIC_LOAD(_PTR)            _InterlockedOr((volatile long*)(_PTR), 0)
+#define IM_ATOMIC_STORE(_PTR,_VAL)      ((void)_InterlockedExchange((volatile long*)(_PTR), (long)(_VAL)))
+#else
+#define IM_ATOMIC_ADD(_PTR,_VAL)        __atomic_fetch_add((_PTR), (_VAL), __ATOMIC_RELAXED)
+#define IM_ATOMIC_EXCHANGE(_PTR,_VAL)   __atomic_exchange_n((_PTR), (_VAL), __ATOMIC_ACQ_REL)
+#define IM_ATOMIC_LOAD(_PTR)            __atomic_load_n((_PTR), __ATOMIC_ACQUIRE)
+#define IM_ATOMIC_STORE(_PTR,_VAL)      __atomic_store_n((_PTR), (_VAL), __ATOMIC_RELEASE)
+#endif
+
 // Debug Tools
 // Use 'Metrics/Debugger->Tools->Item Picker' to break into the call-stack of a specific item.
 // This will call IM_DEBUG_BREAK() which you may redefine yourself. See https://github.com/scottt/debugbreak for more reference.
@@ -296,6 +359,7 @@ namespace ImStb
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImU32 seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImU32 seed = 0);
+IMGUI_API ImGuiID       ImHashLiteral(const ImGuiLiteralID& str, ImU32 seed = 0);      // == ImHashStr(str.Str, 0, seed)
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 static inline ImGuiID   ImHash(const void* data, int size, ImU32 seed = 0) { return size ? ImHashData(data, (size_t)size, seed) : ImHashStr((const char*)data, 0, seed); } // [moved to ImHashStr/ImHashData in 1.68]
 #endif
@@ -343,6 +407,7 @@ IMGUI_API int           ImTextStrFromUtf8(ImWchar* out_buf, int out_buf_size, co
 IMGUI_API int           ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end);                                 // return number of UTF-8 code-points (NOT bytes count)
 IMGUI_API int           ImTextCountUtf8BytesFromChar(const char* in_text, const char* in_text_end);                             // return number of bytes to express one char in UTF-8
 IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end);                        // return number of bytes to express string in UTF-8
+IMGUI_API const char*   ImTextFindAsciiRunEnd(const char* in_text, const char* in_text_end);                                    // return first byte which is not printable ASCII (0x20..0x7F), or in_text_end
 
 // Helpers: ImVec2/ImVec4 operators
 // We are keeping those disabled by default so they don't leak in user space, to allow user enabling implicit cast operators between ImVec2 and their own types (using IM_VEC2_CLASS_EXTRA etc.)
@@ -729,6 +794,9 @@ struct IMGUI_API ImDrawListSharedData
     void SetCircleTessellationMaxError(float max_error);
 };
 
+// Reference for renderer backends supporting ImGuiBackendFlags_RendererHasSdfShapes: coverage (0.0f..1.0f) of an ImDrawQuad for the pixel centered on 'p'
+IMGUI_API float ImDrawQuadCalcCoverage(const ImDrawQuad& quad, const ImVec2& p, float fringe_width = 1.0f);
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>   Layers[2];           // Global layers for: regular, tooltip
@@ -739,6 +807,68 @@ struct ImDrawDataBuilder
     IMGUI_API void FlattenIntoSingleLayer();
 };
 
+// Size of the tiles used to track damage (in display units)
+#ifndef IM_DRAWDATA_DAMAGE_TILE_SIZE
+#define IM_DRAWDATA_DAMAGE_TILE_SIZE        32
+#endif
+
+// Helper to compute ImDrawData::DamageRects[] (when io.ConfigDrawDataDamageRects is set)
+// Triangles are hashed, in submission order, into every display tile they may touch. Tiles whose hash differs from last frame are merged into rectangles.
+struct ImDrawDataDamageTracker
+{
+    ImVector<ImU32>         TileHashes;         // Hash of current frame, per tile
+    ImVector<ImU32>         TileHashesPrev;     // Hash of previous frame, per tile
+    ImVector<ImVec4>        Rects;              // Output, pointed to by ImDrawData::DamageRects
+    int                     TilesX, TilesY;
+    int                     FrameCount;         // Number of calls to Update(), used to always damage areas rendered by user callbacks
+    ImVec2                  DisplayPos;         // Display area of previous frame: any change causes the whole display to be damaged
+    ImVec2                  DisplaySize;
+    ImVec2                  FramebufferScale;
+
+    ImDrawDataDamageTracker()   { TilesX = TilesY = FrameCount = 0; }
+    void Clear()                { TileHashes.resize(0); TileHashesPrev.resize(0); Rects.resize(0); TilesX = TilesY = 0; }
+    IMGUI_API void Update(ImDrawData* draw_data);
+};
+
+// State of a draw list when a primitive is submitted, recorded for ImGuiWindowFlags_RetainDrawList
+struct ImDrawListRetainPoint
+{
+    ImU32                   Fingerprint;        // Fingerprint including the parameters of the primitive
+    int                     CmdCount;           // Size of the buffers before the output of the primitive
+    int                     IdxCount;
+    int                     VtxCount;
+    int                     QuadCount;
+    ImDrawCmd               LastCmd;            // CmdBuffer[CmdCount - 1] before the output of the primitive
+};
+
+// Storage for windows using ImGuiWindowFlags_RetainDrawList
+// - On regular frames the window is tessellated as usual, and its output is copied here once two consecutive frames had the same fingerprint.
+// - Once stable, following frames only compute the fingerprint (ImDrawListFlags_FingerprintOnly), and compare it with Points[] each time a primitive
+//   is submitted. If all of them match, the retained output is copied back into the draw list. Otherwise tessellation resumes at the first
+//   difference, and the retained output up to that point is copied in front of the new output.
+struct ImGuiWindowRetainedDrawList
+{
+    ImVector<ImDrawCmd>     CmdBuffer;
+    ImVector<ImDrawIdx>     IdxBuffer;
+    ImVector<ImDrawVert>    VtxBuffer;
+    ImVector<ImDrawQuad>    QuadBuffer;
+    ImVector<ImDrawListRetainPoint> Points;     // Recorded while building the retained output
+    ImVector<ImDrawListRetainPoint> PointsNext; // Recorded this frame
+    ImU32                   Fingerprint;        // Fingerprint of last frame submissions
+    int                     PointsMatched;      // Number of Points[] matched this frame, when only computing the fingerprint
+    int                     ResumePoint;        // Index into Points[] where tessellation resumed this frame, or -1
+    bool                    PointsStopped;      // Stop recording PointsNext[] (following output can't be copied from the retained output)
+    bool                    Valid;              // Buffers hold the output matching Fingerprint
+    bool                    Stable;             // Last two frames had the same fingerprint
+    bool                    FingerprintOnly;    // Current frame is only computing the fingerprint
+    int                     HitCount;           // Number of frames which reused the retained output (for debugging)
+    int                     MissCount;          // Number of frames which were tessellated (for debugging)
+
+    ImGuiWindowRetainedDrawList()   { Fingerprint = 0; PointsMatched = 0; ResumePoint = -1; PointsStopped = Valid = Stable = FingerprintOnly = false; HitCount = MissCount = 0; }
+    void ClearFreeMemory()          { CmdBuffer.clear(); IdxBuffer.clear(); VtxBuffer.clear(); QuadBuffer.clear(); Points.clear(); PointsNext.clear(); Valid = Stable = false; }
+    IMGUI_API void RestoreOutput(ImDrawList* draw_list);
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Widgets support: flags, enums, data structures
 //-----------------------------------------------------------------------------
@@ -1000,6 +1130,7 @@ struct IMGUI_API ImGuiInputTextState
     ImVector<ImWchar>       TextW;                  // edit buffer, we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer.
     ImVector<char>          TextA;                  // temporary UTF8 buffer for callbacks and other operations. this is not updated in every code-path! size=capacity.
     ImVector<char>          InitialTextA;           // backup of end-user buffer at the time of focus (in UTF-8, unaltered)
+    ImGuiTextEditBuffer*    EditBuffer;             // end-user edit buffer, edited in place instead of TextW (InputTextMultiline() with an ImGuiTextEditBuffer). Only valid while active.
     bool                    TextAIsValid;           // temporary UTF8 buffer is not initially valid before we make the widget active (until then we pull the data from user argument)
     int                     BufCapacityA;           // end-user buffer capacity
     float                   ScrollX;                // horizontal scrolling/offset
@@ -1012,9 +1143,9 @@ struct IMGUI_API ImGuiInputTextState
 
     ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
     void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
-    int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
-    int         GetRedoAvailCount() const   { return STB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
+    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); Stb.undostate.ClearFreeMemory(); }
+    int         GetUndoAvailCount() const   { return Stb.undostate.UndoStack.GetCount(); }
+    int         GetRedoAvailCount() const   { return Stb.undostate.RedoStack.GetCount(); }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
 
     // Cursor & Selection
@@ -1423,6 +1554,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         DrawLists[2];           // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;
+    ImDrawDataDamageTracker DrawDataDamage;     // Damaged areas of DrawDataP since last frame, when io.ConfigDrawDataDamageRects is set
 
     ImVec2              WorkOffsetMin;          // Work Area: Offset from Pos to top-left corner of Work Area. Generally (0,0) or (0,+main_menu_bar_height). Work Area is Full Area but without menu-bars/status-bars (so WorkArea always fit inside Pos/Size!)
     ImVec2              WorkOffsetMax;          // Work Area: Offset from Pos+Size to bottom-right corner of Work Area. Generally (0,0) or (0,-status_bar_height).
@@ -1793,6 +1925,8 @@ struct ImGuiContext
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this ID
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiStackTool          DebugStackTool;
+    int                     DebugRetainedDrawListHits;          // Number of windows which reused their retained draw output this frame (ImGuiWindowFlags_RetainDrawList)
+    int                     DebugRetainedDrawListMisses;        // Number of windows using ImGuiWindowFlags_RetainDrawList which were tessellated this frame
 
     // Misc
     float                   FramerateSecPerFrame[120];          // Calculate estimate of framerate for user over the last 2 seconds.
@@ -1945,6 +2079,7 @@ struct ImGuiContext
 
         DebugItemPickerActive = false;
         DebugItemPickerBreakId = 0;
+        DebugRetainedDrawListHits = DebugRetainedDrawListMisses = 0;
 
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
@@ -2088,6 +2223,7 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImGuiWindowRetainedDrawList RetainedDrawList;               // Previous output, when using ImGuiWindowFlags_RetainDrawList
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup _or_ docked window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            ParentWindowInBeginStack;
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window. Doesn't cross through popups/dock nodes.
@@ -2110,9 +2246,11 @@ public:
     ImGuiID     GetID(const char* str, const char* str_end = NULL);
     ImGuiID     GetID(const void* ptr);
     ImGuiID     GetID(int n);
+    ImGuiID     GetID(const ImGuiLiteralID& str);
     ImGuiID     GetIDNoKeepAlive(const char* str, const char* str_end = NULL);
     ImGuiID     GetIDNoKeepAlive(const void* ptr);
     ImGuiID     GetIDNoKeepAlive(int n);
+    ImGuiID     GetIDNoKeepAlive(const ImGuiLiteralID& str);
     ImGuiID     GetIDFromRectangle(const ImRect& r_abs);
 
     // We don't use g.FontSize because the window may be != g.CurrentWidow.
@@ -2779,6 +2917,7 @@ namespace ImGui
     // Widgets
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
     IMGUI_API bool          ButtonEx(const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
+    IMGUI_API bool          ButtonEx(ImGuiID id, const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags);
     IMGUI_API bool          CloseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          CollapseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          ArrowButtonEx(const char* str_id, ImGuiDir dir, ImVec2 size_arg, ImGuiButtonFlags flags = 0);
@@ -2821,7 +2960,7 @@ namespace ImGui
     IMGUI_API bool          DataTypeClamp(ImGuiDataType data_type, void* p_data, const void* p_min, const void* p_max);
 
     // InputText
-    IMGUI_API bool          InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
+    IMGUI_API bool          InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback = NULL, void* user_data = NULL, ImGuiTextEditBuffer* edit_buf = NULL);
     IMGUI_API bool          TempInputText(const ImRect& bb, ImGuiID id, const char* label, char* buf, int buf_size, ImGuiInputTextFlags flags);
     IMGUI_API bool          TempInputScalar(const ImRect& bb, ImGuiID id, const char* label, ImGuiDataType data_type, void* p_data, const char* format, const void* p_clamp_min = NULL, const void* p_clamp_max = NULL);
     inline bool             TempInputIsActive(ImGuiID id)       { ImGuiContext& g = *GImGui; return (g.ActiveId == id && g.TempInputId == id); }
@@ -2888,11 +3027,19 @@ IMGUI_API void      ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
 IMGUI_API void      ImFontAtlasBuildFinish(ImFontAtlas* atlas);
+IMGUI_API void      ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas);     // Called by NewFrame(): evict least recently used glyphs when running out of room (ImFontAtlasFlags_DynamicGlyphs)
+IMGUI_API void      ImFontAtlasUpdateTextSizeCaches(ImFontAtlas* atlas);    // Called by NewFrame(): start a new frame and evict old entries of enabled ImFont::TextSizeCache
 IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// Reference for renderer backends supporting ImGuiBackendFlags_RendererHasSdfText: coverage (0.0f..1.0f) of a pixel sampling a signed distance field glyph
+IMGUI_API float     ImFontSdfCalcCoverage(float sdf_value, float sdf_spread, float texels_per_pixel);
+
+// Fill ImFont::AsciiGlyphs[] from IndexLookup[] and FallbackGlyph. Called by BuildLookupTable(), AddRemapChar() and LoadBakedCache().
+IMGUI_API void      ImFontBuildAsciiGlyphs(ImFont* font);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
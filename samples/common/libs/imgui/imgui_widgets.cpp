@@ -15,6 +15,7 @@ Index of this file:
 // [SECTION] Widgets: SliderScalar, SliderFloat, SliderInt, etc.
 // [SECTION] Widgets: InputScalar, InputFloat, InputInt, etc.
 // [SECTION] Widgets: InputText, InputTextMultiline
+// [SECTION] Widgets: TextView
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 // [SECTION] Widgets: TreeNode, CollapsingHeader, etc.
 // [SECTION] Widgets: Selectable
@@ -668,6 +669,15 @@ bool ImGui::ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool
 }
 
 bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(window->GetID(label), label, size_arg, flags);
+}
+
+// Same as above with an ID computed by the caller (e.g. from an ImGuiLiteralID)
+bool ImGui::ButtonEx(ImGuiID id, const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -675,7 +685,6 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
     const ImVec2 label_size = CalcTextSize(label, NULL, true);
 
     ImVec2 pos = window->DC.CursorPos;
@@ -716,6 +725,14 @@ bool ImGui::Button(const char* label, const ImVec2& size_arg)
     return ButtonEx(label, size_arg, ImGuiButtonFlags_None);
 }
 
+bool ImGui::Button(const ImGuiLiteralID& label, const ImVec2& size_arg)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(window->GetID(label), label.Str, size_arg, ImGuiButtonFlags_None);
+}
+
 // Small buttons fits within text without additional vertical spacing.
 bool ImGui::SmallButton(const char* label)
 {
@@ -3532,6 +3549,8 @@ bool ImGui::InputDouble(const char* label, double* v, double step, double step_f
 // - InputText()
 // - InputTextWithHint()
 // - InputTextMultiline()
+// - ImGuiTextEditBuffer [Helper]
+// - ImGuiTextUndoStack [Internal]
 // - InputTextEx() [Internal]
 //-------------------------------------------------------------------------
 
@@ -3546,6 +3565,12 @@ bool ImGui::InputTextMultiline(const char* label, char* buf, size_t buf_size, co
     return InputTextEx(label, NULL, buf, (int)buf_size, size, flags | ImGuiInputTextFlags_Multiline, callback, user_data);
 }
 
+bool ImGui::InputTextMultiline(const char* label, ImGuiTextEditBuffer* buffer, const ImVec2& size, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data)
+{
+    IM_ASSERT(buffer != NULL);
+    return InputTextEx(label, NULL, NULL, 0, size, flags | ImGuiInputTextFlags_Multiline, callback, user_data, buffer);
+}
+
 bool ImGui::InputTextWithHint(const char* label, const char* hint, char* buf, size_t buf_size, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data)
 {
     IM_ASSERT(!(flags & ImGuiInputTextFlags_Multiline)); // call InputTextMultiline()
@@ -3611,17 +3636,285 @@ static ImVec2 InputTextCalcTextSizeW(const ImWchar* text_begin, const ImWchar* t
     return text_size;
 }
 
+void ImGuiTextEditBuffer::SetText(const char* text, const char* text_end)
+{
+    Clear();
+    const int text_len = ImTextCountCharsFromUtf8(text, text_end);
+    Buf.resize(text_len + 1); // +1 for the zero-terminator written by ImTextStrFromUtf8(), which becomes the gap
+    ImTextStrFromUtf8(Buf.Data, Buf.Size, text, text_end);
+    GapBegin = text_len;
+    GapEnd = Buf.Size;
+    TextSizeA = ImTextCountUtf8BytesFromStr(Buf.Data, Buf.Data + text_len);
+    for (int n = 0; n < text_len; n++)
+        if (Buf.Data[n] == '\n')
+            LineBreaks.push_back(n);
+    LineGapBegin = LineGapEnd = LineBreaks.Size;
+}
+
+int ImGuiTextEditBuffer::GetText(char* buf, int buf_size, int pos_begin, int pos_end) const
+{
+    IM_ASSERT(buf != NULL && buf_size > 0);
+    if (pos_end < 0)
+        pos_end = GetLength();
+    IM_ASSERT(pos_begin >= 0 && pos_begin <= pos_end && pos_end <= GetLength());
+    const int gap_size = GapEnd - GapBegin;
+    int written = 0;
+    buf[0] = 0;
+    if (pos_begin < GapBegin)
+        written += ImTextStrToUtf8(buf, buf_size, Buf.Data + pos_begin, Buf.Data + ImMin(pos_end, GapBegin));
+    if (pos_end > GapBegin)
+        written += ImTextStrToUtf8(buf + written, buf_size - written, Buf.Data + ImMax(pos_begin, GapBegin) + gap_size, Buf.Data + pos_end + gap_size);
+    return written;
+}
+
+int ImGuiTextEditBuffer::GetTextSizeA(int pos_begin, int pos_end) const
+{
+    if (pos_begin == 0 && (pos_end < 0 || pos_end == GetLength()))
+        return TextSizeA;
+    IM_ASSERT(pos_begin >= 0 && pos_begin <= pos_end && pos_end <= GetLength());
+    const int gap_size = GapEnd - GapBegin;
+    int size = 0;
+    if (pos_begin < GapBegin)
+        size += ImTextCountUtf8BytesFromStr(Buf.Data + pos_begin, Buf.Data + ImMin(pos_end, GapBegin));
+    if (pos_end > GapBegin)
+        size += ImTextCountUtf8BytesFromStr(Buf.Data + ImMax(pos_begin, GapBegin) + gap_size, Buf.Data + pos_end + gap_size);
+    return size;
+}
+
+// Binary search the number of line breaks before 'pos'
+int ImGuiTextEditBuffer::GetLineFromPos(int pos) const
+{
+    int count = GetLineCount() - 1;
+    int first = 0;
+    while (count > 0)
+    {
+        const int step = count >> 1;
+        if (GetLineBreak(first + step) < pos)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first;
+}
+
+// Move the gap to 'pos' and make sure it can hold 'min_gap_size' characters.
+// Line breaks crossing the gap are converted between positions (before the gap) and distances to the end of the text (after the gap).
+void ImGuiTextEditBuffer::MoveGap(int pos, int min_gap_size)
+{
+    const int text_len = GetLength();
+    IM_ASSERT(pos >= 0 && pos <= text_len);
+    if (GapEnd - GapBegin < min_gap_size)
+    {
+        const int after_len = Buf.Size - GapEnd;
+        const int new_size = ImMax(text_len + min_gap_size, Buf.Size + Buf.Size / 2 + 16);
+        Buf.resize(new_size);
+        memmove(Buf.Data + new_size - after_len, Buf.Data + GapEnd, (size_t)after_len * sizeof(ImWchar));
+        GapEnd = new_size - after_len;
+    }
+    if (pos < GapBegin)
+    {
+        const int n = GapBegin - pos;
+        memmove(Buf.Data + GapEnd - n, Buf.Data + pos, (size_t)n * sizeof(ImWchar));
+        GapBegin -= n;
+        GapEnd -= n;
+        while (LineGapBegin > 0 && LineBreaks.Data[LineGapBegin - 1] >= pos)
+            LineBreaks.Data[--LineGapEnd] = text_len - LineBreaks.Data[--LineGapBegin];
+    }
+    else if (pos > GapBegin)
+    {
+        const int n = pos - GapBegin;
+        memmove(Buf.Data + GapBegin, Buf.Data + GapEnd, (size_t)n * sizeof(ImWchar));
+        GapBegin += n;
+        GapEnd += n;
+        while (LineGapEnd < LineBreaks.Size && text_len - LineBreaks.Data[LineGapEnd] < pos)
+            LineBreaks.Data[LineGapBegin++] = text_len - LineBreaks.Data[LineGapEnd++];
+    }
+}
+
+void ImGuiTextEditBuffer::Insert(int pos, const ImWchar* text, int text_len)
+{
+    IM_ASSERT(text_len >= 0);
+    if (text_len == 0)
+        return;
+    MoveGap(pos, text_len);
+
+    int new_line_count = 0;
+    for (int n = 0; n < text_len; n++)
+        if (text[n] == '\n')
+            new_line_count++;
+    if (LineGapEnd - LineGapBegin < new_line_count)
+    {
+        const int after_count = LineBreaks.Size - LineGapEnd;
+        const int new_size = ImMax(LineBreaks.Size + new_line_count, LineBreaks.Size + LineBreaks.Size / 2 + 16);
+        LineBreaks.resize(new_size);
+        memmove(LineBreaks.Data + new_size - after_count, LineBreaks.Data + LineGapEnd, (size_t)after_count * sizeof(int));
+        LineGapEnd = new_size - after_count;
+    }
+
+    for (int n = 0; n < text_len; n++)
+    {
+        if (text[n] == '\n')
+            LineBreaks.Data[LineGapBegin++] = GapBegin;
+        Buf.Data[GapBegin++] = text[n];
+    }
+    TextSizeA += ImTextCountUtf8BytesFromStr(text, text + text_len);
+}
+
+void ImGuiTextEditBuffer::Insert(int pos, const char* text, const char* text_end)
+{
+    ImVector<ImWchar> text_w;
+    text_w.resize(ImTextCountCharsFromUtf8(text, text_end) + 1);
+    const int text_len = ImTextStrFromUtf8(text_w.Data, text_w.Size, text, text_end);
+    Insert(pos, text_w.Data, text_len);
+}
+
+void ImGuiTextEditBuffer::Delete(int pos, int count)
+{
+    IM_ASSERT(count >= 0 && pos + count <= GetLength());
+    if (count == 0)
+        return;
+    MoveGap(pos, 0);
+    const int text_len = GetLength();
+    while (LineGapEnd < LineBreaks.Size && text_len - LineBreaks.Data[LineGapEnd] < pos + count)
+        LineGapEnd++;
+    TextSizeA -= ImTextCountUtf8BytesFromStr(Buf.Data + GapEnd, Buf.Data + GapEnd + count);
+    GapEnd += count;
+}
+
+// Width of [pos_begin, pos_end) in an ImGuiTextEditBuffer, which must not contain a line break. Same as InputTextCalcTextSizeW().x.
+static float InputTextCalcEditBufferWidth(const ImGuiTextEditBuffer* edit_buf, int pos_begin, int pos_end)
+{
+    ImGuiContext& g = *GImGui;
+    const float scale = g.FontSize / g.Font->FontSize;
+    float width = 0.0f;
+    for (int pos = pos_begin; pos < pos_end; pos++)
+    {
+        const ImWchar c = edit_buf->GetChar(pos);
+        if (c != '\r')
+            width += g.Font->GetCharAdvance(c) * scale;
+    }
+    return width;
+}
+
+// Render the lines of an ImGuiTextEditBuffer which are visible in the current window. 'pos' is the top-left corner of the first line.
+static void InputTextRenderEditBuffer(ImGuiTextEditBuffer* edit_buf, const ImVec2& pos, ImU32 col)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    const int line_count = edit_buf->GetLineCount();
+    const int line_min = ImClamp((int)ImFloor((window->ClipRect.Min.y - pos.y) / g.FontSize), 0, line_count - 1);
+    const int line_max = ImClamp((int)ImCeil((window->ClipRect.Max.y - pos.y) / g.FontSize), line_min + 1, line_count);
+    const int text_begin = edit_buf->GetLineStart(line_min);
+    const int text_end = (line_max < line_count) ? edit_buf->GetLineStart(line_max) : edit_buf->GetLength();
+    edit_buf->DisplayBuf.resize(edit_buf->GetTextSizeA(text_begin, text_end) + 1);
+    const int display_len = edit_buf->GetText(edit_buf->DisplayBuf.Data, edit_buf->DisplayBuf.Size, text_begin, text_end);
+    window->DrawList->AddText(g.Font, g.FontSize, ImVec2(pos.x, pos.y + line_min * g.FontSize), col, edit_buf->DisplayBuf.Data, edit_buf->DisplayBuf.Data + display_len);
+}
+
+ImWchar* ImGuiTextUndoStack::Push(int where, int insert_len, int delete_len)
+{
+    ImGuiTextUndoRecord rec;
+    rec.Where = where;
+    rec.InsertLen = insert_len;
+    rec.DeleteLen = delete_len;
+    Records.push_back(rec);
+    Chars.resize(Chars.Size + insert_len);
+    return Chars.Data + Chars.Size - insert_len;
+}
+
+void ImGuiTextUndoStack::Pop()
+{
+    IM_ASSERT(GetCount() > 0);
+    Chars.resize(Chars.Size - Records.back().InsertLen);
+    Records.pop_back();
+    if (Records.Size == RecordsBegin)
+    {
+        Records.resize(0);
+        Chars.resize(0);
+        RecordsBegin = CharsBegin = 0;
+    }
+}
+
+// Discarded entries are erased once they make half of the buffers, so discarding many records moves each remaining entry at most once on average.
+void ImGuiTextUndoStack::DiscardOldest()
+{
+    IM_ASSERT(GetCount() > 0);
+    CharsBegin += Records[RecordsBegin].InsertLen;
+    RecordsBegin++;
+    if (Records.Size == RecordsBegin)
+    {
+        Records.resize(0);
+        Chars.resize(0);
+        RecordsBegin = CharsBegin = 0;
+        return;
+    }
+    if (RecordsBegin * 2 >= Records.Size)
+    {
+        Records.erase(Records.Data, Records.Data + RecordsBegin);
+        RecordsBegin = 0;
+    }
+    if (CharsBegin > 0 && CharsBegin * 2 >= Chars.Size)
+    {
+        Chars.erase(Chars.Data, Chars.Data + CharsBegin);
+        CharsBegin = 0;
+    }
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
+// When editing an ImGuiTextEditBuffer (obj->EditBuffer != NULL), the text is read and modified in that buffer instead of TextW[].
 namespace ImStb
 {
 
 static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)                             { return obj->CurLenW; }
-static ImWchar STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { return obj->TextW[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->TextW[line_start_idx + char_idx]; if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *GImGui; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
+static ImWchar STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { return obj->EditBuffer ? obj->EditBuffer->GetChar(idx) : obj->TextW[idx]; }
+static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { ImWchar c = STB_TEXTEDIT_GETCHAR(obj, line_start_idx + char_idx); if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *GImGui; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
 static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x200000 ? 0 : key; }
+
+// Copy characters [pos, pos + n) of the text, in bulk (used to store undo records)
+static void    InputTextGetChars(const ImGuiInputTextState* obj, int pos, int n, ImWchar* dst)
+{
+    if (n <= 0)
+        return;
+    if (const ImGuiTextEditBuffer* edit_buf = obj->EditBuffer)
+    {
+        const int n_before_gap = ImClamp(edit_buf->GapBegin - pos, 0, n);
+        memcpy(dst, edit_buf->Buf.Data + pos, (size_t)n_before_gap * sizeof(ImWchar));
+        memcpy(dst + n_before_gap, edit_buf->Buf.Data + pos + n_before_gap + (edit_buf->GapEnd - edit_buf->GapBegin), (size_t)(n - n_before_gap) * sizeof(ImWchar));
+        return;
+    }
+    memcpy(dst, obj->TextW.Data + pos, (size_t)n * sizeof(ImWchar));
+}
 static ImWchar STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* obj, int line_start_idx)
 {
+    if (const ImGuiTextEditBuffer* edit_buf = obj->EditBuffer)
+    {
+        // Same as InputTextCalcTextSizeW() with stop_on_new_line, reading from the gap buffer
+        ImGuiContext& g = *GImGui;
+        const float scale = g.FontSize / g.Font->FontSize;
+        float line_width = 0.0f;
+        int idx = line_start_idx;
+        while (idx < obj->CurLenW)
+        {
+            const ImWchar c = edit_buf->GetChar(idx++);
+            if (c == '\n')
+                break;
+            if (c != '\r')
+                line_width += g.Font->GetCharAdvance(c) * scale;
+        }
+        r->x0 = 0.0f;
+        r->x1 = line_width;
+        r->baseline_y_delta = r->ymax = g.FontSize;
+        r->ymin = 0.0f;
+        r->num_chars = idx - line_start_idx;
+        return;
+    }
+
     const ImWchar* text = obj->TextW.Data;
     const ImWchar* text_remaining = NULL;
     const ImVec2 size = InputTextCalcTextSizeW(text + line_start_idx, text + obj->CurLenW, &text_remaining, NULL, true);
@@ -3635,8 +3928,8 @@ static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* ob
 
 // When ImGuiInputTextFlags_Password is set, we don't want actions such as CTRL+Arrow to leak the fact that underlying data are blanks or separators.
 static bool is_separator(unsigned int c)                                        { return ImCharIsBlankW(c) || c==',' || c==';' || c=='(' || c==')' || c=='{' || c=='}' || c=='[' || c==']' || c=='|' || c=='\n' || c=='\r'; }
-static int  is_word_boundary_from_right(ImGuiInputTextState* obj, int idx)      { if (obj->Flags & ImGuiInputTextFlags_Password) return 0; return idx > 0 ? (is_separator(obj->TextW[idx - 1]) && !is_separator(obj->TextW[idx]) ) : 1; }
-static int  is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)       { if (obj->Flags & ImGuiInputTextFlags_Password) return 0; return idx > 0 ? (!is_separator(obj->TextW[idx - 1]) && is_separator(obj->TextW[idx])) : 1; }
+static int  is_word_boundary_from_right(ImGuiInputTextState* obj, int idx)      { if (obj->Flags & ImGuiInputTextFlags_Password) return 0; return idx > 0 ? (is_separator(STB_TEXTEDIT_GETCHAR(obj, idx - 1)) && !is_separator(STB_TEXTEDIT_GETCHAR(obj, idx)) ) : 1; }
+static int  is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)       { if (obj->Flags & ImGuiInputTextFlags_Password) return 0; return idx > 0 ? (!is_separator(STB_TEXTEDIT_GETCHAR(obj, idx - 1)) && is_separator(STB_TEXTEDIT_GETCHAR(obj, idx))) : 1; }
 static int  STB_TEXTEDIT_MOVEWORDLEFT_IMPL(ImGuiInputTextState* obj, int idx)   { idx--; while (idx >= 0 && !is_word_boundary_from_right(obj, idx)) idx--; return idx < 0 ? 0 : idx; }
 static int  STB_TEXTEDIT_MOVEWORDRIGHT_MAC(ImGuiInputTextState* obj, int idx)   { idx++; int len = obj->CurLenW; while (idx < len && !is_word_boundary_from_left(obj, idx)) idx++; return idx > len ? len : idx; }
 #define STB_TEXTEDIT_MOVEWORDLEFT   STB_TEXTEDIT_MOVEWORDLEFT_IMPL    // They need to be #define for stb_textedit.h
@@ -3647,8 +3940,42 @@ static int  STB_TEXTEDIT_MOVEWORDRIGHT_WIN(ImGuiInputTextState* obj, int idx)
 #define STB_TEXTEDIT_MOVEWORDRIGHT  STB_TEXTEDIT_MOVEWORDRIGHT_WIN
 #endif
 
+// With an ImGuiTextEditBuffer every row is one line of FontSize height, so rows can be located from the line index without laying out the rows before them.
+// Otherwise return 0 to let stb_textedit.h scan from the first row.
+static int STB_TEXTEDIT_FINDROW_FROM_Y_IMPL(ImGuiInputTextState* obj, float y, float* out_row_y)
+{
+    const ImGuiTextEditBuffer* edit_buf = obj->EditBuffer;
+    if (edit_buf == NULL)
+        return 0;
+    const float line_height = GImGui->FontSize;
+    const int line = ImClamp((int)(y / line_height), 0, edit_buf->GetLineCount() - 1);
+    *out_row_y = line * line_height;
+    return edit_buf->GetLineStart(line);
+}
+static int STB_TEXTEDIT_FINDROW_FROM_CHAR_IMPL(ImGuiInputTextState* obj, int idx, int* out_prev_row_start, float* out_row_y)
+{
+    const ImGuiTextEditBuffer* edit_buf = obj->EditBuffer;
+    if (edit_buf == NULL)
+        return 0;
+    const int line = edit_buf->GetLineFromPos(idx);
+    *out_prev_row_start = line > 0 ? edit_buf->GetLineStart(line - 1) : 0;
+    *out_row_y = line * GImGui->FontSize;
+    return edit_buf->GetLineStart(line);
+}
+#define STB_TEXTEDIT_FINDROW_FROM_Y     STB_TEXTEDIT_FINDROW_FROM_Y_IMPL
+#define STB_TEXTEDIT_FINDROW_FROM_CHAR  STB_TEXTEDIT_FINDROW_FROM_CHAR_IMPL
+
 static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
+    if (ImGuiTextEditBuffer* edit_buf = obj->EditBuffer)
+    {
+        edit_buf->Delete(pos, n);
+        obj->Edited = true;
+        obj->CurLenA = edit_buf->TextSizeA;
+        obj->CurLenW = edit_buf->GetLength();
+        return;
+    }
+
     ImWchar* dst = obj->TextW.Data + pos;
 
     // We maintain our buffer length in both UTF-8 and wchar formats
@@ -3665,6 +3992,15 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ImWchar* new_text, int new_text_len)
 {
+    if (ImGuiTextEditBuffer* edit_buf = obj->EditBuffer)
+    {
+        edit_buf->Insert(pos, new_text, new_text_len);
+        obj->Edited = true;
+        obj->CurLenA = edit_buf->TextSizeA;
+        obj->CurLenW = edit_buf->GetLength();
+        return true;
+    }
+
     const bool is_resizable = (obj->Flags & ImGuiInputTextFlags_CallbackResize) != 0;
     const int text_len = obj->CurLenW;
     IM_ASSERT(pos <= text_len);
@@ -3717,6 +4053,88 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const Im
 #define STB_TEXTEDIT_IMPLEMENTATION
 #include "imstb_textedit.h"
 
+// Undo processing, on the growable ImGuiTextUndoState (see STB_TEXTEDIT_UNDOSTATE)
+// The undo and redo stacks share the memory budget: when going over it we discard the oldest records of 'stack', then the oldest records of 'other'
+// (keeping at least 'other_keep' of them). 'size' is the net amount of bytes about to be added. Return false if it still doesn't fit.
+static bool stb_text_undo_makeroom(ImGuiTextUndoState* s, ImGuiTextUndoStack* stack, ImGuiTextUndoStack* other, int size, int other_keep)
+{
+    while (stack->GetCount() > 0 && s->GetMemoryUsed() + size > s->MemoryBudget)
+        stack->DiscardOldest();
+    while (other->GetCount() > other_keep && s->GetMemoryUsed() + size > s->MemoryBudget)
+        other->DiscardOldest();
+    return s->GetMemoryUsed() + size <= s->MemoryBudget;
+}
+
+static ImWchar* stb_text_createundo(ImGuiTextUndoState* s, int where, int insert_len, int delete_len)
+{
+    // any time we create a new undo record, we discard redo
+    s->RedoStack.Clear();
+
+    // if the record can't possibly fit in the budget, we can't undo past it
+    if (!stb_text_undo_makeroom(s, &s->UndoStack, &s->RedoStack, (int)sizeof(ImGuiTextUndoRecord) + insert_len * (int)sizeof(ImWchar), 0))
+    {
+        s->UndoStack.Clear();
+        return NULL;
+    }
+    return s->UndoStack.Push(where, insert_len, delete_len);
+}
+
+static void stb_text_makeundo_insert(STB_TexteditState* state, int where, int length)
+{
+    stb_text_createundo(&state->undostate, where, 0, length);
+}
+
+static void stb_text_makeundo_delete(ImGuiInputTextState* str, STB_TexteditState* state, int where, int length)
+{
+    if (ImWchar* p = stb_text_createundo(&state->undostate, where, length, 0))
+        InputTextGetChars(str, where, length, p);
+}
+
+static void stb_text_makeundo_replace(ImGuiInputTextState* str, STB_TexteditState* state, int where, int old_length, int new_length)
+{
+    if (ImWchar* p = stb_text_createundo(&state->undostate, where, old_length, new_length))
+        InputTextGetChars(str, where, old_length, p);
+}
+
+// Apply the top record of 'src' and create the reverse record on top of 'dst'. The characters deleted by the record are stored in the reverse record.
+static void stb_text_undo_apply(ImGuiInputTextState* str, STB_TexteditState* state, ImGuiTextUndoStack* src, ImGuiTextUndoStack* dst)
+{
+    ImGuiTextUndoState* s = &state->undostate;
+    const ImGuiTextUndoRecord r = src->Records.back();
+    const int src_size = (int)sizeof(ImGuiTextUndoRecord) + r.InsertLen * (int)sizeof(ImWchar);
+    const int dst_size = (int)sizeof(ImGuiTextUndoRecord) + r.DeleteLen * (int)sizeof(ImWchar);
+    if (stb_text_undo_makeroom(s, dst, src, dst_size - src_size, 1))
+        InputTextGetChars(str, r.Where, r.DeleteLen, dst->Push(r.Where, r.DeleteLen, r.InsertLen));
+    else
+        dst->Clear(); // the reverse record can't fit in the budget
+
+    if (r.DeleteLen)
+        STB_TEXTEDIT_DELETECHARS(str, r.Where, r.DeleteLen);
+    if (r.InsertLen)
+        STB_TEXTEDIT_INSERTCHARS(str, r.Where, src->GetTopChars(), r.InsertLen);
+    src->Pop();
+    state->cursor = r.Where + r.InsertLen;
+}
+
+static void stb_text_undo(ImGuiInputTextState* str, STB_TexteditState* state)
+{
+    ImGuiTextUndoState* s = &state->undostate;
+    if (s->UndoStack.GetCount() > 0)
+        stb_text_undo_apply(str, state, &s->UndoStack, &s->RedoStack);
+}
+
+static void stb_text_redo(ImGuiInputTextState* str, STB_TexteditState* state)
+{
+    ImGuiTextUndoState* s = &state->undostate;
+    if (s->RedoStack.GetCount() > 0)
+        stb_text_undo_apply(str, state, &s->RedoStack, &s->UndoStack);
+}
+
+static void stb_text_clearundo(STB_TexteditState* state)
+{
+    state->undostate.ClearFreeMemory();
+}
+
 // stb_textedit internally allows for a single undo record to do addition and deletion, but somehow, calling
 // the stb_textedit_paste() function creates two separate records, so we perform it manually. (FIXME: Report to nothings/stb?)
 static void stb_textedit_replace(ImGuiInputTextState* str, STB_TexteditState* state, const STB_TEXTEDIT_CHARTYPE* text, int text_len)
@@ -3898,13 +4316,13 @@ static bool InputTextFilterCharacter(unsigned int* p_char, ImGuiInputTextFlags f
 // - If you want to use ImGui::InputText() with std::string, see misc/cpp/imgui_stdlib.h
 // (FIXME: Rather confusing and messy function, among the worse part of our codebase, expecting to rewrite a V2 at some point.. Partly because we are
 //  doing UTF8 > U16 > UTF8 conversions on the go to easily interface with stb_textedit. Ideally should stay in UTF-8 all the time. See https://github.com/nothings/stb/issues/188)
-bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
+bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data, ImGuiTextEditBuffer* edit_buf)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
 
-    IM_ASSERT(buf != NULL && buf_size >= 0);
+    IM_ASSERT((buf != NULL && buf_size >= 0) || edit_buf != NULL);
     IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackHistory) && (flags & ImGuiInputTextFlags_Multiline)));        // Can't use both together (they both use up/down keys)
     IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackCompletion) && (flags & ImGuiInputTextFlags_AllowTabInput))); // Can't use both together (they both use tab key)
 
@@ -3920,6 +4338,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     const bool is_resizable = (flags & ImGuiInputTextFlags_CallbackResize) != 0;
     if (is_resizable)
         IM_ASSERT(callback != NULL); // Must provide a callback if you set the ImGuiInputTextFlags_CallbackResize flag!
+    if (edit_buf != NULL)
+        IM_ASSERT(is_multiline && hint == NULL && !is_password && (flags & (ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackAlways | ImGuiInputTextFlags_CallbackEdit | ImGuiInputTextFlags_CallbackResize)) == 0); // Unsupported with ImGuiTextEditBuffer
 
     if (is_multiline) // Open group before calling GetID() because groups tracks id created within their scope (including the scrollbar)
         BeginGroup();
@@ -4004,19 +4424,31 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state = &g.InputTextState;
         state->CursorAnimReset();
 
-        // Take a copy of the initial buffer value (both in original UTF-8 format and converted to wchar)
-        // From the moment we focused we are ignoring the content of 'buf' (unless we are in read-only mode)
-        const int buf_len = (int)strlen(buf);
-        state->InitialTextA.resize(buf_len + 1);    // UTF-8. we use +1 to make sure that .Data is always pointing to at least an empty string.
-        memcpy(state->InitialTextA.Data, buf, buf_len + 1);
-
-        // Start edition
-        const char* buf_end = NULL;
-        state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
-        state->TextA.resize(0);
-        state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
-        state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        state->EditBuffer = edit_buf;
+        if (edit_buf != NULL)
+        {
+            // An ImGuiTextEditBuffer is edited in place: there is nothing to copy
+            state->TextA.resize(0);
+            state->TextAIsValid = false;
+            state->CurLenW = edit_buf->GetLength();
+            state->CurLenA = edit_buf->TextSizeA;
+        }
+        else
+        {
+            // Take a copy of the initial buffer value (both in original UTF-8 format and converted to wchar)
+            // From the moment we focused we are ignoring the content of 'buf' (unless we are in read-only mode)
+            const int buf_len = (int)strlen(buf);
+            state->InitialTextA.resize(buf_len + 1);    // UTF-8. we use +1 to make sure that .Data is always pointing to at least an empty string.
+            memcpy(state->InitialTextA.Data, buf, buf_len + 1);
+
+            // Start edition
+            const char* buf_end = NULL;
+            state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
+            state->TextA.resize(0);
+            state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
+            state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
+            state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        }
 
         // Preserve cursor position and undo/redo stack if we come back to same widget
         // FIXME: For non-readonly widgets we might be able to require that TextAIsValid && TextA == buf ? (untested) and discard undo stack if user buffer has changed.
@@ -4088,9 +4520,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     bool value_changed = false;
     bool enter_pressed = false;
 
+    // An ImGuiTextEditBuffer is always live data: follow modifications made by the user since last frame
+    if (edit_buf != NULL && state != NULL)
+    {
+        state->EditBuffer = edit_buf;
+        state->CurLenW = edit_buf->GetLength();
+        state->CurLenA = edit_buf->TextSizeA;
+        state->CursorClamp();
+    }
+
     // When read-only we always use the live data passed to the function
     // FIXME-OPT: Because our selection/cursor code currently needs the wide text we need to convert it when active, which is not ideal :(
-    if (is_readonly && state != NULL && (render_cursor || render_selection))
+    if (is_readonly && state != NULL && edit_buf == NULL && (render_cursor || render_selection))
     {
         const char* buf_end = NULL;
         state->TextW.resize(buf_size + 1);
@@ -4116,7 +4557,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         password_font->ContainerAtlas = g.Font->ContainerAtlas;
         password_font->FallbackGlyph = glyph;
         password_font->FallbackAdvanceX = glyph->AdvanceX;
-        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty());
+        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty() && password_font->IndexPages.empty());
         PushFont(password_font);
     }
 
@@ -4129,6 +4570,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->Edited = false;
         state->BufCapacityA = buf_size;
         state->Flags = flags;
+        state->Stb.undostate.MemoryBudget = !is_undoable ? 0 : (edit_buf != NULL && edit_buf->UndoMemory > 0) ? edit_buf->UndoMemory : io.ConfigInputTextUndoMemory;
 
         // Although we are active we don't prevent mouse from hovering other elements unless we are interacting right now with the widget.
         // Down the line we should have a cleaner library-wide concept of Selected vs Active.
@@ -4319,9 +4761,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
-                const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
+                const int clipboard_data_len = (edit_buf ? edit_buf->GetTextSizeA(ib, ie) : ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie)) + 1;
                 char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
-                ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
+                if (edit_buf)
+                    edit_buf->GetText(clipboard_data, clipboard_data_len, ib, ie);
+                else
+                    ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
                 SetClipboardText(clipboard_data);
                 MemFree(clipboard_data);
             }
@@ -4366,9 +4811,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     }
 
     // Process callbacks and apply result back to user's buffer.
+    // An ImGuiTextEditBuffer was edited in place: there is nothing to convert or copy back, and cancelling doesn't revert.
     const char* apply_new_text = NULL;
     int apply_new_text_length = 0;
-    if (g.ActiveId == id)
+    if (g.ActiveId == id && edit_buf != NULL)
+    {
+        value_changed = state->Edited;
+        state->Flags = ImGuiInputTextFlags_None;
+    }
+    else if (g.ActiveId == id)
     {
         IM_ASSERT(state != NULL);
         if (cancel_edit)
@@ -4556,7 +5007,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     if (render_cursor || render_selection)
     {
         IM_ASSERT(state != NULL);
-        if (!is_displaying_hint)
+        if (!is_displaying_hint && edit_buf == NULL)
             buf_display_end = buf_display + state->CurLenA;
 
         // Render text (with cursor and selection)
@@ -4569,6 +5020,22 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         const ImWchar* text_begin = state->TextW.Data;
         ImVec2 cursor_offset, select_start_offset;
 
+        if (edit_buf != NULL)
+        {
+            // Locate lines from the line index, and only measure from the beginning of their line
+            const int cursor_line = edit_buf->GetLineFromPos(state->Stb.cursor);
+            cursor_offset.x = InputTextCalcEditBufferWidth(edit_buf, edit_buf->GetLineStart(cursor_line), state->Stb.cursor);
+            cursor_offset.y = (cursor_line + 1) * g.FontSize;
+            if (render_selection)
+            {
+                const int select_start = ImMin(state->Stb.select_start, state->Stb.select_end);
+                const int select_start_line = edit_buf->GetLineFromPos(select_start);
+                select_start_offset.x = InputTextCalcEditBufferWidth(edit_buf, edit_buf->GetLineStart(select_start_line), select_start);
+                select_start_offset.y = (select_start_line + 1) * g.FontSize;
+            }
+            text_size = ImVec2(inner_size.x, edit_buf->GetLineCount() * g.FontSize);
+        }
+        else
         {
             // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
             const ImWchar* searches_input_ptr[2] = { NULL, NULL };
@@ -4656,7 +5123,31 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
         // Draw selection
         const ImVec2 draw_scroll = ImVec2(state->ScrollX, 0.0f);
-        if (render_selection)
+        if (render_selection && edit_buf != NULL)
+        {
+            // Only visit the selected lines which are visible
+            const int select_min = ImMin(state->Stb.select_start, state->Stb.select_end);
+            const int select_max = ImMax(state->Stb.select_start, state->Stb.select_end);
+            const int line_count = edit_buf->GetLineCount();
+            const int select_line_min = edit_buf->GetLineFromPos(select_min);
+            const int select_line_max = edit_buf->GetLineFromPos(select_max - 1); // A selection ending at the beginning of a line doesn't show on that line
+            const int line_min = ImMax(select_line_min, (int)ImFloor((clip_rect.y - draw_pos.y) / g.FontSize) - 1);
+            const int line_max = ImMin(select_line_max, (int)ImFloor((clip_rect.w - draw_pos.y) / g.FontSize) + 1);
+            ImU32 bg_color = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f);
+            for (int line = line_min; line <= line_max && select_min < select_max; line++)
+            {
+                const int line_begin = ImMax(select_min, edit_buf->GetLineStart(line));
+                const int line_end = ImMin(select_max, (line + 1 < line_count) ? edit_buf->GetLineBreak(line) : edit_buf->GetLength());
+                float rect_width = InputTextCalcEditBufferWidth(edit_buf, line_begin, line_end);
+                if (rect_width <= 0.0f) rect_width = IM_FLOOR(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+                const ImVec2 rect_pos(draw_pos.x - draw_scroll.x + (line == select_line_min ? select_start_offset.x : 0.0f), draw_pos.y + (line + 1) * g.FontSize);
+                ImRect rect(rect_pos + ImVec2(0.0f, -g.FontSize), rect_pos + ImVec2(rect_width, 0.0f));
+                rect.ClipWith(clip_rect);
+                if (rect.Overlaps(clip_rect))
+                    draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
+            }
+        }
+        else if (render_selection)
         {
             const ImWchar* text_selected_begin = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
             const ImWchar* text_selected_end = text_begin + ImMax(state->Stb.select_start, state->Stb.select_end);
@@ -4692,7 +5183,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (edit_buf != NULL)
+            InputTextRenderEditBuffer(edit_buf, draw_pos - draw_scroll, GetColorU32(ImGuiCol_Text));
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -4720,14 +5213,20 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     else
     {
         // Render text only (no selection, no cursor)
-        if (is_multiline)
+        if (edit_buf != NULL)
+            text_size = ImVec2(inner_size.x, edit_buf->GetLineCount() * g.FontSize); // We don't need width
+        else if (is_multiline)
             text_size = ImVec2(inner_size.x, InputTextCalcTextLenAndLineCount(buf_display, &buf_display_end) * g.FontSize); // We don't need width
         else if (!is_displaying_hint && g.ActiveId == id)
             buf_display_end = buf_display + state->CurLenA;
         else if (!is_displaying_hint)
             buf_display_end = buf_display + strlen(buf_display);
 
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (edit_buf != NULL)
+        {
+            InputTextRenderEditBuffer(edit_buf, draw_pos, GetColorU32(ImGuiCol_Text));
+        }
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -4759,7 +5258,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     }
 
     // Log as text
-    if (g.LogEnabled && (!is_password || is_displaying_hint))
+    if (g.LogEnabled && edit_buf == NULL && (!is_password || is_displaying_hint))
     {
         LogSetNextTextDecoration("{", "}");
         LogRenderedText(&draw_pos, buf_display, buf_display_end);
@@ -4778,6 +5277,359 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         return value_changed;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: TextView
+//-------------------------------------------------------------------------
+// - ImGuiTextView::Clear()
+// - ImGuiTextView::SetText()
+// - TextViewNextWrappedRow() [Internal]
+// - TextViewUpdateWrapIndex() [Internal]
+// - TextViewLocateRow() [Internal]
+// - TextViewOffsetFromPos() [Internal]
+// - TextView()
+//-------------------------------------------------------------------------
+
+void ImGuiTextView::Clear()
+{
+    Text = ImGuiTextBuffer::EmptyString;
+    TextSize = 0;
+    LineOffsets.resize(0);
+    LineOffsets.push_back(0);
+    SelectionStart = SelectionEnd = 0;
+    MeasureFont = NULL;
+    MeasureFontSize = ContentWidth = WrapWidth = 0.0f;
+    WrapRowStarts.resize(0);
+    WrapCacheLine = -1;
+    WrapCacheRow = WrapCacheOffset = 0;
+    VisibleRows.resize(0);
+}
+
+void ImGuiTextView::SetText(const char* text, int text_size)
+{
+    IM_ASSERT((text != NULL || text_size == 0) && text_size >= 0);
+    if (text_size < TextSize)
+        Clear();
+    Text = text ? text : ImGuiTextBuffer::EmptyString;
+    if (text_size == TextSize)
+        return;
+
+    // The last line may get longer: forget its word wrapping
+    if (WrapRowStarts.Size > LineOffsets.Size)
+        WrapRowStarts.pop_back();
+    WrapCacheLine = -1;
+
+    // Only scan the appended bytes
+    const char* text_end = text + text_size;
+    for (const char* p = text + TextSize; (p = (const char*)memchr(p, '\n', (size_t)(text_end - p))) != NULL; )
+        LineOffsets.push_back((int)(++p - text));
+    TextSize = text_size;
+}
+
+// Return the beginning of the row following the one starting at 's' (or 'line_end'), and the end of the row's visible text in 'out_row_end'.
+// Blanks at the wrapping point are skipped, the same way ImFont::RenderText() does.
+static const char* TextViewNextWrappedRow(ImFont* font, float scale, const char* s, const char* line_end, float wrap_width, const char** out_row_end)
+{
+    const char* row_end = font->CalcWordWrapPositionA(scale, s, line_end, wrap_width);
+    if (row_end == s && s < line_end)
+    {
+        // Not even one character fits: still consume one
+        unsigned int c;
+        row_end += ImTextCharFromUtf8(&c, s, line_end);
+    }
+    if (out_row_end)
+        *out_row_end = row_end;
+    while (row_end < line_end && ImCharIsBlankA(*row_end))
+        row_end++;
+    return row_end;
+}
+
+// Measure the number of rows of the next lines, within the view's budget of bytes per frame.
+static void TextViewUpdateWrapIndex(ImGuiTextView* view, ImFont* font, float font_size, float wrap_width)
+{
+    if (view->WrapRowStarts.Size == 0 || view->WrapWidth != wrap_width)
+    {
+        view->WrapRowStarts.resize(0);
+        view->WrapRowStarts.push_back(0);
+        view->WrapWidth = wrap_width;
+        view->WrapCacheLine = -1;
+    }
+
+    const float scale = font_size / font->FontSize;
+    int budget = view->WrapBytesPerFrame;
+    for (int line = view->WrapRowStarts.Size - 1; line < view->LineOffsets.Size && budget > 0; line++)
+    {
+        const char* line_begin = view->GetLineBegin(line);
+        const char* line_end = view->GetLineEnd(line);
+        int rows = 1;
+        for (const char* s = TextViewNextWrappedRow(font, scale, line_begin, line_end, wrap_width, NULL); s < line_end; s = TextViewNextWrappedRow(font, scale, s, line_end, wrap_width, NULL))
+            rows++;
+        view->WrapRowStarts.push_back(view->WrapRowStarts.back() + rows);
+        budget -= (int)(line_end - line_begin) + 1;
+    }
+}
+
+// Find the line containing 'row' and the offset of the beginning of the row.
+static int TextViewLocateRow(ImGuiTextView* view, ImFont* font, float scale, float wrap_width, int row, int* out_line)
+{
+    // Without word wrap, or past the measured lines: one row per line
+    const int measured_lines = view->WrapRowStarts.Size - 1;
+    if (wrap_width <= 0.0f || row >= view->WrapRowStarts.back())
+    {
+        const int line = (wrap_width <= 0.0f) ? row : measured_lines + (row - view->WrapRowStarts.back());
+        *out_line = line;
+        return view->LineOffsets[line];
+    }
+
+    // Binary search the last line starting at or before 'row'
+    int line_min = 0, line_max = measured_lines - 1;
+    while (line_min < line_max)
+    {
+        const int line_mid = (line_min + line_max + 1) >> 1;
+        if (view->WrapRowStarts[line_mid] <= row)
+            line_min = line_mid;
+        else
+            line_max = line_mid - 1;
+    }
+    *out_line = line_min;
+
+    // Walk the rows of the line, resuming from the last location when possible
+    const int row_in_line = row - view->WrapRowStarts[line_min];
+    const char* line_end = view->GetLineEnd(line_min);
+    const char* s = view->GetLineBegin(line_min);
+    int r = 0;
+    if (view->WrapCacheLine == line_min && view->WrapCacheRow <= row_in_line)
+    {
+        s = view->Text + view->WrapCacheOffset;
+        r = view->WrapCacheRow;
+    }
+    for (; r < row_in_line; r++)
+        s = TextViewNextWrappedRow(font, scale, s, line_end, wrap_width, NULL);
+    view->WrapCacheLine = line_min;
+    view->WrapCacheRow = row_in_line;
+    view->WrapCacheOffset = (int)(s - view->Text);
+    return view->WrapCacheOffset;
+}
+
+// Return the offset in the text which is the closest to 'pos', among the rows visible this frame.
+static int TextViewOffsetFromPos(const ImGuiTextView* view, ImFont* font, float font_size, const ImVec2& origin, int first_row, int total_rows, const ImVec2& pos)
+{
+    const int visible_rows = view->VisibleRows.Size / 2;
+    if (visible_rows == 0)
+        return 0;
+    const int row = (int)ImFloor((pos.y - origin.y) / font_size);
+    if (row >= total_rows)
+        return view->TextSize;
+    const int row_n = ImClamp(row - first_row, 0, visible_rows - 1);
+    const char* s = view->Text + view->VisibleRows[row_n * 2];
+    const char* row_end = view->Text + view->VisibleRows[row_n * 2 + 1];
+
+    const float scale = font_size / font->FontSize;
+    const float x = pos.x - origin.x;
+    float line_width = 0.0f;
+    while (s < row_end)
+    {
+        unsigned int c = (unsigned int)*s;
+        const int c_len = (c < 0x80) ? 1 : ImTextCharFromUtf8(&c, s, row_end);
+        const float char_width = (c == '\r') ? 0.0f : font->GetCharAdvance((ImWchar)c) * scale;
+        if (x < line_width + char_width * 0.5f)
+            break;
+        line_width += char_width;
+        s += c_len;
+    }
+    return (int)(s - view->Text);
+}
+
+void ImGui::TextView(const char* str_id, ImGuiTextView* view, const ImVec2& size_arg, ImGuiTextViewFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* parent_window = GetCurrentWindow();
+    if (parent_window->SkipItems)
+        return;
+    IM_ASSERT(view != NULL && view->LineOffsets.Size > 0);
+
+    // Word wrapping always reserves the vertical scrollbar, otherwise its appearance would change the wrap width and the number of rows
+    const bool word_wrap = (flags & ImGuiTextViewFlags_WordWrap) != 0;
+    const ImGuiWindowFlags window_flags = ImGuiWindowFlags_NoMove | (word_wrap ? ImGuiWindowFlags_AlwaysVerticalScrollbar : ImGuiWindowFlags_HorizontalScrollbar);
+    if (!BeginChild(str_id, size_arg, (flags & ImGuiTextViewFlags_Border) != 0, window_flags))
+    {
+        EndChild();
+        return;
+    }
+    ImGuiWindow* window = g.CurrentWindow;
+    ImFont* font = g.Font;
+    const float font_size = g.FontSize;
+    const float scale = font_size / font->FontSize;
+
+    // Everything measured depends on the font
+    if (view->MeasureFont != font || view->MeasureFontSize != font_size)
+    {
+        view->MeasureFont = font;
+        view->MeasureFontSize = font_size;
+        view->ContentWidth = 0.0f;
+        view->WrapRowStarts.resize(0);
+        view->WrapCacheLine = -1;
+    }
+
+    const ImVec2 origin = window->DC.CursorPos;
+    const ImRect clip_rect = window->InnerClipRect;
+    float wrap_width = 0.0f;
+    int total_rows = view->LineOffsets.Size;
+    if (word_wrap)
+    {
+        wrap_width = ImMax(window->WorkRect.Max.x - origin.x, 1.0f);
+        TextViewUpdateWrapIndex(view, font, font_size, wrap_width);
+        total_rows = view->WrapRowStarts.back() + (view->LineOffsets.Size - (view->WrapRowStarts.Size - 1));
+    }
+
+    // Locate visible rows
+    const int first_row = ImClamp((int)ImFloor((clip_rect.Min.y - origin.y) / font_size), 0, total_rows);
+    const int last_row = ImClamp((int)ImCeil((clip_rect.Max.y - origin.y) / font_size), first_row, total_rows);
+    view->VisibleRows.resize(0);
+    if (first_row < last_row)
+    {
+        int line;
+        const char* s = view->Text + TextViewLocateRow(view, font, scale, wrap_width, first_row, &line);
+        const char* line_end = view->GetLineEnd(line);
+        for (int row = first_row; row < last_row; row++)
+        {
+            // Lines not measured yet only display their first row
+            const char* row_end = line_end;
+            const char* next_s = line_end;
+            if (word_wrap)
+                next_s = TextViewNextWrappedRow(font, scale, s, line_end, wrap_width, &row_end);
+            if (line >= view->WrapRowStarts.Size - 1)
+                next_s = line_end;
+            view->VisibleRows.push_back((int)(s - view->Text));
+            view->VisibleRows.push_back((int)(row_end - view->Text));
+            if (next_s < line_end)
+                s = next_s;
+            else if (++line < view->LineOffsets.Size)
+                s = view->GetLineBegin(line), line_end = view->GetLineEnd(line);
+            else
+                break;
+        }
+    }
+
+    // Mouse selection
+    const ImGuiID id = window->GetID("#TEXTVIEW");
+    const ImRect bb(clip_rect.Min, ImMax(clip_rect.Min, clip_rect.Max));
+    ItemAdd(bb, id, NULL, ImGuiItemFlags_NoNav);
+    const bool allow_selection = (flags & ImGuiTextViewFlags_NoSelection) == 0;
+    if (allow_selection)
+    {
+        ImGuiIO& io = g.IO;
+        const bool hovered = ItemHoverable(bb, id);
+        if (hovered)
+            g.MouseCursor = ImGuiMouseCursor_TextInput;
+        if (hovered && io.MouseClicked[0])
+        {
+            SetActiveID(id, window);
+            FocusWindow(window);
+            const int offset = TextViewOffsetFromPos(view, font, font_size, origin, first_row, total_rows, io.MousePos);
+            if (io.MouseDoubleClicked[0])
+            {
+                // Select word
+                int word_begin = offset, word_end = offset;
+                while (word_begin > 0 && !ImStb::is_separator((unsigned char)view->Text[word_begin - 1]))
+                    word_begin--;
+                while (word_end < view->TextSize && !ImStb::is_separator((unsigned char)view->Text[word_end]))
+                    word_end++;
+                view->SelectionStart = word_begin;
+                view->SelectionEnd = word_end;
+            }
+            else
+            {
+                if (!io.KeyShift)
+                    view->SelectionStart = offset;
+                view->SelectionEnd = offset;
+            }
+        }
+        else if (g.ActiveId == id)
+        {
+            if (io.MouseDown[0])
+            {
+                if (!io.MouseDoubleClicked[0])
+                    view->SelectionEnd = TextViewOffsetFromPos(view, font, font_size, origin, first_row, total_rows, io.MousePos);
+
+                // Scroll while dragging outside of the view
+                if (io.MousePos.y < clip_rect.Min.y || io.MousePos.y > clip_rect.Max.y)
+                    SetScrollY(window, window->Scroll.y + (io.MousePos.y < clip_rect.Min.y ? io.MousePos.y - clip_rect.Min.y : io.MousePos.y - clip_rect.Max.y) * io.DeltaTime * 10.0f);
+                if (!word_wrap && (io.MousePos.x < clip_rect.Min.x || io.MousePos.x > clip_rect.Max.x))
+                    SetScrollX(window, window->Scroll.x + (io.MousePos.x < clip_rect.Min.x ? io.MousePos.x - clip_rect.Min.x : io.MousePos.x - clip_rect.Max.x) * io.DeltaTime * 10.0f);
+            }
+            else
+            {
+                ClearActiveID();
+            }
+        }
+
+        // Keyboard shortcuts
+        if (IsWindowFocused())
+        {
+            const bool is_shortcut_key = io.ConfigMacOSXBehaviors ? (io.KeyMods == ImGuiKeyModFlags_Super) : (io.KeyMods == ImGuiKeyModFlags_Ctrl);
+            const bool is_ctrl_key_only = (io.KeyMods == ImGuiKeyModFlags_Ctrl);
+            if (is_shortcut_key && IsKeyPressed(ImGuiKey_A))
+                view->SelectAll();
+            if (((is_shortcut_key && IsKeyPressed(ImGuiKey_C)) || (is_ctrl_key_only && IsKeyPressed(ImGuiKey_Insert))) && view->HasSelection() && io.SetClipboardTextFn)
+            {
+                const int ib = ImMin(view->SelectionStart, view->SelectionEnd);
+                const int ie = ImMax(view->SelectionStart, view->SelectionEnd);
+                char* clipboard_data = (char*)IM_ALLOC((size_t)(ie - ib) + 1);
+                memcpy(clipboard_data, view->Text + ib, (size_t)(ie - ib));
+                clipboard_data[ie - ib] = 0;
+                SetClipboardText(clipboard_data);
+                MemFree(clipboard_data);
+            }
+        }
+    }
+
+    // Render visible rows
+    // Without word wrap, lines are only measured up to one page past the right edge of the view: the horizontal scrolling range grows as the view scrolls.
+    const int sel_min = ImMin(view->SelectionStart, view->SelectionEnd);
+    const int sel_max = ImMax(view->SelectionStart, view->SelectionEnd);
+    const ImU32 col_text = GetColorU32(ImGuiCol_Text);
+    const ImU32 col_selection = GetColorU32(ImGuiCol_TextSelectedBg);
+    const float measure_width = word_wrap ? FLT_MAX : (clip_rect.Max.x - origin.x) + clip_rect.GetWidth();
+    for (int row_n = 0; row_n < view->VisibleRows.Size / 2; row_n++)
+    {
+        const int row_begin = view->VisibleRows[row_n * 2];
+        const int row_end = view->VisibleRows[row_n * 2 + 1];
+        const char* text_begin = view->Text + row_begin;
+        const char* text_end = text_begin + (row_end - row_begin);
+        const ImVec2 pos(origin.x, origin.y + (first_row + row_n) * font_size);
+        if (!word_wrap)
+        {
+            const char* remaining = text_end;
+            const float width = font->CalcTextSizeA(font_size, measure_width, 0.0f, text_begin, text_end, &remaining).x;
+            view->ContentWidth = ImMax(view->ContentWidth, remaining < text_end ? measure_width : width);
+            text_end = remaining;
+        }
+
+        // Selection, with a half space shown for a selected line break
+        if (sel_min < sel_max && sel_min <= row_end && sel_max > row_begin)
+        {
+            const bool sel_line_break = sel_max > row_end && row_end < view->TextSize && view->Text[row_end] == '\n';
+            if (sel_min < row_end || sel_line_break)
+            {
+                const float x0 = sel_min > row_begin ? font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, text_begin, view->Text + sel_min).x : 0.0f;
+                float x1 = font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, text_begin, view->Text + ImMin(sel_max, row_end)).x;
+                if (sel_line_break)
+                    x1 += IM_FLOOR(font->GetCharAdvance((ImWchar)' ') * scale * 0.50f);
+                window->DrawList->AddRectFilled(ImVec2(pos.x + x0, pos.y), ImVec2(pos.x + x1, pos.y + font_size), col_selection);
+            }
+        }
+        window->DrawList->AddText(font, font_size, pos, col_text, text_begin, text_end);
+    }
+
+    // Declare content size
+    window->DC.CursorPos = origin;
+    ItemSize(ImVec2(word_wrap ? 0.0f : view->ContentWidth, total_rows * font_size));
+
+    if ((flags & ImGuiTextViewFlags_AutoScroll) && window->Scroll.y >= window->ScrollMax.y && g.ActiveId != id)
+        SetScrollHereY(1.0f);
+    EndChild();
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 //-------------------------------------------------------------------------
@@ -5392,13 +6244,16 @@ bool ImGui::ColorPicker4(const char* label, float col[4], ImGuiColorEditFlags fl
         ImVec2 trb = wheel_center + ImRotate(triangle_pb, cos_hue_angle, sin_hue_angle);
         ImVec2 trc = wheel_center + ImRotate(triangle_pc, cos_hue_angle, sin_hue_angle);
         ImVec2 uv_white = GetFontTexUvWhitePixel();
-        draw_list->PrimReserve(6, 6);
-        draw_list->PrimVtx(tra, uv_white, hue_color32);
-        draw_list->PrimVtx(trb, uv_white, hue_color32);
-        draw_list->PrimVtx(trc, uv_white, col_white);
-        draw_list->PrimVtx(tra, uv_white, 0);
-        draw_list->PrimVtx(trb, uv_white, col_black);
-        draw_list->PrimVtx(trc, uv_white, 0);
+        if (!(draw_list->Flags & ImDrawListFlags_FingerprintOnly)) // Not fingerprinted, but only depends on the hue wheel and cursor drawn above (ImGuiWindowFlags_RetainDrawList)
+        {
+            draw_list->PrimReserve(6, 6);
+            draw_list->PrimVtx(tra, uv_white, hue_color32);
+            draw_list->PrimVtx(trb, uv_white, hue_color32);
+            draw_list->PrimVtx(trc, uv_white, col_white);
+            draw_list->PrimVtx(tra, uv_white, 0);
+            draw_list->PrimVtx(trb, uv_white, col_black);
+            draw_list->PrimVtx(trc, uv_white, 0);
+        }
         draw_list->AddTriangle(tra, trb, trc, col_midgrey, 1.5f);
         sv_cursor_pos = ImLerp(ImLerp(trc, tra, ImSaturate(S)), trb, ImSaturate(1 - V));
     }
@@ -5720,6 +6575,14 @@ bool ImGui::TreeNode(const char* label)
     return TreeNodeBehavior(window->GetID(label), 0, label, NULL);
 }
 
+bool ImGui::TreeNode(const ImGuiLiteralID& label)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return TreeNodeBehavior(window->GetID(label), 0, label.Str, NULL);
+}
+
 bool ImGui::TreeNodeV(const char* str_id, const char* fmt, va_list args)
 {
     return TreeNodeExV(str_id, 0, fmt, args);
@@ -2,6 +2,8 @@
 // This is a slightly modified version of stb_textedit.h 1.13.
 // Those changes would need to be pushed into nothings/stb:
 // - Fix in stb_textedit_discard_redo (see https://github.com/nothings/stb/issues/321)
+// - Optional STB_TEXTEDIT_FINDROW_FROM_Y/STB_TEXTEDIT_FINDROW_FROM_CHAR hooks to skip the layout of preceding rows
+// - Optional STB_TEXTEDIT_UNDOSTATE to replace the fixed-size undo buffer with a user-provided undo store
 // Grep for [DEAR IMGUI] to find the changes.
 
 // stb_textedit.h - v1.13  - public domain - Sean Barrett
@@ -171,6 +173,14 @@
 //    STB_TEXTEDIT_K_LINEEND2            secondary keyboard input to move cursor to end of line
 //    STB_TEXTEDIT_K_TEXTSTART2          secondary keyboard input to move cursor to start of text
 //    STB_TEXTEDIT_K_TEXTEND2            secondary keyboard input to move cursor to end of text
+//    STB_TEXTEDIT_FINDROW_FROM_Y(obj,y,&base_y)     [DEAR IMGUI] returns the first char of a row at or before the one
+//                                                      straddling 'y' and writes its y position; 0 to scan from the top
+//    STB_TEXTEDIT_FINDROW_FROM_CHAR(obj,n,&prev,&y) [DEAR IMGUI] returns the first char of a row at or before the one
+//                                                      containing char #n, writes the first char of the row before it
+//                                                      and its y position; 0 to scan from the top
+//    STB_TEXTEDIT_UNDOSTATE                         [DEAR IMGUI] type of the undo state, replacing the fixed-size StbUndoState.
+//                                                      stb_text_undo, stb_text_redo, stb_text_makeundo_insert/delete/replace
+//                                                      and stb_text_clearundo are then implemented by the user
 //
 // Keyboard input must be encoded as a single integer value; e.g. a character code
 // and some bitflags that represent shift states. to simplify the interface, SHIFT must
@@ -349,7 +359,12 @@ typedef struct
    unsigned char single_line;
    unsigned char padding1, padding2, padding3;
    float preferred_x; // this determines where the cursor up/down tries to seek to along x
+   // [DEAR IMGUI]
+#ifdef STB_TEXTEDIT_UNDOSTATE
+   STB_TEXTEDIT_UNDOSTATE undostate;
+#else
    StbUndoState undostate;
+#endif
 } STB_TexteditState;
 
 
@@ -406,6 +421,12 @@ static int stb_text_locate_coord(STB_TEXTEDIT_STRING *str, float x, float y)
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+   // [DEAR IMGUI]
+   // skip the rows above 'y' when the client can locate them directly
+#ifdef STB_TEXTEDIT_FINDROW_FROM_Y
+   i = STB_TEXTEDIT_FINDROW_FROM_Y(str, y, &base_y);
+#endif
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -504,6 +525,10 @@ static void stb_text_redo(STB_TEXTEDIT_STRING *str, STB_TexteditState *state);
 static void stb_text_makeundo_delete(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int length);
 static void stb_text_makeundo_insert(STB_TexteditState *state, int where, int length);
 static void stb_text_makeundo_replace(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int old_length, int new_length);
+// [DEAR IMGUI]
+#ifdef STB_TEXTEDIT_UNDOSTATE
+static void stb_text_clearundo(STB_TexteditState *state);
+#endif
 
 typedef struct
 {
@@ -536,6 +561,13 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
          find->y = 0;
          find->x = 0;
          find->height = 1;
+         // [DEAR IMGUI]
+#ifdef STB_TEXTEDIT_FINDROW_FROM_CHAR
+         if (z > 0) {
+            float unused_y;
+            i = STB_TEXTEDIT_FINDROW_FROM_CHAR(str, z - 1, &prev_start, &unused_y);
+         }
+#endif
          while (i < z) {
             STB_TEXTEDIT_LAYOUTROW(&r, str, i);
             prev_start = i;
@@ -551,6 +583,12 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
    // search rows to find the one that straddles character n
    find->y = 0;
 
+   // [DEAR IMGUI]
+   // skip the rows above character n when the client can locate them directly
+#ifdef STB_TEXTEDIT_FINDROW_FROM_CHAR
+   i = STB_TEXTEDIT_FINDROW_FROM_CHAR(str, n, &prev_start, &find->y);
+#endif
+
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
       if (n < i + r.num_chars)
@@ -1119,6 +1157,9 @@ retry:
 //
 // @OPTIMIZE: the undo/redo buffer should be circular
 
+// [DEAR IMGUI]
+#ifndef STB_TEXTEDIT_UNDOSTATE
+
 static void stb_textedit_flush_redo(StbUndoState *state)
 {
    state->redo_point = STB_TEXTEDIT_UNDOSTATECOUNT;
@@ -1366,13 +1407,20 @@ static void stb_text_makeundo_replace(STB_TEXTEDIT_STRING *str, STB_TexteditStat
    }
 }
 
+#endif // #ifndef STB_TEXTEDIT_UNDOSTATE
+
 // reset the state to default
 static void stb_textedit_clear_state(STB_TexteditState *state, int is_single_line)
 {
+   // [DEAR IMGUI]
+#ifdef STB_TEXTEDIT_UNDOSTATE
+   stb_text_clearundo(state);
+#else
    state->undostate.undo_point = 0;
    state->undostate.undo_char_point = 0;
    state->undostate.redo_point = STB_TEXTEDIT_UNDOSTATECOUNT;
    state->undostate.redo_char_point = STB_TEXTEDIT_UNDOCHARCOUNT;
+#endif
    state->select_end = state->select_start = 0;
    state->cursor = 0;
    state->has_preferred_x = 0;
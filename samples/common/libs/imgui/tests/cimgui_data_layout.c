@@ -0,0 +1,22 @@
+// Check that the structures declared by cimgui.h, as seen by a C compiler (which is what Zig's @cImport uses), have the same sizes
+// as the C++ structures of imgui.h and imgui_internal.h. Structures of this tree are mirrored by hand in cimgui.h.
+// The samples perform the same check at startup (see initWindow() in samples/common/src/common.zig).
+//
+// Build and run from this folder, e.g.:
+//   gcc -std=c99 -c -I.. -o cimgui_data_layout.o cimgui_data_layout.c
+//   g++ -std=c++11 -O1 -I.. -I../.. -o cimgui_data_layout cimgui_data_layout.o ../cimgui.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp ../imgui_demo.cpp
+//   ./cimgui_data_layout
+
+#define CIMGUI_DEFINE_ENUMS_AND_STRUCTS
+#include "cimgui.h"
+
+int main(void)
+{
+    printf("C sizes: ImGuiWindow %d, ImGuiWindowRetainedDrawList %d, ImDrawList %d, ImDrawListCache %d, ImDrawData %d, ImFontAtlas %d, ImFont %d\n",
+        (int)sizeof(ImGuiWindow), (int)sizeof(ImGuiWindowRetainedDrawList), (int)sizeof(ImDrawList),
+        (int)sizeof(ImDrawListCache), (int)sizeof(ImDrawData), (int)sizeof(ImFontAtlas), (int)sizeof(ImFont));
+    const bool ok = igDebugCheckCimguiDataLayout(sizeof(ImGuiWindow), sizeof(ImGuiWindowRetainedDrawList), sizeof(ImDrawList),
+        sizeof(ImDrawListCache), sizeof(ImDrawData), sizeof(ImFontAtlas), sizeof(ImFont));
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,216 @@
+// Check for io.ConfigDrawDataDamageRects: ImDrawData::DamageRects[] needs to cover what changed since last frame, and nothing more, on simple scenes.
+// A single window is rendered with scripted changes, and the damaged tiles are compared with the tiles touched by the change:
+// - an idle frame has no damage rectangle
+// - toggling a checkbox damages the tiles of the checkbox only
+// - moving the window damages the tiles of its old and new bounds
+// - a blinking InputText() cursor damages a single tile
+//
+// Build and run from this folder, e.g.:
+//   g++ -std=c++11 -O2 -I.. -o imgui_damage_rects imgui_damage_rects.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp
+//   ./imgui_damage_rects
+
+#include "imgui.h"
+#include "imgui_internal.h"     // IM_DRAWDATA_DAMAGE_TILE_SIZE, ImRect
+#include <float.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DAMAGE_WIDTH            800
+#define DAMAGE_HEIGHT           600
+#define DAMAGE_TILES_X          ((DAMAGE_WIDTH + IM_DRAWDATA_DAMAGE_TILE_SIZE - 1) / IM_DRAWDATA_DAMAGE_TILE_SIZE)
+#define DAMAGE_TILES_Y          ((DAMAGE_HEIGHT + IM_DRAWDATA_DAMAGE_TILE_SIZE - 1) / IM_DRAWDATA_DAMAGE_TILE_SIZE)
+
+// Scripted state of the scene
+struct DamageTestState
+{
+    ImVec2  WindowPos;
+    bool    Check;
+    bool    FocusText;
+    char    Text[32];
+    ImRect  WindowRect;         // Output of last frame
+    ImRect  CheckRect;
+    ImRect  TextRect;
+
+    DamageTestState() { WindowPos = ImVec2(40.0f, 40.0f); Check = false; FocusText = false; strcpy(Text, "Hello"); }
+};
+
+// Damaged tiles of the last frame, one bool per tile
+struct DamageTiles
+{
+    bool    Tiles[DAMAGE_TILES_Y][DAMAGE_TILES_X];
+    int     Count;
+};
+
+static int RenderFrame(DamageTestState* state, DamageTiles* out_tiles)
+{
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(state->WindowPos, ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(300.0f, 200.0f), ImGuiCond_Always);
+    ImGui::Begin("Damage", NULL, ImGuiWindowFlags_NoSavedSettings);
+    state->WindowRect = ImGui::GetCurrentWindow()->Rect();
+    ImGui::Checkbox("Check", &state->Check);
+    state->CheckRect = ImRect(ImGui::GetItemRectMin(), ImGui::GetItemRectMax());
+    if (state->FocusText)
+        ImGui::SetKeyboardFocusHere();
+    state->FocusText = false;
+    ImGui::InputText("Text", state->Text, IM_ARRAYSIZE(state->Text));
+    state->TextRect = ImRect(ImGui::GetItemRectMin(), ImGui::GetItemRectMax());
+    ImGui::End();
+    ImGui::Render();
+
+    const ImDrawData* draw_data = ImGui::GetDrawData();
+    memset(out_tiles, 0, sizeof(*out_tiles));
+    for (int rect_n = 0; rect_n < draw_data->DamageRectsCount; rect_n++)
+    {
+        const ImVec4& r = draw_data->DamageRects[rect_n];
+        for (int tile_y = (int)r.y / IM_DRAWDATA_DAMAGE_TILE_SIZE; tile_y * IM_DRAWDATA_DAMAGE_TILE_SIZE < (int)r.w; tile_y++)
+            for (int tile_x = (int)r.x / IM_DRAWDATA_DAMAGE_TILE_SIZE; tile_x * IM_DRAWDATA_DAMAGE_TILE_SIZE < (int)r.z; tile_x++)
+                if (!out_tiles->Tiles[tile_y][tile_x])
+                {
+                    out_tiles->Tiles[tile_y][tile_x] = true;
+                    out_tiles->Count++;
+                }
+    }
+    return draw_data->DamageRectsCount;
+}
+
+// Tile range possibly touched by anything drawn inside 'r' (anti-aliased fringes included)
+static void GetTileRange(const ImRect& r, int* tile_x0, int* tile_y0, int* tile_x1, int* tile_y1)
+{
+    *tile_x0 = ImMax((int)ImFloor((r.Min.x - 1.0f) / IM_DRAWDATA_DAMAGE_TILE_SIZE), 0);
+    *tile_y0 = ImMax((int)ImFloor((r.Min.y - 1.0f) / IM_DRAWDATA_DAMAGE_TILE_SIZE), 0);
+    *tile_x1 = ImMin((int)ImFloor((r.Max.x + 1.0f) / IM_DRAWDATA_DAMAGE_TILE_SIZE), DAMAGE_TILES_X - 1);
+    *tile_y1 = ImMin((int)ImFloor((r.Max.y + 1.0f) / IM_DRAWDATA_DAMAGE_TILE_SIZE), DAMAGE_TILES_Y - 1);
+}
+
+static bool IsTileInRect(int tile_x, int tile_y, const ImRect& r)
+{
+    int tile_x0, tile_y0, tile_x1, tile_y1;
+    GetTileRange(r, &tile_x0, &tile_y0, &tile_x1, &tile_y1);
+    return tile_x >= tile_x0 && tile_x <= tile_x1 && tile_y >= tile_y0 && tile_y <= tile_y1;
+}
+
+// Damaged tiles need to be within 'r1' or 'r2' (and the change needs to damage something)
+static bool CheckDamageWithin(const char* name, const DamageTiles& tiles, const ImRect& r1, const ImRect& r2)
+{
+    int outside = 0;
+    for (int tile_y = 0; tile_y < DAMAGE_TILES_Y; tile_y++)
+        for (int tile_x = 0; tile_x < DAMAGE_TILES_X; tile_x++)
+            if (tiles.Tiles[tile_y][tile_x] && !IsTileInRect(tile_x, tile_y, r1) && !IsTileInRect(tile_x, tile_y, r2))
+                outside++;
+    if (tiles.Count == 0 || outside > 0)
+    {
+        printf("FAILED: %s: %d damaged tiles, %d outside of the expected area\n", name, tiles.Count, outside);
+        return false;
+    }
+    return true;
+}
+
+// Tiles entirely inside 'r' need to be damaged
+static bool CheckDamageCovers(const char* name, const DamageTiles& tiles, const ImRect& r)
+{
+    int missing = 0;
+    for (int tile_y = 0; tile_y < DAMAGE_TILES_Y; tile_y++)
+        for (int tile_x = 0; tile_x < DAMAGE_TILES_X; tile_x++)
+        {
+            const ImRect tile_rect((float)(tile_x * IM_DRAWDATA_DAMAGE_TILE_SIZE), (float)(tile_y * IM_DRAWDATA_DAMAGE_TILE_SIZE), (float)((tile_x + 1) * IM_DRAWDATA_DAMAGE_TILE_SIZE), (float)((tile_y + 1) * IM_DRAWDATA_DAMAGE_TILE_SIZE));
+            if (r.Contains(tile_rect) && !tiles.Tiles[tile_y][tile_x])
+                missing++;
+        }
+    if (missing > 0)
+    {
+        printf("FAILED: %s: %d tiles not damaged\n", name, missing);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckIdle(const char* name, DamageTestState* state, DamageTiles* tiles)
+{
+    const int rects_count = RenderFrame(state, tiles);
+    if (rects_count != 0)
+    {
+        printf("FAILED: %s: %d damage rectangles on an idle frame\n", name, rects_count);
+        return false;
+    }
+    return true;
+}
+
+int main(int, char**)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2((float)DAMAGE_WIDTH, (float)DAMAGE_HEIGHT);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.ConfigDrawDataDamageRects = true;
+    io.Fonts->Build();
+    io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+
+    DamageTestState state;
+    DamageTiles tiles;
+    int failures = 0;
+
+    // First frame: everything is damaged. Then let the window settle.
+    if (RenderFrame(&state, &tiles) != 1 || tiles.Count != DAMAGE_TILES_X * DAMAGE_TILES_Y)
+    {
+        printf("FAILED: first frame: %d damaged tiles\n", tiles.Count);
+        failures++;
+    }
+    for (int n = 0; n < 5; n++)
+        RenderFrame(&state, &tiles);
+
+    // Idle frame
+    failures += CheckIdle("idle", &state, &tiles) ? 0 : 1;
+
+    // Toggled widget
+    for (int n = 0; n < 2; n++)
+    {
+        const ImRect check_rect = state.CheckRect;
+        state.Check = !state.Check;
+        RenderFrame(&state, &tiles);
+        failures += CheckDamageWithin("toggled checkbox", tiles, check_rect, check_rect) ? 0 : 1;
+        failures += CheckIdle("toggled checkbox, next frame", &state, &tiles) ? 0 : 1;
+    }
+
+    // Moved window
+    {
+        const ImRect old_rect = state.WindowRect;
+        state.WindowPos = ImVec2(200.0f, 250.0f);
+        RenderFrame(&state, &tiles);
+        const ImRect new_rect = state.WindowRect;
+        failures += CheckDamageWithin("moved window", tiles, old_rect, new_rect) ? 0 : 1;
+        failures += CheckDamageCovers("moved window, old bounds", tiles, old_rect) ? 0 : 1;
+        failures += CheckDamageCovers("moved window, new bounds", tiles, new_rect) ? 0 : 1;
+        failures += CheckIdle("moved window, next frame", &state, &tiles) ? 0 : 1;
+    }
+
+    // Blinking cursor: activate the InputText(), then every frame is either idle or damages the tile of the cursor.
+    // The cursor is at the end of the text, the window is placed so that it fits in a single tile.
+    state.FocusText = true;
+    for (int n = 0; n < 3; n++)
+        RenderFrame(&state, &tiles);
+    int blinks = 0;
+    for (int n = 0; n < 200; n++)
+    {
+        const int rects_count = RenderFrame(&state, &tiles);
+        if (rects_count == 0)
+            continue;
+        if (rects_count != 1 || tiles.Count != 1 || !CheckDamageWithin("blinking cursor", tiles, state.TextRect, state.TextRect))
+        {
+            printf("FAILED: blinking cursor: frame %d: %d damage rectangles, %d damaged tiles\n", n, rects_count, tiles.Count);
+            failures++;
+            break;
+        }
+        blinks++;
+    }
+    if (blinks < 2)
+    {
+        printf("FAILED: blinking cursor: %d blinks\n", blinks);
+        failures++;
+    }
+
+    printf("%s: %d failures, %d cursor blinks\n", failures ? "FAILED" : "OK", failures, blinks);
+    ImGui::DestroyContext();
+    return failures ? 1 : 0;
+}
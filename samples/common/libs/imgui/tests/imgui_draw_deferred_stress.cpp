@@ -0,0 +1,194 @@
+// Stress test for ImDrawList::AddDrawListDeferred(): draw lists are built concurrently on worker threads while the main thread
+// submits them into a window draw list and the foreground draw list, then ImGui::Render() splices them.
+// Every frame is built twice, once with worker lists and once serially (same primitives submitted directly at the same positions),
+// and both are rendered with imgui_impl_software: the images need to be identical.
+//
+// Build and run from this folder, e.g.:
+//   g++ -std=c++11 -O2 -I.. -o imgui_draw_deferred_stress imgui_draw_deferred_stress.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp ../imgui_impl_software.cpp -lpthread
+//   ./imgui_draw_deferred_stress                 8 worker threads, 4 lists per thread
+//   ./imgui_draw_deferred_stress --threads 32    32 worker threads
+// Building with -fsanitize=thread is recommended to catch data races.
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"     // ImDrawListSharedData
+#include "imgui_impl_software.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#define STRESS_WIDTH            800
+#define STRESS_HEIGHT           600
+#define STRESS_FRAMES           16
+#define STRESS_LISTS_PER_THREAD 4
+
+static unsigned int NextRandom(unsigned int* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static float RandomFloat(unsigned int* state, float min, float max)
+{
+    return min + (max - min) * (float)(NextRandom(state) & 0xFFFF) / 65535.0f;
+}
+
+// Submit a pseudo-random set of primitives. Clipping rectangles are intersected with the current one, so the output is the same
+// whether 'draw_list' is a standalone list spliced later or the window draw list.
+static void BuildPrimitives(ImDrawList* draw_list, unsigned int seed)
+{
+    unsigned int rng = seed;
+    const int count = (seed % 7 == 0) ? 12000 : 500 + (int)(NextRandom(&rng) % 1500); // Some lists need more than 64K vertices
+    int clip_depth = 0;
+    char text[32];
+    for (int n = 0; n < count; n++)
+    {
+        const ImVec2 p(RandomFloat(&rng, -20.0f, STRESS_WIDTH + 20.0f), RandomFloat(&rng, -20.0f, STRESS_HEIGHT + 20.0f));
+        const ImVec2 size(RandomFloat(&rng, 1.0f, 60.0f), RandomFloat(&rng, 1.0f, 60.0f));
+        const ImU32 col = (NextRandom(&rng) & 0x00FFFFFF) | ((64 + NextRandom(&rng) % 192) << IM_COL32_A_SHIFT);
+        switch (NextRandom(&rng) % 8)
+        {
+        case 0: draw_list->AddRectFilled(p, p + size, col); break;
+        case 1: draw_list->AddRect(p, p + size, col, RandomFloat(&rng, 0.0f, 10.0f), 0, RandomFloat(&rng, 1.0f, 4.0f)); break;
+        case 2: draw_list->AddCircleFilled(p, size.x * 0.5f, col); break;
+        case 3: draw_list->AddLine(p, p + size, col, RandomFloat(&rng, 1.0f, 5.0f)); break;
+        case 4: draw_list->AddTriangleFilled(p, p + ImVec2(size.x, 0.0f), p + size, col); break;
+        case 5:
+            snprintf(text, sizeof(text), "Text %u", NextRandom(&rng));
+            draw_list->AddText(p, col, text);
+            break;
+        case 6:
+            if (clip_depth < 4)
+            {
+                draw_list->PushClipRect(p, p + size * 4.0f, true);
+                clip_depth++;
+            }
+            break;
+        case 7:
+            if (clip_depth > 0)
+            {
+                draw_list->PopClipRect();
+                clip_depth--;
+            }
+            break;
+        }
+    }
+    while (clip_depth-- > 0)
+        draw_list->PopClipRect();
+}
+
+// FNV-1a 64-bit
+static unsigned long long HashPixels(const ImVector<unsigned char>& pixels)
+{
+    unsigned long long hash = 0xCBF29CE484222325ull;
+    for (int n = 0; n < pixels.Size; n++)
+        hash = (hash ^ pixels.Data[n]) * 0x100000001B3ull;
+    return hash;
+}
+
+// Build one frame. With 'deferred', primitives of list N are built on worker thread N / STRESS_LISTS_PER_THREAD, otherwise directly.
+static unsigned long long RenderFrame(int frame, int thread_count, bool deferred, std::vector<ImDrawList*>& worker_lists, ImVector<unsigned char>& pixels)
+{
+    ImGui::NewFrame();
+    ImDrawListSharedData shared_data = *ImGui::GetDrawListSharedData();
+    const int list_count = thread_count * STRESS_LISTS_PER_THREAD;
+    std::vector<std::thread> threads;
+    if (deferred)
+    {
+        while ((int)worker_lists.size() < list_count)
+            worker_lists.push_back(IM_NEW(ImDrawList)(&shared_data));
+        for (int list_n = 0; list_n < list_count; list_n++)
+            worker_lists[list_n]->_Data = &shared_data;
+        for (int thread_n = 0; thread_n < thread_count; thread_n++)
+            threads.push_back(std::thread([=, &worker_lists]()
+            {
+                for (int list_n = thread_n * STRESS_LISTS_PER_THREAD; list_n < (thread_n + 1) * STRESS_LISTS_PER_THREAD; list_n++)
+                {
+                    worker_lists[list_n]->ResetForNewFrame();
+                    BuildPrimitives(worker_lists[list_n], (unsigned int)(frame * 1000 + list_n));
+                }
+            }));
+    }
+
+    // Submit while workers are still running. Lists alternate between the window and the foreground draw list, with regular
+    // widgets and primitives in between, and some of them under a narrower clipping rectangle.
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+    ImGui::SetNextWindowSize(ImVec2(STRESS_WIDTH - 100.0f, STRESS_HEIGHT - 60.0f));
+    ImGui::Begin("Stress", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImDrawList* window_draw_list = ImGui::GetWindowDrawList();
+    ImDrawList* foreground_draw_list = ImGui::GetForegroundDrawList();
+    for (int list_n = 0; list_n < list_count; list_n++)
+    {
+        ImDrawList* dst_list = (list_n % 3 == 2) ? foreground_draw_list : window_draw_list;
+        const bool narrow_clip = (list_n % 4 == 1);
+        if (narrow_clip)
+            dst_list->PushClipRect(ImVec2(100.0f + list_n, 50.0f), ImVec2(500.0f, 400.0f - list_n), true);
+        if (deferred)
+        {
+            dst_list->AddDrawListDeferred(worker_lists[list_n]);
+        }
+        else
+        {
+            dst_list->PushClipRect(ImVec2(0.0f, 0.0f), ImGui::GetIO().DisplaySize, true); // As done by ResetForNewFrame() on a worker list
+            BuildPrimitives(dst_list, (unsigned int)(frame * 1000 + list_n));
+            dst_list->PopClipRect();
+        }
+        if (narrow_clip)
+            dst_list->PopClipRect();
+        ImGui::Text("List %d", list_n);
+        dst_list->AddRectFilled(ImVec2(5.0f * list_n, 5.0f), ImVec2(5.0f * list_n + 4.0f, 9.0f), IM_COL32(255, 255, 255, 255));
+    }
+    ImGui::End();
+
+    for (size_t thread_n = 0; thread_n < threads.size(); thread_n++)
+        threads[thread_n].join();
+    ImGui::Render();
+
+    memset(pixels.Data, 0, (size_t)pixels.Size);
+    ImGui_ImplSoftware_RenderDrawData(ImGui::GetDrawData(), pixels.Data, STRESS_WIDTH, STRESS_HEIGHT, STRESS_WIDTH * 4);
+    return HashPixels(pixels);
+}
+
+int main(int argc, char** argv)
+{
+    int thread_count = 8;
+    for (int n = 1; n < argc; n++)
+        if (strcmp(argv[n], "--threads") == 0 && n + 1 < argc)
+            thread_count = atoi(argv[++n]);
+    if (thread_count < 1)
+        thread_count = 1;
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2((float)STRESS_WIDTH, (float)STRESS_HEIGHT);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui_ImplSoftware_Init(1);
+    ImGui_ImplSoftware_NewFrame();
+
+    ImVector<unsigned char> pixels;
+    pixels.resize(STRESS_WIDTH * STRESS_HEIGHT * 4);
+    std::vector<ImDrawList*> worker_lists;
+    int failures = 0;
+    for (int frame = 0; frame < 2; frame++) // Let the window settle (size, scrollbar) before comparing frames
+        RenderFrame(0, thread_count, false, worker_lists, pixels);
+    for (int frame = 0; frame < STRESS_FRAMES; frame++)
+    {
+        const unsigned long long hash_deferred = RenderFrame(frame, thread_count, true, worker_lists, pixels);
+        const unsigned long long hash_serial = RenderFrame(frame, thread_count, false, worker_lists, pixels);
+        if (hash_deferred != hash_serial)
+        {
+            printf("FAILED: frame %d: deferred 0x%016llX, serial 0x%016llX\n", frame, hash_deferred, hash_serial);
+            failures++;
+        }
+    }
+    printf("%s: %d frames, %d threads, %d lists per frame\n", failures ? "FAILED" : "OK", STRESS_FRAMES, thread_count, thread_count * STRESS_LISTS_PER_THREAD);
+
+    for (size_t n = 0; n < worker_lists.size(); n++)
+        IM_DELETE(worker_lists[n]);
+    ImGui_ImplSoftware_Shutdown();
+    ImGui::DestroyContext();
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,121 @@
+// Golden image check for imgui_impl_software: render frames of the demo window headless, dump the last one
+// with ImGui_ImplSoftware_SaveImagePPM() and compare the hash of the file with a known value.
+// The frame is rendered once with a single thread and once with all hardware threads: both outputs need to match.
+//
+// Build and run from this folder, e.g.:
+//   g++ -std=c++11 -O2 -I.. -o imgui_impl_software_golden imgui_impl_software_golden.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp ../imgui_demo.cpp ../imgui_impl_software.cpp -lpthread
+//   ./imgui_impl_software_golden                 Check against GOLDEN_HASH, the dump is kept as 'imgui_impl_software_golden.ppm' on failure
+//   ./imgui_impl_software_golden --update        Print the hash of the current output, to update GOLDEN_HASH after an intentional change
+//   ./imgui_impl_software_golden --threads 8     Use 8 threads for the multi-threaded run (default: all hardware threads)
+//
+// Rasterization uses float math: GOLDEN_HASH was computed on x86-64 (SSE2), other targets or compiler settings may legitimately differ.
+// Average rendering times are printed for information, they are not checked.
+
+#include "imgui.h"
+#include "imgui_impl_software.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+
+#define GOLDEN_WIDTH        1280
+#define GOLDEN_HEIGHT       720
+#define GOLDEN_FRAMES       60
+#define GOLDEN_HASH         0x42DE516E1E90C80Eull
+#define GOLDEN_DUMP_FILE    "imgui_impl_software_golden.ppm"
+
+// FNV-1a 64-bit
+static unsigned long long HashFile(const char* filename)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return 0;
+    unsigned long long hash = 0xCBF29CE484222325ull;
+    unsigned char buf[4096];
+    for (size_t size; (size = fread(buf, 1, sizeof(buf), f)) > 0; )
+        for (size_t n = 0; n < size; n++)
+            hash = (hash ^ buf[n]) * 0x100000001B3ull;
+    fclose(f);
+    return hash;
+}
+
+// Run GOLDEN_FRAMES frames of the demo window, render each of them, dump the last one. Return the hash of the dump.
+static unsigned long long RenderDemo(int thread_count, const char* dump_filename, double* out_ms_per_frame)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2((float)GOLDEN_WIDTH, (float)GOLDEN_HEIGHT);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui_ImplSoftware_Init(thread_count);
+
+    const int stride = GOLDEN_WIDTH * 4;
+    ImVector<unsigned char> pixels;
+    pixels.resize(stride * GOLDEN_HEIGHT);
+    double render_ms = 0.0;
+    for (int frame = 0; frame < GOLDEN_FRAMES; frame++)
+    {
+        ImGui_ImplSoftware_NewFrame();
+        ImGui::NewFrame();
+        ImGui::ShowDemoWindow();
+        ImGui::Render();
+
+        memset(pixels.Data, 0, (size_t)pixels.Size);
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        ImGui_ImplSoftware_RenderDrawData(ImGui::GetDrawData(), pixels.Data, GOLDEN_WIDTH, GOLDEN_HEIGHT, stride);
+        render_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+    *out_ms_per_frame = render_ms / GOLDEN_FRAMES;
+
+    ImGui_ImplSoftware_Shutdown();
+    ImGui::DestroyContext();
+
+    if (!ImGui_ImplSoftware_SaveImagePPM(dump_filename, pixels.Data, GOLDEN_WIDTH, GOLDEN_HEIGHT, stride))
+        return 0;
+    return HashFile(dump_filename);
+}
+
+int main(int argc, char** argv)
+{
+    bool update = false;
+    int thread_count = (int)std::thread::hardware_concurrency();
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--update") == 0)
+            update = true;
+        else if (strcmp(argv[n], "--threads") == 0 && n + 1 < argc)
+            thread_count = atoi(argv[++n]);
+    }
+    if (thread_count < 1)
+        thread_count = 1;
+
+    double ms_single = 0.0, ms_multi = 0.0;
+    const unsigned long long hash_single = RenderDemo(1, GOLDEN_DUMP_FILE, &ms_single);
+    const unsigned long long hash_multi = RenderDemo(thread_count, GOLDEN_DUMP_FILE, &ms_multi);
+    printf("%dx%d demo frame: 1 thread: %.2f ms, %d threads: %.2f ms\n", GOLDEN_WIDTH, GOLDEN_HEIGHT, ms_single, thread_count, ms_multi);
+    if (hash_single == 0 || hash_multi == 0)
+    {
+        printf("FAILED: could not write '%s'\n", GOLDEN_DUMP_FILE);
+        return 1;
+    }
+    if (hash_single != hash_multi)
+    {
+        printf("FAILED: output differs between 1 thread (0x%016llX) and %d threads (0x%016llX)\n", hash_single, thread_count, hash_multi);
+        return 1;
+    }
+    if (update)
+    {
+        printf("GOLDEN_HASH 0x%016llXull\n", hash_multi);
+        remove(GOLDEN_DUMP_FILE);
+        return 0;
+    }
+    if (hash_multi != GOLDEN_HASH)
+    {
+        printf("FAILED: hash 0x%016llX, expected 0x%016llX. Output kept in '%s'.\n", hash_multi, GOLDEN_HASH, GOLDEN_DUMP_FILE);
+        return 1;
+    }
+    remove(GOLDEN_DUMP_FILE);
+    printf("OK: 0x%016llX\n", hash_multi);
+    return 0;
+}
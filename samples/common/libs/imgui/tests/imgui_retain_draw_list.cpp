@@ -0,0 +1,232 @@
+// Check for ImGuiWindowFlags_RetainDrawList: the output of a retained window needs to be the same as the output of a regular window on every frame,
+// including the frames where its contents change after being stable. Two contexts receive the same pseudo-random mouse inputs and submit the same
+// windows, only one of them using ImGuiWindowFlags_RetainDrawList, and both are rendered with imgui_impl_software: the images need to be identical.
+//
+// Build and run from this folder, e.g.:
+//   g++ -std=c++11 -O2 -I.. -o imgui_retain_draw_list imgui_retain_draw_list.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp ../imgui_impl_software.cpp -lpthread
+//   ./imgui_retain_draw_list                     1000 frames
+//   ./imgui_retain_draw_list --frames 5000       5000 frames
+//   ./imgui_retain_draw_list --quads             Also use ImDrawListFlags_InstancedQuads and ImDrawListFlags_SdfShapes (expanded by Render())
+//   ./imgui_retain_draw_list --dynamic-glyphs    Also use ImFontAtlasFlags_DynamicGlyphs with a small texture region and text cycling through many glyphs, so that
+//                                                glyphs of retained output get evicted. Glyphs end up in different cells in each context, and bilinear
+//                                                filtering of texture coordinates at different positions may differ by a few units: images are compared
+//                                                with a small tolerance (a glyph rendered from a stale cell differs a lot more).
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"     // ImGuiContext::DrawListSharedData, DebugRetainedDrawListHits, ImTextStrToUtf8()
+#include "imgui_impl_software.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RETAIN_WIDTH            800
+#define RETAIN_HEIGHT           600
+
+static unsigned int NextRandom(unsigned int* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+// FNV-1a 64-bit
+static unsigned long long HashPixels(const ImVector<unsigned char>& pixels)
+{
+    unsigned long long hash = 0xCBF29CE484222325ull;
+    for (int n = 0; n < pixels.Size; n++)
+        hash = (hash ^ pixels.Data[n]) * 0x100000001B3ull;
+    return hash;
+}
+
+// Number of pixels with a channel differing by more than 'tolerance'
+static int CountDifferentPixels(const ImVector<unsigned char>& a, const ImVector<unsigned char>& b, int tolerance)
+{
+    int count = 0;
+    for (int n = 0; n < a.Size; n += 4)
+        for (int c = 0; c < 4; c++)
+            if (ImAbs((int)a.Data[n + c] - (int)b.Data[n + c]) > tolerance)
+            {
+                count++;
+                break;
+            }
+    return count;
+}
+
+// Widget values, one instance per context
+struct RetainTestState
+{
+    bool    Check;
+    float   Value;
+    float   Col[4];
+
+    RetainTestState() { Check = false; Value = 0.5f; Col[0] = 1.0f; Col[1] = Col[2] = 0.0f; Col[3] = 1.0f; }
+};
+
+// Contents change every few frames, at different rates, so that changes happen before, inside and after the table (which splits the draw list into channels)
+static void ShowWindows(RetainTestState* state, int frame, ImGuiWindowFlags flags, bool dynamic_glyphs)
+{
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImVec2(380.0f, 580.0f), ImGuiCond_Once);
+    ImGui::Begin("Widgets", NULL, flags | ImGuiWindowFlags_NoSavedSettings);
+    ImGui::Text("Counter: %d", frame / 7);
+    if (dynamic_glyphs)
+    {
+        // 24 glyphs out of U+00A1..U+00FF, changing every few frames
+        ImWchar glyphs[24];
+        for (int n = 0; n < IM_ARRAYSIZE(glyphs); n++)
+            glyphs[n] = (ImWchar)(0xA1 + ((frame / 3) * 7 + n) % 95);
+        char text[IM_ARRAYSIZE(glyphs) * 4 + 1];
+        ImGui::TextUnformatted(text, text + ImTextStrToUtf8(text, IM_ARRAYSIZE(text), glyphs, glyphs + IM_ARRAYSIZE(glyphs)));
+    }
+    ImGui::Checkbox("Checkbox", &state->Check);
+    ImGui::SliderFloat("Slider", &state->Value, 0.0f, 1.0f);
+    if (ImGui::TreeNode("Tree"))
+    {
+        for (int n = 0; n < 3 + (frame / 23) % 3; n++)
+            ImGui::BulletText("Item %d", n);
+        ImGui::TreePop();
+    }
+    if (ImGui::BeginTable("Table", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable))
+    {
+        for (int row = 0; row < 4; row++)
+        {
+            ImGui::TableNextRow();
+            for (int column = 0; column < 3; column++)
+            {
+                ImGui::TableNextColumn();
+                ImGui::Text("%d,%d: %d", row, column, (frame / 11) % (row + 2));
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::Text("After table: %d", frame / 17);
+    float values[16];
+    for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+        values[n] = (float)((n * 7 + frame / 5) % 11);
+    ImGui::PlotLines("Plot", values, IM_ARRAYSIZE(values));
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    draw_list->AddCircleFilled(ImVec2(p.x + 30.0f + (frame / 9) % 5 * 10.0f, p.y + 30.0f), 20.0f, IM_COL32(0, 200, 100, 255));
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    const float uv_max_y = dynamic_glyphs ? (atlas->TexHeight - atlas->TexDynamicHeight - 2) * atlas->TexUvScale.y : 1.0f; // Glyphs rasterized on demand are laid out differently in each context
+    draw_list->AddImageRounded(atlas->TexID, ImVec2(p.x + 100.0f, p.y), ImVec2(p.x + 200.0f, p.y + 60.0f), ImVec2(0.0f, 0.0f), ImVec2(1.0f, uv_max_y), IM_COL32_WHITE, 8.0f + (frame / 19) % 3);
+
+    // Vertices written directly are not fingerprinted: the window needs to tessellate them anyway
+    if ((frame / 29) % 4 != 3)
+    {
+        const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
+        const ImU32 col = IM_COL32(50 + (frame / 8) % 5 * 40, 80, 200, 255);
+        draw_list->PrimReserve(3, 3);
+        draw_list->PrimWriteIdx((ImDrawIdx)draw_list->_VtxCurrentIdx);
+        draw_list->PrimWriteIdx((ImDrawIdx)(draw_list->_VtxCurrentIdx + 1));
+        draw_list->PrimWriteIdx((ImDrawIdx)(draw_list->_VtxCurrentIdx + 2));
+        draw_list->PrimWriteVtx(ImVec2(p.x + 220.0f, p.y + 50.0f), uv, col);
+        draw_list->PrimWriteVtx(ImVec2(p.x + 250.0f, p.y), uv, col);
+        draw_list->PrimWriteVtx(ImVec2(p.x + 280.0f, p.y + 50.0f), uv, col);
+    }
+    ImGui::End();
+
+    // ColorPicker4() writes vertices directly for its triangle
+    ImGui::SetNextWindowPos(ImVec2(400.0f, 10.0f), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImVec2(390.0f, 580.0f), ImGuiCond_Once);
+    ImGui::Begin("Picker", NULL, flags | ImGuiWindowFlags_NoSavedSettings);
+    if ((frame / 13) % 3 != 0)
+        ImGui::ColorConvertHSVtoRGB(((frame / 13) % 20) * 0.05f, 0.7f, 0.8f, state->Col[0], state->Col[1], state->Col[2]);
+    ImGui::ColorPicker4("Color", state->Col, ImGuiColorEditFlags_PickerHueWheel);
+    ImGui::End();
+}
+
+static unsigned long long RenderFrame(ImGuiContext* ctx, RetainTestState* state, bool retain, bool quads, bool dynamic_glyphs, int frame, const ImVec2& mouse_pos, bool mouse_down, ImVector<unsigned char>& pixels)
+{
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.AddMousePosEvent(mouse_pos.x, mouse_pos.y);
+    io.AddMouseButtonEvent(0, mouse_down);
+    ImGui_ImplSoftware_NewFrame();
+    ImGui::NewFrame();
+    if (quads)
+        ctx->DrawListSharedData.InitialFlags |= ImDrawListFlags_InstancedQuads | ImDrawListFlags_SdfShapes;
+    ShowWindows(state, frame, retain ? ImGuiWindowFlags_RetainDrawList : ImGuiWindowFlags_None, dynamic_glyphs);
+    ImGui::Render();
+
+    memset(pixels.Data, 0, (size_t)pixels.Size);
+    ImGui_ImplSoftware_RenderDrawData(ImGui::GetDrawData(), pixels.Data, RETAIN_WIDTH, RETAIN_HEIGHT, RETAIN_WIDTH * 4);
+    return HashPixels(pixels);
+}
+
+int main(int argc, char** argv)
+{
+    int frame_count = 1000;
+    bool quads = false;
+    bool dynamic_glyphs = false;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--frames") == 0 && n + 1 < argc)
+            frame_count = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--quads") == 0)
+            quads = true;
+        else if (strcmp(argv[n], "--dynamic-glyphs") == 0)
+            dynamic_glyphs = true;
+    }
+
+    ImGuiContext* contexts[2];
+    RetainTestState states[2];
+    for (int n = 0; n < 2; n++)
+    {
+        contexts[n] = ImGui::CreateContext();
+        ImGui::SetCurrentContext(contexts[n]);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2((float)RETAIN_WIDTH, (float)RETAIN_HEIGHT);
+        io.DeltaTime = 1.0f / 60.0f;
+        if (dynamic_glyphs)
+        {
+            ImFontConfig font_cfg;
+            font_cfg.GlyphRanges = io.Fonts->GetGlyphRangesDefault(); // Basic Latin + Latin Supplement
+            io.Fonts->AddFontDefault(&font_cfg);
+            io.Fonts->Flags |= ImFontAtlasFlags_DynamicGlyphs | ImFontAtlasFlags_NoPowerOfTwoHeight;
+            io.Fonts->TexDynamicHeight = 48;
+        }
+        ImGui_ImplSoftware_Init(1);
+    }
+
+    ImVector<unsigned char> pixels_retained, pixels_regular;
+    pixels_retained.resize(RETAIN_WIDTH * RETAIN_HEIGHT * 4);
+    pixels_regular.resize(RETAIN_WIDTH * RETAIN_HEIGHT * 4);
+    const int tolerance = dynamic_glyphs ? 4 : 0;
+    unsigned int rng = 1234;
+    ImVec2 mouse_pos(100.0f, 100.0f);
+    bool mouse_down = false;
+    int failures = 0, hits = 0;
+    for (int frame = 0; frame < frame_count; frame++)
+    {
+        const unsigned int r = NextRandom(&rng) % 100;
+        if (r < 10)
+            mouse_pos = ImVec2((float)(NextRandom(&rng) % RETAIN_WIDTH), (float)(NextRandom(&rng) % RETAIN_HEIGHT));
+        else if (r < 20)
+            mouse_pos += ImVec2((float)((int)(NextRandom(&rng) % 21) - 10), (float)((int)(NextRandom(&rng) % 21) - 10));
+        else if (r < 26)
+            mouse_down = !mouse_down;
+
+        const unsigned long long hash_retained = RenderFrame(contexts[0], &states[0], true, quads, dynamic_glyphs, frame, mouse_pos, mouse_down, pixels_retained);
+        hits += contexts[0]->DebugRetainedDrawListHits;
+        const unsigned long long hash_regular = RenderFrame(contexts[1], &states[1], false, quads, dynamic_glyphs, frame, mouse_pos, mouse_down, pixels_regular);
+        const int different_pixels = (hash_retained != hash_regular) ? CountDifferentPixels(pixels_retained, pixels_regular, tolerance) : 0;
+        if (different_pixels > 0)
+        {
+            if (failures < 10)
+                printf("FAILED: frame %d: retained 0x%016llX, regular 0x%016llX, %d different pixels\n", frame, hash_retained, hash_regular, different_pixels);
+            failures++;
+        }
+    }
+    ImGui::SetCurrentContext(contexts[0]);
+    printf("%s: %d frames, %d failures, %d windows reused their retained output, font atlas generation %d\n", failures ? "FAILED" : "OK", frame_count, failures, hits, ImGui::GetIO().Fonts->TexGeneration);
+
+    for (int n = 0; n < 2; n++)
+    {
+        ImGui::SetCurrentContext(contexts[n]);
+        ImGui_ImplSoftware_Shutdown();
+        ImGui::DestroyContext(contexts[n]);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+// Check for the CPU references of renderers supporting ImGuiBackendFlags_RendererHasSdfShapes and ImGuiBackendFlags_RendererHasSdfText:
+// - Rounded rectangles and circles are tessellated and rendered with imgui_impl_software. The same shapes are submitted to a draw list using
+//   ImDrawListFlags_InstancedQuads | ImDrawListFlags_SdfShapes, and the coverage of their ImDrawQuad is computed with ImDrawQuadCalcCoverage().
+// - Text using a signed distance field font is rendered with imgui_impl_software at different scales. The same text is submitted as ImDrawQuad,
+//   and the coverage of each glyph is computed with ImFontSdfCalcCoverage() from the texture sampled with bilinear filtering.
+// Shapes are drawn in white over black, so the coverage is the red channel of the output. Both need to match within a tolerance: tessellated
+// arcs are approximated by segments (see ImDrawListSharedData::CircleSegmentMaxError), and the renderer samples textures with 8-bit weights.
+//
+// Build and run from this folder, e.g.:
+//   g++ -std=c++11 -O2 -I.. -o imgui_sdf_coverage imgui_sdf_coverage.cpp ../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp ../imgui_impl_software.cpp -lpthread
+//   ./imgui_sdf_coverage
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"     // ImDrawQuadCalcCoverage(), ImFontSdfCalcCoverage()
+#include "imgui_impl_software.h"
+#include <stdio.h>
+#include <string.h>
+
+#define COVERAGE_WIDTH          640
+#define COVERAGE_HEIGHT         320
+
+// Shapes of one test case, submitted to either draw list
+typedef void (*SubmitFunc)(ImDrawList* draw_list, ImFont* font);
+
+static void SubmitShapes(ImDrawList* draw_list, ImFont*)
+{
+    const ImU32 col = IM_COL32_WHITE;
+    draw_list->AddRectFilled(ImVec2(10.0f, 10.0f), ImVec2(110.0f, 70.0f), col, 12.0f);
+    draw_list->AddRectFilled(ImVec2(130.5f, 10.25f), ImVec2(251.0f, 90.75f), col, 30.0f);
+    draw_list->AddRectFilled(ImVec2(270.0f, 10.0f), ImVec2(370.0f, 110.0f), col, 20.0f, ImDrawFlags_RoundCornersTopLeft | ImDrawFlags_RoundCornersBottomRight);
+    draw_list->AddRectFilled(ImVec2(390.3f, 20.6f), ImVec2(397.9f, 60.1f), col, 3.0f);
+    draw_list->AddCircleFilled(ImVec2(60.0f, 200.0f), 50.0f, col);
+    draw_list->AddCircleFilled(ImVec2(180.25f, 190.75f), 23.4f, col);
+    draw_list->AddCircleFilled(ImVec2(260.5f, 180.5f), 6.0f, col);
+    draw_list->AddCircleFilled(ImVec2(450.0f, 200.0f), 110.0f, col);
+}
+
+static void SubmitText(ImDrawList* draw_list, ImFont* font)
+{
+    const char* text = "Signed Distance 0123 @#%&";
+    draw_list->AddText(font, font->FontSize, ImVec2(10.0f, 10.0f), IM_COL32_WHITE, text);
+    draw_list->AddText(font, font->FontSize * 2.5f, ImVec2(10.3f, 60.6f), IM_COL32_WHITE, text);
+    draw_list->AddText(font, font->FontSize * 0.6f, ImVec2(10.0f, 180.0f), IM_COL32_WHITE, text);
+}
+
+static float SampleAlphaBilinear(const unsigned char* pixels, int width, int height, float u, float v)
+{
+    const float fx = ImClamp(u * width - 0.5f, 0.0f, (float)(width - 1));
+    const float fy = ImClamp(v * height - 0.5f, 0.0f, (float)(height - 1));
+    const int x0 = (int)fx, y0 = (int)fy;
+    const int x1 = ImMin(x0 + 1, width - 1), y1 = ImMin(y0 + 1, height - 1);
+    const float wx = fx - x0, wy = fy - y0;
+    const float top = pixels[(y0 * width + x0) * 4 + 3] * (1.0f - wx) + pixels[(y0 * width + x1) * 4 + 3] * wx;
+    const float bottom = pixels[(y1 * width + x0) * 4 + 3] * (1.0f - wx) + pixels[(y1 * width + x1) * 4 + 3] * wx;
+    return (top * (1.0f - wy) + bottom * wy) / 255.0f;
+}
+
+// Coverage of the quads of 'draw_list', blended in submission order as the renderer does it
+static void CalcReferenceCoverage(const ImDrawList* draw_list, ImVector<float>& coverage)
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    unsigned char* tex_pixels;
+    int tex_width, tex_height;
+    atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_width, &tex_height);
+
+    coverage.resize(COVERAGE_WIDTH * COVERAGE_HEIGHT);
+    memset(coverage.Data, 0, (size_t)coverage.size_in_bytes());
+    for (int quad_n = 0; quad_n < draw_list->QuadBuffer.Size; quad_n++)
+    {
+        const ImDrawQuad& quad = draw_list->QuadBuffer[quad_n];
+        const bool is_sdf_glyph = (quad.Rounding <= 0.0f && quad.UvMin.y >= atlas->TexUvSdfMinV);
+        const float texels_per_pixel = ImMax(ImFabs(quad.UvMax.x - quad.UvMin.x) * tex_width / (quad.Max.x - quad.Min.x), ImFabs(quad.UvMax.y - quad.UvMin.y) * tex_height / (quad.Max.y - quad.Min.y));
+        const float fringe = (quad.Rounding > 0.0f) ? 0.5f : 0.0f; // Rounded quads are drawn expanded by half a pixel
+        const int x0 = ImMax((int)ImFloor(quad.Min.x - fringe), 0), x1 = ImMin((int)ImCeil(quad.Max.x + fringe), COVERAGE_WIDTH);
+        const int y0 = ImMax((int)ImFloor(quad.Min.y - fringe), 0), y1 = ImMin((int)ImCeil(quad.Max.y + fringe), COVERAGE_HEIGHT);
+        for (int y = y0; y < y1; y++)
+            for (int x = x0; x < x1; x++)
+            {
+                const ImVec2 p(x + 0.5f, y + 0.5f);
+                float c = ImDrawQuadCalcCoverage(quad, p);
+                if (c > 0.0f && is_sdf_glyph)
+                {
+                    const float u = quad.UvMin.x + (p.x - quad.Min.x) / (quad.Max.x - quad.Min.x) * (quad.UvMax.x - quad.UvMin.x);
+                    const float v = quad.UvMin.y + (p.y - quad.Min.y) / (quad.Max.y - quad.Min.y) * (quad.UvMax.y - quad.UvMin.y);
+                    c *= ImFontSdfCalcCoverage(SampleAlphaBilinear(tex_pixels, tex_width, tex_height, u, v), (float)atlas->TexSdfSpread, texels_per_pixel);
+                }
+                float* dst = &coverage.Data[y * COVERAGE_WIDTH + x];
+                *dst = c + *dst * (1.0f - c);
+            }
+    }
+}
+
+// Render 'submit' both ways and compare. Returns false on failure.
+static bool CheckCoverage(const char* name, SubmitFunc submit, ImFont* font, float max_error_tolerance, float average_error_tolerance, ImVector<unsigned char>& pixels)
+{
+    // Tessellated, rendered with imgui_impl_software
+    ImGui_ImplSoftware_NewFrame();
+    ImGui::NewFrame();
+    submit(ImGui::GetBackgroundDrawList(), font);
+    ImGui::Render();
+    memset(pixels.Data, 0, (size_t)pixels.Size);
+    ImGui_ImplSoftware_RenderDrawData(ImGui::GetDrawData(), pixels.Data, COVERAGE_WIDTH, COVERAGE_HEIGHT, COVERAGE_WIDTH * 4);
+
+    // As ImDrawQuad, with the CPU references
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    draw_list._ResetForNewFrame();
+    draw_list.Flags |= ImDrawListFlags_InstancedQuads | ImDrawListFlags_SdfShapes;
+    draw_list.PushClipRectFullScreen();
+    draw_list.PushTextureID(ImGui::GetIO().Fonts->TexID);
+    submit(&draw_list, font);
+    if (draw_list.VtxBuffer.Size > 0)
+    {
+        printf("FAILED: %s: %d vertices were output instead of quads\n", name, draw_list.VtxBuffer.Size);
+        return false;
+    }
+    ImVector<float> coverage;
+    CalcReferenceCoverage(&draw_list, coverage);
+
+    float max_error = 0.0f, total_error = 0.0f;
+    int covered_pixels = 0;
+    for (int n = 0; n < coverage.Size; n++)
+    {
+        const float rendered = pixels.Data[n * 4] / 255.0f;
+        if (rendered == 0.0f && coverage.Data[n] == 0.0f)
+            continue;
+        const float error = ImFabs(rendered - coverage.Data[n]);
+        max_error = ImMax(max_error, error);
+        total_error += error;
+        covered_pixels++;
+    }
+    const float average_error = covered_pixels ? total_error / covered_pixels : 0.0f;
+    const bool ok = (covered_pixels > 0 && max_error <= max_error_tolerance && average_error <= average_error_tolerance);
+    printf("%s: %s: %d pixels, max error %.3f (tolerance %.3f), average error %.4f (tolerance %.4f)\n", ok ? "OK" : "FAILED", name, covered_pixels, max_error, max_error_tolerance, average_error, average_error_tolerance);
+    return ok;
+}
+
+int main(int, char**)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2((float)COVERAGE_WIDTH, (float)COVERAGE_HEIGHT);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.Fonts->AddFontDefault();
+    ImFontConfig font_cfg;
+    font_cfg.SizePixels = 32.0f;
+    font_cfg.SignedDistanceField = true;
+    ImFont* sdf_font = io.Fonts->AddFontDefault(&font_cfg);
+    ImGui_ImplSoftware_Init(1);
+
+    ImVector<unsigned char> pixels;
+    pixels.resize(COVERAGE_WIDTH * COVERAGE_HEIGHT * 4);
+    int failures = 0;
+    failures += CheckCoverage("rounded rectangles and circles", SubmitShapes, NULL, 0.35f, 0.01f, pixels) ? 0 : 1;
+    failures += CheckCoverage("signed distance field text", SubmitText, sdf_font, 0.10f, 0.015f, pixels) ? 0 : 1;
+
+    ImGui_ImplSoftware_Shutdown();
+    ImGui::DestroyContext();
+    return failures ? 1 : 0;
+}
@@ -20,6 +20,9 @@ vb: [zd3d12.GraphicsContext.max_num_buffered_frames]zd3d12.ResourceHandle,
 ib: [zd3d12.GraphicsContext.max_num_buffered_frames]zd3d12.ResourceHandle,
 vb_cpu_addr: [zd3d12.GraphicsContext.max_num_buffered_frames][]align(8) u8,
 ib_cpu_addr: [zd3d12.GraphicsContext.max_num_buffered_frames][]align(8) u8,
+/// Merge draw commands with ImDrawData_Optimize() in draw(). It modifies the context's draw lists in place,
+/// so only enable it when nothing inspects the draw data (or the window draw lists) after draw().
+optimize_draw_data: bool = false,
 
 pub fn init(
     arena: std.mem.Allocator,
@@ -121,6 +124,14 @@ pub fn draw(gui: *GuiRenderer, gctx: *zd3d12.GraphicsContext) void {
     if (draw_data == null or draw_data.?.*.TotalVtxCount == 0) {
         return;
     }
+    if (gui.optimize_draw_data) {
+        // Merge draw commands sharing the same texture and scissor rect (we issue one draw call per command).
+        // This must be the last use of the draw data before rendering: it modifies the draw lists in place.
+        _ = c.ImDrawData_Optimize(draw_data);
+        if (draw_data.?.*.TotalVtxCount == 0) {
+            return;
+        }
+    }
     const num_vertices = @as(u32, @intCast(draw_data.?.*.TotalVtxCount));
     const num_indices = @as(u32, @intCast(draw_data.?.*.TotalIdxCount));
 
@@ -170,29 +181,14 @@ pub fn draw(gui: *GuiRenderer, gctx: *zd3d12.GraphicsContext) void {
         };
     }
     // Update vertex and index buffers.
-    {
-        var vb_slice = std.mem.bytesAsSlice(c.ImDrawVert, gui.vb_cpu_addr[gctx.frame_index]);
-        var ib_slice = std.mem.bytesAsSlice(c.ImDrawIdx, gui.ib_cpu_addr[gctx.frame_index]);
-        var vb_idx: u32 = 0;
-        var ib_idx: u32 = 0;
-        var cmdlist_idx: u32 = 0;
-        const num_cmdlists = @as(u32, @intCast(draw_data.?.*.CmdListsCount));
-        while (cmdlist_idx < num_cmdlists) : (cmdlist_idx += 1) {
-            const list = draw_data.?.*.CmdLists[cmdlist_idx];
-            const list_vb_size = @as(u32, @intCast(list.*.VtxBuffer.Size));
-            const list_ib_size = @as(u32, @intCast(list.*.IdxBuffer.Size));
-            @memcpy(
-                vb_slice[vb_idx .. vb_idx + list_vb_size],
-                list.*.VtxBuffer.Data[0..list_vb_size],
-            );
-            @memcpy(
-                ib_slice[ib_idx .. ib_idx + list_ib_size],
-                list.*.IdxBuffer.Data[0..list_ib_size],
-            );
-            vb_idx += list_vb_size;
-            ib_idx += list_ib_size;
-        }
-    }
+    c.ImDrawData_CopyToBuffers(
+        draw_data,
+        gui.vb_cpu_addr[gctx.frame_index].ptr,
+        gui.ib_cpu_addr[gctx.frame_index].ptr,
+        c.ImDrawIdxFormat_Native,
+        0,
+        -1,
+    );
 
     const display_x = draw_data.?.*.DisplayPos.x;
     const display_y = draw_data.?.*.DisplayPos.y;
@@ -215,6 +215,17 @@ pub fn initWindow(allocator: std.mem.Allocator, name: [*:0]const u8, width: u32,
     assert(c.igGetCurrentContext() == null);
     _ = c.igCreateContext(null);
 
+    // Structures mirrored by hand in cimgui.h need to match their C++ declarations
+    assert(c.igDebugCheckCimguiDataLayout(
+        @sizeOf(c.ImGuiWindow),
+        @sizeOf(c.ImGuiWindowRetainedDrawList),
+        @sizeOf(c.ImDrawList),
+        @sizeOf(c.ImDrawListCache),
+        @sizeOf(c.ImDrawData),
+        @sizeOf(c.ImFontAtlas),
+        @sizeOf(c.ImFont),
+    ));
+
     const ui = c.igGetIO().?;
     assert(ui.*.BackendPlatformUserData == null);
 